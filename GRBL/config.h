@@ -34,6 +34,8 @@
 
 // #define DEBUGOUT // Remove comment to add HAL entry point for debug output
 
+// #define STEPPER_ISR_STATS // Remove comment to record stepper ISR execution times, reported by $T. Requires driver support (hal.get_cycle_count)
+
 // Define CPU pin map and default settings.
 // NOTE: OEMs can avoid the need to maintain/update the defaults.h and cpu_map.h files and use only
 // one configuration file by placing their specific defaults and pin map at the bottom of this file.
@@ -68,6 +70,8 @@
 #define CMD_SAFETY_DOOR 0x84
 #define CMD_JOG_CANCEL  0x85
 //#define CMD_DEBUG_REPORT 0x86 // Only when DEBUG enabled, sends debug report in '{}' braces.
+#define CMD_MOTION_FRAMES 0x8B  // Only when MOTION_FRAMES enabled, switches the input stream to binary motion frames.
+#define CMD_STATUS_FRAME 0x8C   // Only when STATUS_FRAMES enabled, requests a binary status frame.
 #define CMD_OVERRIDE_FEED_RESET 0x90         // Restores feed override value to 100%.
 #define CMD_OVERRIDE_FEED_COARSE_PLUS 0x91
 #define CMD_OVERRIDE_FEED_COARSE_MINUS 0x92
@@ -192,6 +196,19 @@
 #define REPORT_WCO_REFRESH_BUSY_COUNT 30        // (2-255)
 #define REPORT_WCO_REFRESH_IDLE_COUNT 10        // (2-255) Must be less than or equal to the busy count
 
+// Minimum interval, in milliseconds, between status reports pushed when automatic reporting is enabled
+// by the $71 setting. A status report is about 100 characters, so at 115200 baud a report takes about
+// 10 ms to transmit. Shorter intervals set are raised to this value.
+#define STATUS_REPORT_INTERVAL_MIN 20
+
+// Enables binary status frames, a compact alternative to the realtime status report for high report
+// rates. A frame is requested by the CMD_STATUS_FRAME realtime command, or pushed in place of the status
+// report when automatic reporting is enabled by $71 and $72 is set. Machine position is sent in steps and
+// only fields that have changed since the last frame are included, see status_frame.h for the layout.
+// Every STATUS_FRAME_KEY_INTERVAL frames a key frame carrying all fields is sent.
+// #define STATUS_FRAMES // Default disabled. Uncomment to enable.
+#define STATUS_FRAME_KEY_INTERVAL 50 // (1-255)
+
 // The temporal resolution of the acceleration management subsystem. A higher number gives smoother
 // acceleration, particularly noticeable on machines that run at very high feedrates, but may negatively
 // impact performance. The correct value for this parameter is machine dependent, so it's advised to
@@ -201,6 +218,57 @@
 // certain the step segment buffer is increased/decreased to account for these changes.
 #define ACCELERATION_TICKS_PER_SECOND 100
 
+// Adapts the step segment execution time to the velocity profile. When cruising segments are made up to
+// SEGMENT_TIME_CRUISE_SCALE times longer, reducing the main loop time spent on segment generation. In
+// acceleration and deceleration ramps segments are made SEGMENT_TIME_RAMP_SCALE times shorter, for
+// smoother velocity and laser power changes, but only while the segment buffer holds at least half of
+// its nominal execution time (buffer size times 1/ACCELERATION_TICKS_PER_SECOND) as a safety margin.
+// NOTE: Longer segments increase the time buffered, and thus the time before a feed hold or override
+// takes effect, by up to SEGMENT_TIME_CRUISE_SCALE times. Spindle synchronized motion, feed holds and
+// system motions always use the nominal segment time.
+// #define ADAPTIVE_SEGMENT_TIME // Default disabled. Uncomment to enable.
+#define SEGMENT_TIME_CRUISE_SCALE 2 // Integer (1-4)
+#define SEGMENT_TIME_RAMP_SCALE 2   // Integer (1-4)
+
+// Precomputes the step outputs of each step segment as a pattern, one entry per stepper timer tick, for
+// drivers that can play out a pattern by DMA or similar without an interrupt per step (hal.stepper_pattern_start).
+// The stepper ISR is then only called once per segment, the segment generator does the Bresenham line tracing.
+// Segments with more than STEP_PATTERN_MAX_TICKS ticks, homing, probing and spindle synchronized motion are
+// output one step per interrupt as usual. The realtime position is updated at the end of each pattern.
+// NOTE: The pattern buffer uses STEP_PATTERN_MAX_TICKS bytes per segment in the segment buffer.
+// #define STEP_PATTERN_OUTPUT // Default disabled. Uncomment to enable.
+#define STEP_PATTERN_MAX_TICKS 512
+
+// Enables laser raster streaming. A G1 motion in laser mode may carry a row of pixel power values in a
+// (RASTER,<base64 data>) comment, one byte per pixel where 0 - 255 maps to 0 - the programmed S value.
+// The pixels are evenly spread over the motion and the power is set by the stepper ISR as each pixel
+// is entered, replacing one G1 motion per pixel. The laser is switched off at the end of the row.
+// Spindle overrides apply, power is not adjusted for speed in M4 mode. Pixels in excess of the number
+// of steps of the motion are discarded.
+// NOTE: Step pattern output (STEP_PATTERN_OUTPUT) is not used for raster motions.
+// #define LASER_RASTER // Default disabled. Uncomment to enable.
+#define LASER_RASTER_MAX_PIXELS 256 // Max number of pixels per motion
+
+// Enables the binary framed motion protocol. The CMD_MOTION_FRAMES realtime command switches the input
+// stream from G-code to frames carrying pre-parsed G0, G1, G2 and G3 motions in absolute work coordinates
+// (mm), see motion_frame.h for the layout. Frames are base64 encoded and sent one per line, realtime
+// commands may thus be sent anywhere in the stream as before. Frames are executed without going through
+// the G-code parser but are subject to the same modal state, frames are rejected with an error if the
+// feed rate mode is not G94, constant surface speed or scaling is active or lathe diameter mode is set.
+// NOTE: CMD_MOTION_FRAMES is kept in the stream so the switch takes place after the preceding G-code line.
+// #define MOTION_FRAMES // Default disabled. Uncomment to enable.
+
+// Enables windowed, sequence numbered acknowledgements. A line prefixed by @<n>, where n is a sequence
+// number 0 - 65535 incremented by one for each line, is not acknowledged by its own ok. Instead executed
+// lines are acknowledged cumulatively by ok:<n>,<free planner blocks>,<free input buffer characters>
+// where n is the sequence number of the last line executed. This is sent when the input buffer runs empty,
+// when STREAM_ACK_INTERVAL lines are pending or on receiving an empty numbered line. Errors are sent at
+// once as error:<code>,<n>,<free planner blocks>,<free input buffer characters>. A line out of sequence
+// is not executed and fails with error 43, a sender may restart the sequence at 0 at any time.
+// Lines without a sequence number are acknowledged by ok or error:<code> as before.
+// #define STREAM_WINDOWED_ACK // Default disabled. Uncomment to enable.
+#define STREAM_ACK_INTERVAL 8 // Max number of executed lines pending acknowledgement
+
 // Adaptive Multi-Axis Step Smoothing (AMASS) is an advanced feature that does what its name implies,
 // smoothing the stepping of multi-axis motions. This feature smooths motion particularly at low step
 // frequencies below 10kHz, where the aliasing between axes of multi-axis motions can cause audible
@@ -215,13 +283,21 @@
 // timer, and the CPU overhead. Level 0 (no AMASS, normal operation) frequency bin starts at the
 // Level 1 cutoff frequency and up to as fast as the CPU allows (over 30kHz in limited testing).
 // NOTE: AMASS cutoff frequency multiplied by ISR overdrive factor must not exceed maximum step frequency.
-// NOTE: Current settings are set to overdrive the ISR to no more than 16kHz, balancing CPU overhead
-// and timer accuracy.  Do not alter these settings unless you know what you are doing.
+// NOTE: Cutoff frequencies are derived from the maximum ISR rate, AMASS_ISR_RATE_MAX unless the driver
+// declares its own in hal.f_step_isr_max. Level n cutoff is the maximum ISR rate divided by 2^n, the
+// default of 16kHz gives 8, 4 and 2kHz cutoffs for levels 1 to 3. The number of levels used is the lower
+// of MAX_AMASS_LEVEL and the level count supported by the driver (hal.driver_cap.amass_level).
+// NOTE: Bresenham step counts are multiplied by 2^MAX_AMASS_LEVEL, each additional level halves the
+// maximum number of steps per block. Do not alter these settings unless you know what you are doing.
 #ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
-  #define MAX_AMASS_LEVEL 3
+  #define MAX_AMASS_LEVEL 3 // 1-7
+  #define AMASS_ISR_RATE_MAX 16000 // Hz
   #if MAX_AMASS_LEVEL <= 0
     error "AMASS must have 1 or more levels to operate correctly."
   #endif
+  #if MAX_AMASS_LEVEL > 7
+    error "AMASS supports up to 7 levels."
+  #endif
 #endif
 
 // Sets the maximum step rate allowed to be written as a Grbl setting. This option enables an error
@@ -287,6 +363,8 @@
 // available RAM, like when re-compiling for MCU with ample amounts of RAM. Or decrease if the MCU begins to
 // crash due to the lack of available RAM or if the CPU is having trouble keeping up with planning
 // new incoming motions as they are executed.
+// NOTE: The buffer is allocated at startup, this is the default for the $41 setting and the size
+// used if the configured size cannot be allocated.
 // #define BLOCK_BUFFER_SIZE 16 // Uncomment to override default in planner.h.
 
 // Governs the size of the intermediary step segment buffer between the step execution algorithm
@@ -295,8 +373,21 @@
 // block velocity profile is traced exactly. The size of this buffer governs how much step
 // execution lead time there is for other Grbl processes have to compute and do their thing
 // before having to come back and refill this buffer, currently at ~50msec of step moves.
+// NOTE: The buffer is allocated at startup, this is the default for the $42 setting and the size
+// used if the configured size cannot be allocated.
 // #define SEGMENT_BUFFER_SIZE 6 // Uncomment to override default in stepper.h.
 
+// Plans entry speeds with fixed point math in the planner reverse and forward passes, the computationally
+// most intensive part of the planner. For processors without a floating point unit, where float math
+// is emulated in software. Jerk limited ramps are still computed with float math.
+// NOTE: Entry speeds are quantized to PLANNER_FX_UNIT (mm/min)^2, see planner.h.
+// #define PLANNER_FIXED_POINT // Default disabled. Uncomment to enable.
+
+// Records segment buffer underruns, where the stepper ISR runs out of segments before the motion is
+// completed, and the fill level seen by the segment generator. Reported in the realtime status report
+// with the buffer state (Bf), see $10.
+// #define SEGMENT_BUFFER_STATS // Default disabled. Uncomment to enable.
+
 // Configures the position after a probing cycle during Grbl's check mode. Disabled sets
 // the position to the probe target, when enabled sets the position to the start position.
 // #define SET_CHECK_MODE_PROBE_TO_START // Default disabled. Uncomment to enable.
@@ -105,6 +105,9 @@
 #define DEFAULT_X_MAX_TRAVEL 200.0f // mm NOTE: Must be a positive value.
 #define DEFAULT_Y_MAX_TRAVEL 200.0f // mm NOTE: Must be a positive value.
 #define DEFAULT_Z_MAX_TRAVEL 200.0f // mm NOTE: Must be a positive value.
+#define DEFAULT_X_JERK 0.0f // mm/sec^3, 0 = trapezoidal acceleration profile (infinite jerk)
+#define DEFAULT_Y_JERK 0.0f // mm/sec^3, 0 = trapezoidal acceleration profile (infinite jerk)
+#define DEFAULT_Z_JERK 0.0f // mm/sec^3, 0 = trapezoidal acceleration profile (infinite jerk)
 #define DEFAULT_X_CURRENT 0.0 // amps
 #define DEFAULT_Y_CURRENT 0.0 // amps
 #define DEFAULT_Z_CURRENT 0.0 // amps
@@ -123,6 +126,11 @@
 #define DEFAULT_STEPPER_IDLE_LOCK_TIME 25 // msec (0-254, 255 keeps steppers enabled)
 #define DEFAULT_JUNCTION_DEVIATION 0.01f // mm
 #define DEFAULT_ARC_TOLERANCE 0.002f // mm
+#define DEFAULT_LINE_MERGE_TOLERANCE 0.0f // mm (0 = disabled)
+#define DEFAULT_PLANNER_BLOCKS BLOCK_BUFFER_SIZE // blocks, restart required
+#define DEFAULT_SEGMENT_BLOCKS SEGMENT_BUFFER_SIZE // segments, restart required
+#define DEFAULT_STATUS_REPORT_INTERVAL 0 // msec (0 = disabled, reports on request only)
+#define DEFAULT_STATUS_REPORT_FRAMES 0 // false
 #define DEFAULT_REPORT_INCHES 0 // false
 #define DEFAULT_INVERT_LIMIT_PINS 0 // false
 #define DEFAULT_SOFT_LIMIT_ENABLE 0 // false
@@ -141,16 +149,19 @@
 #define DEFAULT_A_MAX_RATE 500.0f // mm/min
 #define DEFAULT_A_ACCELERATION (10.0*60*60) // 10*60*60 mm/min^2 = 10 mm/sec^2
 #define DEFAULT_A_MAX_TRAVEL 200.0f // mm
+#define DEFAULT_A_JERK 0.0f // mm/sec^3
 
 #define DEFAULT_B_STEPS_PER_MM 250.0f
 #define DEFAULT_B_MAX_RATE 500.0f // mm/min
 #define DEFAULT_B_ACCELERATION (10.0*60*60) // 10*60*60 mm/min^2 = 10 mm/sec^2
 #define DEFAULT_B_MAX_TRAVEL 200.0f // mm
+#define DEFAULT_B_JERK 0.0f // mm/sec^3
 
 #define DEFAULT_C_STEPS_PER_MM 250.0f
 #define DEFAULT_C_MAX_RATE 500.0f // mm/min
 #define DEFAULT_C_ACCELERATION (10.0*60*60) // 10*60*60 mm/min^2 = 10 mm/sec^2
 #define DEFAULT_C_MAX_TRAVEL 200.0f // mm
+#define DEFAULT_C_JERK 0.0f // mm/sec^3
 
 #define DEFAULT_G73_RETRACT 0.1f // mm
 
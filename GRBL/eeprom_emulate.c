@@ -230,7 +230,8 @@ void eeprom_emu_sync_physical ()
             physical_eeprom.memcpy_to_with_checksum(EEPROM_ADDR_GLOBAL, (uint8_t *)(noepromdata + EEPROM_ADDR_GLOBAL), sizeof(settings_t));
         }
 
-        uint_fast8_t idx = N_STARTUP_LINE, offset;
+        uint_fast8_t idx = N_STARTUP_LINE;
+        uint32_t offset;
         if(settings_dirty.startup_lines) do {
             idx--;
             if(bit_istrue(settings_dirty.startup_lines, bit(idx))) {
@@ -0,0 +1,204 @@
+/*
+  estimator.c - job time estimator, runs programs through the planner in check mode
+
+  Part of Grbl
+
+  Copyright (c) 2019 Terje Io
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  When estimating ($E) check mode queues motions in the planner as in normal operation. Instead of being
+  executed by the stepper the block at the buffer tail is executed in simulated time each time a new block
+  needs room, and all blocks are executed on buffer synchronization, e.g. on a tool change or program end.
+  The planner thus sees the same lookahead as when streaming to a machine, and the time for each block
+  is computed from its planned entry and exit speeds with the ramps used by the segment generator.
+
+  Times are reported on program end (M2, M30) and when estimation is ended by $E:
+
+    [EST:Job|Time:<s>|Motion:<s>|Dwell:<s>|Accel:<s>|Blocks:<n>]
+    [EST:T<tool>|Time:<s>]
+
+  Accel is the time lost to acceleration and deceleration, that is the time in excess of executing every
+  block at its nominal speed. Time is attributed to the selected tool, a new tool takes effect when the
+  blocks queued before the tool was selected have been executed.
+  NOTE: Time spent on program pauses, tool changes and spindle spin up delays is not included.
+*/
+
+#include "grbl.h"
+
+typedef struct {
+    uint8_t tool;
+    double time;                // (min)
+} tool_time_t;
+
+typedef struct {
+    double motion;              // Time executing motions (min)
+    double nominal;             // Time executing motions at nominal speed (min)
+    double dwell;               // (min)
+    uint32_t blocks;
+    uint8_t tool;               // Tool in use
+    uint8_t next_tool;          // Tool selected, in use when tool_blocks has been executed
+    uint_fast8_t tool_blocks;   // Number of blocks left to execute with current tool
+    uint_fast8_t tools;         // Number of tools with time recorded
+    tool_time_t tool_time[ESTIMATOR_TOOLS];
+} estimate_t;
+
+static estimate_t est;
+
+// Returns the time needed to change speed between the given speeds, accounts for jerk limiting.
+static float ramp_time (plan_block_t *block, float speed, float target_speed)
+{
+    float dv = fabsf(target_speed - speed);
+
+    if (block->jerk == 0.0f)
+        return dv / block->acceleration;
+
+    return dv >= block->jerk_speed ? (dv + block->jerk_speed) / block->acceleration : 2.0f * sqrtf(dv / block->jerk);
+}
+
+// Returns the time needed to execute a block from entry to exit speed, accelerating towards nominal speed.
+static float block_time (plan_block_t *block, float entry_speed, float exit_speed, float nominal_speed)
+{
+    float cruise = block->millimeters - plan_ramp_distance(block, entry_speed, nominal_speed) - plan_ramp_distance(block, exit_speed, nominal_speed);
+
+    if (cruise < 0.0f) {
+        // Nominal speed is not reached, find the peak speed where the ramps meet.
+        if (block->jerk == 0.0f)
+            nominal_speed = sqrtf(block->acceleration * block->millimeters + 0.5f * (entry_speed * entry_speed + exit_speed * exit_speed));
+        else {
+            uint_fast8_t iterations = 24;
+            float speed, low = max(entry_speed, exit_speed), high = nominal_speed;
+            do {
+                speed = 0.5f * (low + high);
+                if (plan_ramp_distance(block, entry_speed, speed) + plan_ramp_distance(block, exit_speed, speed) > block->millimeters)
+                    high = speed;
+                else
+                    low = speed;
+            } while(--iterations);
+            nominal_speed = low;
+        }
+        cruise = block->millimeters - plan_ramp_distance(block, entry_speed, nominal_speed) - plan_ramp_distance(block, exit_speed, nominal_speed);
+        if (cruise < 0.0f)
+            cruise = 0.0f;
+    }
+
+    return ramp_time(block, entry_speed, nominal_speed) + ramp_time(block, exit_speed, nominal_speed) + cruise / nominal_speed;
+}
+
+static void add_tool_time (double time)
+{
+    uint_fast8_t idx = 0;
+
+    while(idx < est.tools && est.tool_time[idx].tool != est.tool)
+        idx++;
+
+    if(idx == est.tools) {
+        if(est.tools < ESTIMATOR_TOOLS)
+            est.tool_time[est.tools++].tool = est.tool;
+        else
+            idx--;
+    }
+
+    est.tool_time[idx].time += time;
+}
+
+void estimator_start (void)
+{
+    memset(&est, 0, sizeof(estimate_t));
+    est.tool = est.next_tool = gc_state.tool->tool;
+}
+
+void estimator_tool_select (uint8_t tool)
+{
+    // Any line held back for merging was programmed with the current tool.
+    mc_line_flush();
+
+    est.next_tool = tool;
+    if((est.tool_blocks = plan_get_block_buffer_size() - 1 - plan_get_block_buffer_available()) == 0)
+        est.tool = tool;
+}
+
+void estimator_execute_block (void)
+{
+    float nominal_speed, time;
+    plan_block_t *block = plan_get_current_block();
+
+    if(block == NULL)
+        return;
+
+    // Spindle synchronized motion is estimated at programmed spindle speed.
+    if(block->condition.spindle.synchronized) {
+        if((nominal_speed = block->programmed_rate * block->spindle.rpm) < MINIMUM_FEED_RATE)
+            nominal_speed = MINIMUM_FEED_RATE;
+    } else
+        nominal_speed = plan_compute_profile_nominal_speed(block);
+
+  #ifdef PLANNER_FIXED_POINT
+    time = block_time(block, sqrtf(plan_fx_to_float(block->entry_speed_sqr_fx)), sqrtf(plan_get_exec_block_exit_speed_sqr()), nominal_speed);
+  #else
+    time = block_time(block, sqrtf(block->entry_speed_sqr), sqrtf(plan_get_exec_block_exit_speed_sqr()), nominal_speed);
+  #endif
+
+    est.blocks++;
+    est.motion += time;
+    est.nominal += block->millimeters / nominal_speed;
+    add_tool_time(time);
+
+    if(est.tool_blocks && --est.tool_blocks == 0)
+        est.tool = est.next_tool;
+
+    plan_discard_current_block();
+}
+
+void estimator_flush (void)
+{
+    while(plan_get_current_block())
+        estimator_execute_block();
+}
+
+void estimator_dwell (float seconds)
+{
+    estimator_flush();
+
+    est.dwell += seconds / 60.0f;
+    add_tool_time(seconds / 60.0f);
+}
+
+static void report_time (const char *name, double time)
+{
+    hal.stream.write(name);
+    hal.stream.write(ftoa((float)(time * 60.0), 3));
+}
+
+void estimator_report (void)
+{
+    uint_fast8_t idx;
+
+    report_time("[EST:Job|Time:", est.motion + est.dwell);
+    report_time("|Motion:", est.motion);
+    report_time("|Dwell:", est.dwell);
+    report_time("|Accel:", est.motion - est.nominal);
+    hal.stream.write("|Blocks:");
+    hal.stream.write(uitoa(est.blocks));
+    hal.stream.write("]\r\n");
+
+    for(idx = 0; idx < est.tools; idx++) {
+        hal.stream.write("[EST:T");
+        hal.stream.write(uitoa(est.tool_time[idx].tool));
+        report_time("|Time:", est.tool_time[idx].time);
+        hal.stream.write("]\r\n");
+    }
+}
@@ -0,0 +1,48 @@
+/*
+  estimator.h - job time estimator, runs programs through the planner in check mode
+
+  Part of Grbl
+
+  Copyright (c) 2019 Terje Io
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef estimator_h
+#define estimator_h
+
+// Max number of tools times are reported for, time for further tools is added to the last.
+#ifndef ESTIMATOR_TOOLS
+  #define ESTIMATOR_TOOLS 16
+#endif
+
+// Clears accumulated times and starts estimation, called when entering check mode with $E.
+void estimator_start (void);
+
+// Selects the tool time is attributed to for blocks queued from now on.
+void estimator_tool_select (uint8_t tool);
+
+// Executes the current planner block in simulated time and discards it.
+void estimator_execute_block (void);
+
+// Executes all planner blocks in simulated time, called on buffer synchronization.
+void estimator_flush (void);
+
+// Adds dwell time.
+void estimator_dwell (float seconds);
+
+// Reports accumulated times.
+void estimator_report (void);
+
+#endif
@@ -38,6 +38,56 @@ typedef enum {
     AxisCommand_Scaling
 } axis_command_t;
 
+// Classification of g-code word letters, used by the parser to store parameter word values
+// without a letter by letter switch.
+typedef enum {
+    WordClass_Unsupported = 0,
+    WordClass_Command,      // G and M, parsed by the command word switches
+    WordClass_Axis,         // Axis words, value stored in values.xyz[arg]
+    WordClass_Offset,       // Arc offset words I, J and K, value stored in values.ijk[arg]
+    WordClass_Float,        // Value stored as is, arg is offset of value in gc_values_t
+    WordClass_Integer       // H, L, N and T, value converted to an integer
+} word_class_t;
+
+typedef struct {
+    word_class_t class;
+    parameter_word_t parameter;
+    uint8_t arg;
+} gc_word_t;
+
+// Indexed by letter - 'A', letters not listed are unsupported.
+static const gc_word_t gc_words[26] = {
+#ifdef A_AXIS
+    ['A' - 'A'] = { WordClass_Axis, Word_A, A_AXIS },
+#endif
+#ifdef B_AXIS
+    ['B' - 'A'] = { WordClass_Axis, Word_B, B_AXIS },
+#endif
+#ifdef C_AXIS
+    ['C' - 'A'] = { WordClass_Axis, Word_C, C_AXIS },
+#endif
+    ['D' - 'A'] = { WordClass_Float, Word_D, offsetof(gc_values_t, d) },
+    ['F' - 'A'] = { WordClass_Float, Word_F, offsetof(gc_values_t, f) },
+    ['G' - 'A'] = { WordClass_Command },
+#ifdef N_TOOLS
+    ['H' - 'A'] = { WordClass_Integer, Word_H },
+#endif
+    ['I' - 'A'] = { WordClass_Offset, Word_I, X_AXIS },
+    ['J' - 'A'] = { WordClass_Offset, Word_J, Y_AXIS },
+    ['K' - 'A'] = { WordClass_Offset, Word_K, Z_AXIS },
+    ['L' - 'A'] = { WordClass_Integer, Word_L },
+    ['M' - 'A'] = { WordClass_Command },
+    ['N' - 'A'] = { WordClass_Integer, Word_N },
+    ['P' - 'A'] = { WordClass_Float, Word_P, offsetof(gc_values_t, p) }, // NOTE: For certain commands, P value must be an integer, but none of these commands are supported.
+    ['Q' - 'A'] = { WordClass_Float, Word_Q, offsetof(gc_values_t, q) }, // may be used for user defined mcodes
+    ['R' - 'A'] = { WordClass_Float, Word_R, offsetof(gc_values_t, r) },
+    ['S' - 'A'] = { WordClass_Float, Word_S, offsetof(gc_values_t, s) },
+    ['T' - 'A'] = { WordClass_Integer, Word_T },
+    ['X' - 'A'] = { WordClass_Axis, Word_X, X_AXIS },
+    ['Y' - 'A'] = { WordClass_Axis, Word_Y, Y_AXIS },
+    ['Z' - 'A'] = { WordClass_Axis, Word_Z, Z_AXIS }
+};
+
 // Declare gc extern struct
 parser_state_t gc_state;
 #ifdef N_TOOLS
@@ -127,6 +177,59 @@ void gc_set_laser_ppimode (bool on)
 	gc_state.is_laser_ppi_mode = on;
 }
 
+#ifdef LASER_RASTER
+
+static char *raster_data = NULL;
+
+// Sets base64 encoded laser raster data for the next block to be executed, called by protocol.
+void gc_set_raster_data (char *data)
+{
+    raster_data = data;
+}
+
+// Decodes base64 encoded raster data to pixel power, only validates the data if power is NULL.
+// Returns the number of pixels, 0 if the data is invalid or has too many pixels.
+static uint_fast16_t raster_decode (const char *data, uint8_t *power)
+{
+    char c;
+    uint32_t value = 0;
+    uint_fast8_t bits = 0;
+    uint_fast16_t pixels = 0;
+
+    while((c = *data++) && c != '=') {
+
+        if(c >= 'A' && c <= 'Z')
+            c = c - 'A';
+        else if(c >= 'a' && c <= 'z')
+            c = c - 'a' + 26;
+        else if(c >= '0' && c <= '9')
+            c = c - '0' + 52;
+        else if(c == '+')
+            c = 62;
+        else if(c == '/')
+            c = 63;
+        else
+            return 0;
+
+        value = (value << 6) | c;
+        if((bits += 6) >= 8) {
+            bits -= 8;
+            if(pixels == LASER_RASTER_MAX_PIXELS)
+                return 0;
+            if(power)
+                power[pixels] = (uint8_t)(value >> bits);
+            pixels++;
+        }
+    }
+
+    while(c == '=') // Only padding may follow
+        c = *data++;
+
+    return c == '\0' ? pixels : 0;
+}
+
+#endif
+
 // Executes one block (line) of 0-terminated G-Code. The block is assumed to contain only uppercase
 // characters and signed floating point values (no whitespace). Comments and block delete
 // characters have been removed. In this function, all units and positions are converted and
@@ -136,6 +239,13 @@ status_code_t gc_execute_block(char *block, char *message)
 {
     static parser_block_t gc_block;
 
+#ifdef LASER_RASTER
+    char *raster = raster_data;
+    uint_fast16_t raster_pixels = 0;
+
+    raster_data = NULL;
+#endif
+
     // Determine if the line is a program start/end marker.
     // Old comment from protocol.c:
     // NOTE: This maybe installed to tell Grbl when a program is running vs manual input,
@@ -154,8 +264,9 @@ status_code_t gc_execute_block(char *block, char *message)
      values struct, word tracking variables, and a non-modal commands tracker for the new
      block. This struct contains all of the necessary information to execute the block. */
 
-    memset(&gc_block, 0, sizeof(gc_block));                           // Initialize the parser block struct.
-    memcpy(&gc_block.modal, &gc_state.modal, sizeof(gc_state.modal)); // Copy current modes
+    memset(&gc_block, 0, offsetof(parser_block_t, modal));            // Initialize the parser block struct,
+    memcpy(&gc_block.modal, &gc_state.modal, sizeof(gc_state.modal)); // copy current modes
+    memset(&gc_block.values, 0, sizeof(gc_block.values));            // and clear values.
 
     axis_command_t axis_command = AxisCommand_None;
     plane_t plane;
@@ -185,6 +296,7 @@ status_code_t gc_execute_block(char *block, char *message)
      words, and for negative values set for the value words F, N, P, T, and S. */
 
     word_bit_t word_bit; // Bit-value for assigning tracking variables
+    const gc_word_t *word;
     uint_fast8_t char_counter = gc_parser_flags.jog_motion ? 3 /* Start parsing after `$J=` */ : 0;
     char letter;
     float value;
@@ -200,16 +312,21 @@ status_code_t gc_execute_block(char *block, char *message)
         if (!read_float(block, &char_counter, &value))
             FAIL(Status_BadNumberFormat); // [Expected word value]
 
-        // Convert values to smaller uint8 significand and mantissa values for parsing this word.
-        // NOTE: Mantissa is multiplied by 100 to catch non-integer command values. This is more
-        // accurate than the NIST gcode requirement of x10 when used for commands, but not quite
-        // accurate enough for value words that require integers to within 0.0001. This should be
-        // a good enough comprimise and catch most all non-integer errors. To make it compliant,
-        // we would simply need to change the mantissa to int16, but this add compiled flash space.
-        // Maybe update this later.
-        int_value = (uint_fast16_t)truncf(value);
-        mantissa = (uint_fast16_t)roundf(100.0f * (value - int_value)); // Compute mantissa for Gxx.x commands.
-        // NOTE: Rounding must be used to catch small floating point errors.
+        word = &gc_words[letter - 'A'];
+
+        // Only command words need the integer and mantissa values, value words are stored as is.
+        if(word->class == WordClass_Command) {
+            // Convert values to smaller uint8 significand and mantissa values for parsing this word.
+            // NOTE: Mantissa is multiplied by 100 to catch non-integer command values. This is more
+            // accurate than the NIST gcode requirement of x10 when used for commands, but not quite
+            // accurate enough for value words that require integers to within 0.0001. This should be
+            // a good enough comprimise and catch most all non-integer errors. To make it compliant,
+            // we would simply need to change the mantissa to int16, but this add compiled flash space.
+            // Maybe update this later.
+            int_value = (uint_fast16_t)truncf(value);
+            mantissa = (uint_fast16_t)roundf(100.0f * (value - int_value)); // Compute mantissa for Gxx.x commands.
+            // NOTE: Rounding must be used to catch small floating point errors.
+        }
 
         // Check if the g-code word is supported or errors due to modal group violations or has
         // been repeated in the g-code block. If ok, update the command or record its value.
@@ -375,11 +492,11 @@ status_code_t gc_execute_block(char *block, char *message)
 #endif
                         break;
 
-                    case 61:
+                    case 61: case 64:
                         word_bit.group = ModalGroup_G13;
                         if (mantissa != 0) // [G61.1 not supported]
                             FAIL(Status_GcodeUnsupportedCommand);
-                        // gc_block.modal.control = CONTROL_MODE_EXACT_PATH; // G61
+                        gc_block.modal.control = int_value == 61 ? ControlMode_ExactPath : ControlMode_Continuous;
                         break;
 
                     case 96: case 97:
@@ -502,127 +619,54 @@ status_code_t gc_execute_block(char *block, char *message)
 
                 /* Non-Command Words: This initial parsing phase only checks for repeats of the remaining
                 legal g-code words and stores their value. Error-checking is performed later since some
-                words (I,J,K,L,P,R) have multiple connotations and/or depend on the issued commands. */
-
-                switch(letter) {
-
-                  #ifdef A_AXIS
-					case 'A':
-						word_bit.parameter = Word_A;
-						gc_block.values.xyz[A_AXIS] = value;
-						bit_true(axis_words, bit(A_AXIS));
-						break;
-                  #endif
-
-				  #ifdef B_AXIS
-					case 'B':
-						word_bit.parameter = Word_B;
-						gc_block.values.xyz[B_AXIS] = value;
-						bit_true(axis_words, bit(B_AXIS));
-						break;
-                  #endif
-
-				  #ifdef C_AXIS
-					case 'C':
-						word_bit.parameter = Word_C;
-						gc_block.values.xyz[C_AXIS] = value;
-						bit_true(axis_words, bit(C_AXIS));
-						break;
-                 #endif
-
-                    case 'D':
-                        word_bit.parameter = Word_D;
-                        gc_block.values.d = value;
-                        break;
-
-                    case 'F':
-                        word_bit.parameter = Word_F;
-                        gc_block.values.f = value;
-                        break;
-#ifdef N_TOOLS
-                    case 'H':
-                        word_bit.parameter = Word_H;
-                        gc_block.values.h = int_value;
-                        break;
-#else
-                    // case 'H': // Not supported
-#endif
-                    case 'I':
-                        word_bit.parameter = Word_I;
-                        gc_block.values.ijk[X_AXIS] = value;
-                        bit_true(ijk_words, bit(X_AXIS));
-                        break;
-
-                    case 'J':
-                        word_bit.parameter = Word_J;
-                        gc_block.values.ijk[Y_AXIS] = value;
-                        bit_true(ijk_words, bit(Y_AXIS));
-                        break;
-
-                    case 'K':
-                        word_bit.parameter = Word_K;
-                        gc_block.values.ijk[Z_AXIS] = value;
-                        bit_true(ijk_words, bit(Z_AXIS));
-                        break;
+                words (I,J,K,L,P,R) have multiple connotations and/or depend on the issued commands.
+                The letter is looked up in gc_words[] for the parameter word and where to store the value. */
 
-                    case 'L':
-                        word_bit.parameter = Word_L;
-                        gc_block.values.l = int_value;
-                        break;
+                switch(word->class) {
 
-                    case 'N':
-                        word_bit.parameter = Word_N;
-                        gc_block.values.n = (int32_t)truncf(value);
+                    case WordClass_Axis:
+                        gc_block.values.xyz[word->arg] = value;
+                        bit_true(axis_words, bit(word->arg));
                         break;
 
-                    case 'P': // NOTE: For certain commands, P value must be an integer, but none of these commands are supported.
-                        word_bit.parameter = Word_P;
-                        gc_block.values.p = value;
+                    case WordClass_Offset:
+                        gc_block.values.ijk[word->arg] = value;
+                        bit_true(ijk_words, bit(word->arg));
                         break;
 
-                    case 'Q': // may be used for user defined mcodes
-                        word_bit.parameter = Word_Q;
-                        gc_block.values.q = value;
+                    case WordClass_Float:
+                        *(float *)((uint8_t *)&gc_block.values + word->arg) = value;
                         break;
 
-                    case 'R':
-                        word_bit.parameter = Word_R;
-                        gc_block.values.r = value;
-                        break;
-
-                    case 'S':
-                        word_bit.parameter = Word_S;
-                        gc_block.values.s = value;
-                        break;
-
-                    case 'T':
-                        word_bit.parameter = Word_T;
-                        if (value > MAX_TOOL_NUMBER)
-                            FAIL(Status_GcodeMaxValueExceeded);
-                        gc_block.values.t = int_value;
-                        break;
-
-                    case 'X':
-                        word_bit.parameter = Word_X;
-                        gc_block.values.xyz[X_AXIS] = value;
-                        bit_true(axis_words, bit(X_AXIS));
-                        break;
+                    case WordClass_Integer:
+                        int_value = (uint_fast16_t)truncf(value);
+                        switch(letter) {
+#ifdef N_TOOLS
+                            case 'H':
+                                gc_block.values.h = int_value;
+                                break;
+#endif
+                            case 'L':
+                                gc_block.values.l = int_value;
+                                break;
 
-                    case 'Y':
-                        word_bit.parameter = Word_Y;
-                        gc_block.values.xyz[Y_AXIS] = value;
-                        bit_true(axis_words, bit(Y_AXIS));
-                        break;
+                            case 'N':
+                                gc_block.values.n = (int32_t)truncf(value);
+                                break;
 
-                    case 'Z':
-                        word_bit.parameter = Word_Z;
-                        gc_block.values.xyz[Z_AXIS] = value;
-                        bit_true(axis_words, bit(Z_AXIS));
+                            case 'T':
+                                if (value > MAX_TOOL_NUMBER)
+                                    FAIL(Status_GcodeMaxValueExceeded);
+                                gc_block.values.t = int_value;
+                                break;
+                        }
                         break;
 
                     default: FAIL(Status_GcodeUnsupportedCommand);
 
-                } // end parameter letter switch
+                } // end parameter word class switch
+
+                word_bit.parameter = word->parameter;
 
                 // NOTE: Variable 'word_bit' is always assigned, if the non-command letter is valid.
                 if (bit_istrue(value_words, bit(word_bit.parameter)))
@@ -640,6 +684,51 @@ status_code_t gc_execute_block(char *block, char *message)
 
     // Parsing complete!
 
+    // Fast path for the bulk of CAM output: G0/G1 moves with axis words and optionally F and N words only.
+    // With no commands in the block and no modes active that modify axis words the error-checking in STEP 3
+    // reduces to the conversions done here, the block is then executed as usual.
+    if(axis_words && !(command_words || ijk_words || gc_parser_flags.jog_motion || gc_state.tool_change) &&
+        !(value_words & ~(AXIS_WORDS_MASK|bit(Word_F)|bit(Word_N))) &&
+         (gc_block.modal.motion == MotionMode_Seek || gc_block.modal.motion == MotionMode_Linear) &&
+          gc_block.modal.feed_mode == FeedMode_UnitsPerMin && gc_block.modal.spindle_rpm_mode == SpindleSpeedMode_RPM &&
+           !(gc_block.modal.scaling_active || gc_block.modal.diameter_mode)
+#ifdef LASER_RASTER
+            && !raster
+#endif
+             ) {
+
+        axis_command = AxisCommand_MotionMode;
+
+        if (bit_istrue(value_words, bit(Word_N)) && gc_block.values.n > MAX_LINE_NUMBER)
+            FAIL(Status_GcodeInvalidLineNumber); // [Exceeds max line number]
+
+        if (bit_isfalse(value_words, bit(Word_F)))
+            gc_block.values.f = gc_state.feed_rate; // Push last state feed rate
+        else if (gc_block.modal.units_imperial)
+            gc_block.values.f *= MM_PER_INCH;
+
+        if (gc_block.modal.motion == MotionMode_Linear && gc_block.values.f == 0.0f)
+            FAIL(Status_GcodeUndefinedFeedRate); // [Feed rate undefined]
+
+        gc_block.values.s = gc_state.spindle.rpm;
+        gc_block.values.t = gc_state.tool->tool;
+
+        uint_fast8_t idx = N_AXIS;
+        do { // Compute target position, see [19. Remaining non-modal actions] below.
+            if (bit_isfalse(axis_words, bit(--idx)))
+                gc_block.values.xyz[idx] = gc_state.position[idx];
+            else {
+                if (gc_block.modal.units_imperial)
+                    gc_block.values.xyz[idx] *= MM_PER_INCH;
+                if (gc_block.modal.distance_incremental)
+                    gc_block.values.xyz[idx] += gc_state.position[idx];
+                else
+                    gc_block.values.xyz[idx] += gc_block.modal.coord_system.xyz[idx] + gc_state.g92_coord_offset[idx] + gc_state.tool_length_offset[idx];
+            }
+        } while(idx);
+
+        goto execute;
+    }
 
   /* -------------------------------------------------------------------------------------
      STEP 3: Error-check all commands and values passed in this block. This step ensures all of
@@ -802,6 +891,8 @@ status_code_t gc_execute_block(char *block, char *message)
     // bit_false(value_words,bit(Word_S)); // NOTE: Single-meaning value word. Set at end of error-checking.
 
     // [5. Select tool ]: NOT SUPPORTED. Only tracks value. T is negative (done.) Not an integer. Greater than max tool value.
+    if (bit_isfalse(value_words, bit(Word_T)))
+        gc_block.values.t = gc_state.tool->tool; // Retain selected tool if no T word.
     // bit_false(value_words,bit(Word_T)); // NOTE: Single-meaning value word. Set at end of error-checking.
 
     // [6. Change tool ]:
@@ -1021,7 +1112,12 @@ status_code_t gc_execute_block(char *block, char *message)
             FAIL(Status_SettingReadFail);
     }
 
-    // [16. Set path control mode ]: N/A. Only G61. G61.1 and G64 NOT SUPPORTED.
+    // [16. Set path control mode ]: G64 P- is blending tolerance, no blending if P is missing. G61.1 NOT SUPPORTED.
+    if (bit_istrue(command_words, bit(ModalGroup_G13)) && gc_block.modal.control == ControlMode_Continuous && bit_istrue(value_words, bit(Word_P))) {
+        gc_block.path_tolerance = gc_block.modal.units_imperial ? gc_block.values.p * MM_PER_INCH : gc_block.values.p;
+        bit_false(value_words, bit(Word_P));
+    }
+
     // [17. Set distance mode ]: N/A. Only G91.1. G90.1 NOT SUPPORTED.
     // [18. Set retract mode ]: N/A.
 
@@ -1544,6 +1640,17 @@ status_code_t gc_execute_block(char *block, char *message)
         }
     }
 
+#ifdef LASER_RASTER
+    // [Laser raster]: Only valid for G1 motion in laser mode.
+    if (raster) {
+        if (!(settings.flags.laser_mode && hal.driver_cap.variable_spindle && gc_block.modal.motion == MotionMode_Linear &&
+               axis_command == AxisCommand_MotionMode && gc_block.modal.feed_mode != FeedMode_UnitsPerRev && !gc_parser_flags.jog_motion))
+            FAIL(Status_GcodeUnsupportedCommand); // [Raster not supported for block]
+        if ((raster_pixels = raster_decode(raster, NULL)) == 0)
+            FAIL(Status_BadNumberFormat); // [Invalid raster data or too many pixels]
+    }
+#endif
+
     // [21. Program flow ]: No error checks required.
 
     // [0. Non-specific error-checks]: Complete unused value words check, i.e. IJK used when in arc
@@ -1567,6 +1674,8 @@ status_code_t gc_execute_block(char *block, char *message)
 
     // Initialize planner data struct for motion blocks.
     plan_line_data_t plan_data;
+
+execute: // Fast path blocks continue here.
     memset(&plan_data, 0, sizeof(plan_line_data_t)); // Zero plan_data struct
 
     // Intercept jog commands and complete error checking for valid jog commands and execute.
@@ -1669,6 +1778,8 @@ status_code_t gc_execute_block(char *block, char *message)
     // else { plan_data.spindle.speed = 0.0; } // Initialized as zero already.
 
     // [5. Select tool ]: NOT SUPPORTED. Only tracks tool value.
+    if(sys.estimate && gc_block.values.t != gc_state.tool->tool)
+        estimator_tool_select(gc_block.values.t);
 #ifdef N_TOOLS
     gc_state.tool = &tool_table[gc_block.values.t < N_TOOLS ? gc_block.values.t : 0];
 #endif
@@ -1781,8 +1892,13 @@ status_code_t gc_execute_block(char *block, char *message)
         system_flag_wco_change();
     }
 
-    // [16. Set path control mode ]: G61.1/G64 NOT SUPPORTED
-    // gc_state.modal.control = gc_block.modal.control; // NOTE: Always default.
+    // [16. Set path control mode ]: G61.1 NOT SUPPORTED
+    if (bit_istrue(command_words, bit(ModalGroup_G13))) {
+        gc_state.modal.control = gc_block.modal.control;
+        gc_state.path_tolerance = gc_block.path_tolerance;
+    }
+    if (gc_state.modal.control == ControlMode_Continuous)
+        plan_data.path_tolerance = gc_state.path_tolerance; // Record data for planner use.
 
     // [17. Set distance mode ]:
     gc_state.modal.distance_incremental = gc_block.modal.distance_incremental;
@@ -1866,7 +1982,17 @@ status_code_t gc_execute_block(char *block, char *message)
                     //??    gc_state.distance_per_rev = plan_data.feed_rate;
                         // check initial feed rate - fail if zero?
                     }
+                  #ifdef LASER_RASTER
+                    if(raster_pixels && (plan_data.raster = malloc(sizeof(laser_raster_t) + raster_pixels)))
+                        plan_data.raster->pixels = raster_decode(raster, plan_data.raster->power);
+                  #endif
                     mc_line(gc_block.values.xyz, &plan_data);
+                  #ifdef LASER_RASTER
+                    if(plan_data.raster) { // Not queued, check mode or zero length motion.
+                        free(plan_data.raster);
+                        plan_data.raster = NULL;
+                    }
+                  #endif
                     break;
 
                 case MotionMode_Seek:
@@ -1992,6 +2118,10 @@ status_code_t gc_execute_block(char *block, char *message)
                 sys.report.override_counter = -1; // Set to report change immediately
             }
             hal.report.feedback_message(Message_ProgramEnd);
+            if(sys.estimate) {
+                estimator_report();
+                estimator_start();
+            }
         }
         gc_state.modal.program_flow = ProgramFlow_Running; // Reset program flow.
     }
@@ -2009,6 +2139,147 @@ status_code_t gc_execute_block(char *block, char *message)
     return Status_OK;
 }
 
+#ifdef MOTION_FRAMES
+
+// Executes a pre-parsed G0, G1, G2 or G3 motion received as a binary frame. Targets are absolute work
+// coordinates in mm, axes not in the frame keep their current position. The frame is rejected if the
+// modal state would give the values a different meaning than in a G-code block, otherwise the parser
+// state is updated as if the equivalent G-code block had been executed.
+status_code_t gc_execute_frame (motion_frame_t *frame)
+{
+    uint_fast8_t idx;
+    float target[N_AXIS], offset[N_AXIS], radius = 0.0f;
+    bool laser_disable = settings.flags.laser_mode && frame->type == MotionFrame_Seek;
+    plan_line_data_t plan_data;
+
+    if (frame->axes & ~AXES_BITMASK)
+        return Status_GcodeUnsupportedCommand; // [Unsupported axis]
+
+    if (!frame->axes)
+        return Status_GcodeNoAxisWords;
+
+    if (gc_state.tool_change)
+        return Status_GcodeToolChangePending;
+
+    if (gc_state.modal.feed_mode != FeedMode_UnitsPerMin || gc_state.modal.spindle_rpm_mode == SpindleSpeedMode_CSS ||
+         gc_state.modal.scaling_active || gc_state.modal.diameter_mode)
+        return Status_GcodeUnsupportedCommand; // [Modal state not supported by frames]
+
+    if (frame->flags.line_number && (frame->line_number < 0 || frame->line_number > MAX_LINE_NUMBER))
+        return Status_GcodeInvalidLineNumber;
+
+    if ((frame->flags.feed_rate && frame->feed_rate < 0.0f) || (frame->flags.rpm && frame->rpm < 0.0f))
+        return Status_NegativeValue;
+
+    if (frame->type != MotionFrame_Seek && (frame->flags.feed_rate ? frame->feed_rate : gc_state.feed_rate) == 0.0f)
+        return Status_GcodeUndefinedFeedRate;
+
+    idx = N_AXIS;
+    do {
+        idx--;
+        target[idx] = frame->axes & bit(idx)
+                       ? frame->target[idx] + gc_state.modal.coord_system.xyz[idx] + gc_state.g92_coord_offset[idx] + gc_state.tool_length_offset[idx]
+                       : gc_state.position[idx];
+    } while(idx);
+
+    plane_t plane;
+
+    switch (gc_state.modal.plane_select) {
+
+        case PlaneSelect_XY:
+            plane.axis_0 = X_AXIS;
+            plane.axis_1 = Y_AXIS;
+            plane.axis_linear = Z_AXIS;
+            break;
+
+        case PlaneSelect_ZX:
+            plane.axis_0 = Z_AXIS;
+            plane.axis_1 = X_AXIS;
+            plane.axis_linear = Y_AXIS;
+            break;
+
+        default: // case PlaneSelect_YZ:
+            plane.axis_0 = Y_AXIS;
+            plane.axis_1 = Z_AXIS;
+            plane.axis_linear = X_AXIS;
+    }
+
+    if (frame->type == MotionFrame_CwArc || frame->type == MotionFrame_CcwArc) {
+
+        if (frame->offset[0] == 0.0f && frame->offset[1] == 0.0f)
+            return Status_GcodeNoOffsetsInPlane;
+
+        clear_vector(offset);
+        offset[plane.axis_0] = frame->offset[0];
+        offset[plane.axis_1] = frame->offset[1];
+
+        // Same arc definition checks as for G2/G3 blocks in offset mode.
+        radius = hypot_f(offset[plane.axis_0], offset[plane.axis_1]);
+        float delta_r = fabsf(hypot_f(target[plane.axis_0] - gc_state.position[plane.axis_0] - offset[plane.axis_0],
+                                       target[plane.axis_1] - gc_state.position[plane.axis_1] - offset[plane.axis_1]) - radius);
+        if (delta_r > 0.005f && (delta_r > 0.5f || delta_r > (0.001f * radius)))
+            return Status_GcodeInvalidTarget; // [Arc definition error]
+    }
+
+    memset(&plan_data, 0, sizeof(plan_line_data_t));
+
+    if (settings.flags.laser_mode)
+        gc_state.is_rpm_rate_adjusted = gc_state.modal.spindle.ccw && !laser_disable && hal.driver_cap.variable_spindle;
+
+    if (frame->flags.line_number)
+        gc_state.line_number = frame->line_number;
+    plan_data.line_number = gc_state.line_number;
+
+    if (frame->flags.feed_rate)
+        gc_state.feed_rate = frame->feed_rate;
+    plan_data.feed_rate = gc_state.feed_rate;
+
+    // A frame is always a motion, in laser mode a spindle speed change is thus not synchronized.
+    if (frame->flags.rpm && gc_state.spindle.rpm != frame->rpm) {
+        if (gc_state.modal.spindle.on && !settings.flags.laser_mode)
+            spindle_sync(gc_state.modal.spindle, frame->rpm);
+        gc_state.spindle.rpm = frame->rpm;
+    }
+
+    if (!laser_disable)
+        memcpy(&plan_data.spindle, &gc_state.spindle, sizeof(spindle_t));
+
+    plan_data.condition.spindle = gc_state.modal.spindle;
+    plan_data.condition.is_rpm_rate_adjusted = gc_state.is_rpm_rate_adjusted;
+    plan_data.condition.is_laser_ppi_mode = gc_state.is_rpm_rate_adjusted && gc_state.is_laser_ppi_mode;
+    plan_data.condition.coolant = gc_state.modal.coolant;
+
+    if (gc_state.modal.control == ControlMode_Continuous)
+        plan_data.path_tolerance = gc_state.path_tolerance;
+
+    gc_state.modal.canned_cycle_active = false;
+
+    switch (frame->type) {
+
+        case MotionFrame_Seek:
+            gc_state.modal.motion = MotionMode_Seek;
+            plan_data.condition.rapid_motion = On;
+            mc_line(target, &plan_data);
+            break;
+
+        case MotionFrame_Linear:
+            gc_state.modal.motion = MotionMode_Linear;
+            mc_line(target, &plan_data);
+            break;
+
+        default: // MotionFrame_CwArc, MotionFrame_CcwArc
+            gc_state.modal.motion = frame->type == MotionFrame_CwArc ? MotionMode_CwArc : MotionMode_CcwArc;
+            mc_arc(target, &plan_data, gc_state.position, offset, radius, plane, frame->type == MotionFrame_CwArc);
+            break;
+    }
+
+    memcpy(gc_state.position, target, sizeof(gc_state.position));
+
+    return Status_OK;
+}
+
+#endif
+
 /*
   Not supported:
 
@@ -2030,5 +2301,5 @@ status_code_t gc_execute_block(char *block, char *message)
    group 8 = {M7*} enable mist coolant (* Compile-option)
    group 9 = {M48, M49, M56*} enable/disable override switches (* Compile-option)
    group 10 = {G98, G99} return mode canned cycles
-   group 13 = {G61.1, G64} path control mode (G61 is supported)
+   group 13 = {G61.1} path control mode (G61 and G64 are supported)
 */
@@ -25,6 +25,7 @@
 
 #include "coolant_control.h"
 #include "spindle_control.h"
+#include "motion_frame.h"
 
 
 // Define Grbl status codes. Valid values (0-255)
@@ -72,6 +73,8 @@ typedef enum {
     Status_GcodeIllegalToolTableEntry = 39,
     Status_GcodeToolChangePending = 40,
     Status_GcodeSpindleNotRunning = 41,
+    Status_MotionFrameInvalid = 42,
+    Status_StreamSequenceError = 43,
 
     Status_EStop = 50,
     Status_Unhandled = 59, // For internal use only
@@ -106,7 +109,7 @@ typedef enum {
     ModalGroup_G10,     // [G98,G99] Return mode in canned cycles
     ModalGroup_G11,     // [G50,G51] Scaling
     ModalGroup_G12,     // [G54,G55,G56,G57,G58,G59] Coordinate system selection
-    ModalGroup_G13,     // [G61] Control mode
+    ModalGroup_G13,     // [G61,G64] Control mode
     ModalGroup_G14,     // [G96,G97] Spindle Speed Mode
     ModalGroup_G15,     // [G7,G8] Lathe Diameter Mode
 
@@ -238,7 +241,10 @@ typedef enum {
 //#define CUTTER_COMP_DISABLE 0 // G40 (Default: Must be zero)
 
 // Modal Group G13: Control mode
-//#define CONTROL_MODE_EXACT_PATH 0 // G61 (Default: Must be zero)
+typedef enum {
+    ControlMode_ExactPath = 0,  // G61 (Default: Must be zero)
+    ControlMode_Continuous = 1  // G64
+} control_mode_t;
 
 // Modal Group G8: Tool length offset
 typedef enum {
@@ -353,7 +359,7 @@ typedef struct {
     // uint8_t cutter_comp;              // {G40} NOTE: Don't track. Only default supported.
     tool_offset_mode_t tool_offset_mode; // {G43,G43.1,G49}
     coord_system_t coord_system;         // {G54,G55,G56,G57,G58,G59,G59.1,G59.2,G59.3}
-    // uint8_t control;                  // {G61} NOTE: Don't track. Only default supported.
+    control_mode_t control;              // {G61,G64}
     program_flow_t program_flow;         // {M0,M1,M2,M30}
     coolant_state_t coolant;             // {M7,M8,M9}
     spindle_state_t spindle;             // {M3,M4,M5}
@@ -423,6 +429,7 @@ typedef struct {
     float g92_coord_offset[N_AXIS];     // Retains the G92 coordinate offset (work coordinates) relative to
                                         // machine zero in mm. Non-persistent. Cleared upon reset and boot.
     int32_t line_number;                // Last line number sent
+    float path_tolerance;               // G64 P- corner blending tolerance in mm, 0 if none
     tool_data_t *tool;                  // Tracks tool number and offset
     float tool_length_offset[N_AXIS];   // Tracks tool length offset value when enabled
     bool file_run;                      // Tracks % command
@@ -449,6 +456,8 @@ typedef struct {
     override_mode_t override_command; // TODO: add to non_modal above?
     uint_fast16_t driver_mcode;
     bool driver_mcode_sync;
+    float path_tolerance;             // G64 P- value in mm
+    // NOTE: The parser clears the members above for each block, modal is copied from the parser state.
     gc_modal_t modal;
     gc_values_t values;
 } parser_block_t;
@@ -465,6 +474,16 @@ status_code_t gc_execute_block(char *block, char *message);
 
 void gc_set_laser_ppimode (bool on);
 
+#ifdef LASER_RASTER
+// Sets base64 encoded laser raster data for the next block to be executed.
+void gc_set_raster_data (char *data);
+#endif
+
+#ifdef MOTION_FRAMES
+// Executes a pre-parsed motion received as a binary frame.
+status_code_t gc_execute_frame (motion_frame_t *frame);
+#endif
+
 // Gets axes scaling state.
 axes_signals_t gc_get_g51_state (void);
 float *gc_get_scaling (void);
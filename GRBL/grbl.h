@@ -31,6 +31,7 @@
 #include <inttypes.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -58,6 +59,8 @@
 #include "system.h"
 #include "override.h"
 #include "sleep.h"
+#include "estimator.h"
+#include "status_frame.h"
 
 // ---------------------------------------------------------------------------------------
 // COMPILE-TIME ERROR CHECKING OF DEFINE VALUES:
@@ -74,6 +77,10 @@
   #endif
 #endif
 
+#if defined(STATUS_FRAMES) && (STATUS_FRAME_KEY_INTERVAL < 1 || STATUS_FRAME_KEY_INTERVAL > 255)
+  #error "STATUS_FRAME_KEY_INTERVAL must be 1 - 255."
+#endif
+
 #if (REPORT_WCO_REFRESH_BUSY_COUNT < REPORT_WCO_REFRESH_IDLE_COUNT)
   #error "WCO busy refresh is less than idle refresh."
 #endif
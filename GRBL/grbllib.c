@@ -78,6 +78,7 @@ int grbl_enter (void)
 	hal.protocol_process_realtime = protocol_process_realtime;
 	hal.stream_blocking_callback = stream_tx_blocking;
 	hal.protocol_enqueue_gcode = protocol_enqueue_gcode;
+	hal.protocol_enqueue_command = protocol_enqueue_command;
 	memcpy(&hal.report, &report_fns, sizeof(report_t));
 
 #ifdef DEBUGOUT
@@ -95,8 +96,9 @@ int grbl_enter (void)
 // check and configure driver
 
 #ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
-    driver_ok = driver_ok && hal.driver_cap.amass_level >= MAX_AMASS_LEVEL;
-    hal.driver_cap.amass_level = MAX_AMASS_LEVEL;
+    driver_ok = driver_ok && hal.driver_cap.amass_level > 0;
+    if(hal.driver_cap.amass_level > MAX_AMASS_LEVEL)
+        hal.driver_cap.amass_level = MAX_AMASS_LEVEL;
 #else
     hal.driver_cap.amass_level = 0;
 #endif
@@ -119,6 +121,13 @@ int grbl_enter (void)
         while(true);
     }
 
+    // Allocate planner and step segment buffers, fall back to default sizes if the configured sizes cannot be allocated.
+    if(!(plan_alloc_buffer(settings.planner_blocks) || plan_alloc_buffer(BLOCK_BUFFER_SIZE)) ||
+        !(st_alloc_buffer(settings.segment_blocks) || st_alloc_buffer(SEGMENT_BUFFER_SIZE))) {
+        hal.stream.write("GrblHAL: out of memory\r\n");
+        while(true);
+    }
+
     mpg_init = sys.mpg_mode;
 
     if(hal.get_position)
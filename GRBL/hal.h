@@ -47,7 +47,7 @@ typedef union {
                  limits_pull_up          :1,
                  control_pull_up         :1,
                  probe_pull_up           :1,
-                 amass_level             :2, // 0...3
+                 amass_level             :3, // 0...7
                  program_stop            :1,
                  spindle_at_speed        :1,
                  laser_ppi_mode          :1,
@@ -58,7 +58,7 @@ typedef union {
                  wifi                    :1,
                  spindle_pwm_invert      :1,
                  spindle_pid             :1,
-                 unassigned              :11;
+                 unassigned              :10;
     };
 } driver_cap_t;
 
@@ -104,15 +104,30 @@ typedef struct {
     stream_write_ptr write; // write to current I/O stream only
     stream_write_ptr write_all; // write to all active output streams
     int16_t (*read)(void);
+    // Optional bulk read, read_span returns the number of characters that can be read contiguously from the
+    // input buffer and sets data to point to the first, read_commit consumes count characters from the start
+    // of the span and returns false if the input buffer has been flushed or cancelled since the span was returned.
+    // NOTE: must be cleared or redirected together with read, e.g. when input is switched to a file.
+    uint16_t (*read_span)(char **data);
+    bool (*read_commit)(uint16_t count);
     void (*reset_read_buffer)(void);
     void (*cancel_read_buffer)(void);
     bool (*suspend_read)(bool await);
 } io_stream_t;
 
+// Priority of commands queued by protocol_enqueue_command(), high priority commands are executed ahead of
+// normal priority commands queued earlier.
+typedef enum {
+    CommandPriority_Normal = 0, // Macros and other commands that are not time critical
+    CommandPriority_High        // Commands from an operator input device such as a keypad or MPG, e.g. jog commands
+} command_priority_t;
+
 typedef struct HAL {
     uint32_t version;
     char *info;
     uint32_t f_step_timer;
+    uint32_t f_cycle_counter;           // Frequency of the counter returned by get_cycle_count(), optional
+    uint32_t f_step_isr_max;            // Maximum stepper ISR rate (Hz) AMASS may overdrive the step timer to, optional
     uint32_t rx_buffer_size;
 
     bool (*driver_setup)(settings_t *settings);
@@ -167,6 +182,14 @@ typedef struct HAL {
     void (*driver_settings_report)(bool axis_settings, axis_setting_type_t setting_type, uint8_t axis_idx);
     spindle_data_t (*spindle_get_data)(spindle_data_request_t request);
     void (*spindle_reset_data)(void);
+    uint32_t (*get_cycle_count)(void);  // Free running counter for profiling, may wrap
+    uint32_t (*get_elapsed_ticks)(void); // Milliseconds since startup, may wrap. Optional, required for automatic status reports
+#ifdef STEP_PATTERN_OUTPUT
+    // Plays out stepper->exec_segment->pattern, one entry per stepper timer tick starting on the next tick.
+    // Direction outputs are to be set before the first entry if stepper->new_block is set, as for stepper_pulse_start.
+    // The stepper interrupt handler is to be called on the tick the last entry is output.
+    void (*stepper_pattern_start)(stepper_t *stepper);
+#endif
 #ifdef DEBUGOUT
     void (*debug_out)(bool on);
 #endif
@@ -182,6 +205,7 @@ typedef struct HAL {
 
     // callbacks - set up by grbl before MCU init
     bool (*protocol_enqueue_gcode)(char *data);
+    bool (*protocol_enqueue_command)(char *data, command_priority_t priority);
     bool (*protocol_process_realtime)(char data);
     bool (*stream_blocking_callback)(void);
     void (*stepper_interrupt_callback)(void);
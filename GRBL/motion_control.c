@@ -39,8 +39,8 @@ bool mc_line (float *target, plan_line_data_t *pl_data)
     if (sys.state != STATE_JOG && settings.limits.flags.soft_enabled)
         limits_soft_check(target);
 
-    // If in check gcode mode, prevent motion by blocking planner. Soft limits still work.
-    if (sys.state != STATE_CHECK_MODE && protocol_execute_realtime()) {
+    // If in check gcode mode, prevent motion by blocking planner unless estimating job time. Soft limits still work.
+    if ((sys.state != STATE_CHECK_MODE || sys.estimate) && protocol_execute_realtime()) {
 
         // NOTE: Backlash compensation may be installed here. It will need direction info to track when
         // to insert a backlash line motion(s) before the intended line motion and will require its own
@@ -56,17 +56,52 @@ bool mc_line (float *target, plan_line_data_t *pl_data)
         // doesn't update the machine position values. Since the position values used by the g-code
         // parser and planner are separate from the system machine positions, this is doable.
 
-        // If the buffer is full: good! That means we are well ahead of the robot.
-        // Remain in this loop until there is room in the buffer.
+        // Merge motion with the line held back by the planner, if enabled and possible. If not, the held
+        // back line and any corner blend (G64) is queued first and a new attempt made to hold back the motion.
+        while(!plan_merge_line(target, pl_data)) {
+
+            // If the buffer is full: good! That means we are well ahead of the robot.
+            // Remain in this loop until there is room in the buffer.
+            while(plan_check_full_buffer()) {
+                if(sys.state == STATE_CHECK_MODE)
+                    estimator_execute_block();   // Estimating job time, execute the oldest block in simulated time.
+                else
+                    protocol_auto_cycle_start(); // Auto-cycle start when buffer is full.
+                if(!protocol_execute_realtime()) // Check for any run-time commands
+                    return false;                // Bail, if system abort.
+                protocol_read_ahead();           // Read and filter input lines while waiting.
+            }
+
+            // Plan and queue motion into planner buffer
+            // bool plan_status; // Not used in normal operation.
+            if(!plan_buffer_merged_line()) {
+                plan_buffer_line(target, pl_data);
+                break;
+            }
+        }
+    }
+
+    return !(sys.abort || sys.cancel);
+}
+
+
+// Queues the line held back by the planner for merging, if any. Called when motion has to be
+// executed without waiting for more motions to arrive. Returns false on system abort.
+bool mc_line_flush (void)
+{
+    while(plan_merge_pending()) {
+
         while(plan_check_full_buffer()) {
-            protocol_auto_cycle_start();     // Auto-cycle start when buffer is full.
-            if(!protocol_execute_realtime()) // Check for any run-time commands
-                return false;                // Bail, if system abort.
+            if(sys.state == STATE_CHECK_MODE)
+                estimator_execute_block();
+            else
+                protocol_auto_cycle_start();
+            if(!protocol_execute_realtime())
+                return false;
+            protocol_read_ahead();
         }
 
-        // Plan and queue motion into planner buffer
-        // bool plan_status; // Not used in normal operation.
-        plan_buffer_line(target, pl_data);
+        plan_buffer_merged_line();
     }
 
     return !(sys.abort || sys.cancel);
@@ -303,6 +338,7 @@ status_code_t mc_jog_execute (plan_line_data_t *pl_data, parser_block_t *gc_bloc
 
     // Valid jog command. Plan, set state, and execute.
     mc_line(gc_block->values.xyz, pl_data);
+    mc_line_flush();
     if ((sys.state == STATE_IDLE || sys.state == STATE_TOOL_CHANGE) && plan_get_current_block() != NULL) { // Check if there is a block to execute.
         set_state(STATE_JOG);
         st_prep_buffer();
@@ -318,7 +354,8 @@ void mc_dwell (float seconds)
     if (sys.state != STATE_CHECK_MODE) {
         protocol_buffer_synchronize();
         delay_sec(seconds, DelayMode_Dwell);
-    }
+    } else if(sys.estimate)
+        estimator_dwell(seconds);
 }
 
 
@@ -407,6 +444,7 @@ gc_probe_t mc_probe_cycle (float *target, plan_line_data_t *pl_data, gc_parser_f
 
     // Setup and queue probing motion. Auto cycle-start should not start the cycle.
     mc_line(target, pl_data);
+    mc_line_flush();
 
     // Activate the probing state monitor in the stepper module.
     sys_probe_state = Probe_Active;
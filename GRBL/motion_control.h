@@ -37,6 +37,9 @@
 // (1 minute)/feed_rate time.
 bool mc_line(float *target, plan_line_data_t *pl_data);
 
+// Queues the line held back by the planner for merging with subsequent lines, if any.
+bool mc_line_flush(void);
+
 // Execute an arc in offset mode format. position == current xyz, target == target xyz,
 // offset == offset from current xyz, axis_XXX defines circle plane in tool space, axis_linear is
 // the direction of helical travel, radius == circle radius, is_clockwise_arc boolean. Used
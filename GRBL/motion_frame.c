@@ -0,0 +1,247 @@
+/*
+  motion_frame.c - binary framed motion protocol, frame encoding and decoding
+
+  Part of Grbl
+
+  Copyright (c) 2019 Terje Io
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include "motion_frame.h"
+
+static const char *base64 = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// CRC-16/CCITT-FALSE (polynomial 0x1021) computed a byte at a time, entries are the CRC of each byte value.
+static const uint16_t crc_table[256] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0
+};
+
+uint16_t motion_frame_crc (const uint8_t *data, uint_fast8_t length)
+{
+    uint16_t crc = 0xFFFF;
+
+    while(length--)
+        crc = (crc << 8) ^ crc_table[(crc >> 8) ^ *data++];
+
+    return crc;
+}
+
+static uint8_t *put_value (uint8_t *data, uint32_t value, uint_fast8_t bytes)
+{
+    while(bytes--) {
+        *data++ = (uint8_t)value;
+        value >>= 8;
+    }
+
+    return data;
+}
+
+static uint8_t *put_float (uint8_t *data, float value)
+{
+    uint32_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+
+    return put_value(data, bits, 4);
+}
+
+static uint32_t get_value (const uint8_t **data, uint_fast8_t bytes)
+{
+    uint32_t value = 0;
+    uint_fast8_t shift = 0;
+
+    while(bytes--) {
+        value |= (uint32_t)*(*data)++ << shift;
+        shift += 8;
+    }
+
+    return value;
+}
+
+static float get_float (const uint8_t **data)
+{
+    float value;
+    uint32_t bits = get_value(data, 4);
+
+    memcpy(&value, &bits, sizeof(value));
+
+    return value;
+}
+
+uint_fast8_t motion_frame_encode (const motion_frame_t *frame, char *line)
+{
+    uint8_t data[MOTION_FRAME_MAX_SIZE], *end = data;
+    uint_fast8_t idx;
+
+    *end++ = (uint8_t)frame->type;
+    *end++ = frame->axes;
+    *end++ = frame->flags.value;
+
+    if(frame->flags.line_number)
+        end = put_value(end, (uint32_t)frame->line_number, 4);
+
+    for(idx = 0; idx < MOTION_FRAME_MAX_AXES; idx++) {
+        if(frame->axes & (1 << idx))
+            end = put_float(end, frame->target[idx]);
+    }
+
+    if(frame->flags.feed_rate)
+        end = put_float(end, frame->feed_rate);
+
+    if(frame->flags.rpm)
+        end = put_float(end, frame->rpm);
+
+    if(frame->type == MotionFrame_CwArc || frame->type == MotionFrame_CcwArc) {
+        end = put_float(end, frame->offset[0]);
+        end = put_float(end, frame->offset[1]);
+    }
+
+    end = put_value(end, motion_frame_crc(data, end - data), 2);
+
+    return motion_frame_base64_encode(data, end - data, line);
+}
+
+uint_fast8_t motion_frame_base64_encode (const uint8_t *data, uint_fast8_t length, char *line)
+{
+    uint_fast8_t idx;
+    uint32_t value;
+    char *s = line;
+
+    for(idx = 0; idx < length; idx += 3) {
+        value = (uint32_t)data[idx] << 16;
+        if(idx + 1 < length)
+            value |= (uint32_t)data[idx + 1] << 8;
+        if(idx + 2 < length)
+            value |= data[idx + 2];
+        *s++ = base64[(value >> 18) & 0x3F];
+        *s++ = base64[(value >> 12) & 0x3F];
+        *s++ = idx + 1 < length ? base64[(value >> 6) & 0x3F] : '=';
+        *s++ = idx + 2 < length ? base64[value & 0x3F] : '=';
+    }
+    *s = '\0';
+
+    return s - line;
+}
+
+bool motion_frame_decode (const char *line, motion_frame_t *frame)
+{
+    char c;
+    const uint8_t *data;
+    uint8_t buffer[MOTION_FRAME_MAX_SIZE];
+    uint_fast8_t idx, bits = 0, length = 0, size;
+    uint32_t value = 0;
+
+    while((c = *line++) && c != '=') {
+        if(c >= 'A' && c <= 'Z')
+            c = c - 'A';
+        else if(c >= 'a' && c <= 'z')
+            c = c - 'a' + 26;
+        else if(c >= '0' && c <= '9')
+            c = c - '0' + 52;
+        else if(c == '+')
+            c = 62;
+        else if(c == '/')
+            c = 63;
+        else
+            return false;
+
+        value = (value << 6) | c;
+        if((bits += 6) >= 8) {
+            bits -= 8;
+            if(length == MOTION_FRAME_MAX_SIZE)
+                return false;
+            buffer[length++] = (uint8_t)(value >> bits);
+        }
+    }
+
+    while(c == '=') // Only padding may follow
+        c = *line++;
+
+    if(c != '\0' || length < 5 || motion_frame_crc(buffer, length - 2) != (buffer[length - 2] | (buffer[length - 1] << 8)))
+        return false;
+
+    memset(frame, 0, sizeof(motion_frame_t));
+
+    data = buffer;
+    frame->type = (motion_frame_type_t)*data++;
+    frame->axes = *data++;
+    frame->flags.value = *data++;
+
+    // Check that the length matches the content before extracting values.
+    size = 3 + 2 + (frame->flags.line_number ? 4 : 0) + (frame->flags.feed_rate ? 4 : 0) + (frame->flags.rpm ? 4 : 0);
+    for(idx = 0; idx < MOTION_FRAME_MAX_AXES; idx++) {
+        if(frame->axes & (1 << idx))
+            size += 4;
+    }
+    if(frame->type == MotionFrame_CwArc || frame->type == MotionFrame_CcwArc)
+        size += 2 * 4;
+
+    if(size != length || frame->type > MotionFrame_CcwArc || frame->flags.unassigned || (frame->axes >> MOTION_FRAME_MAX_AXES))
+        return false;
+
+    if(frame->flags.line_number)
+        frame->line_number = (int32_t)get_value(&data, 4);
+
+    for(idx = 0; idx < MOTION_FRAME_MAX_AXES; idx++) {
+        if(frame->axes & (1 << idx))
+            frame->target[idx] = get_float(&data);
+    }
+
+    if(frame->flags.feed_rate)
+        frame->feed_rate = get_float(&data);
+
+    if(frame->flags.rpm)
+        frame->rpm = get_float(&data);
+
+    if(frame->type == MotionFrame_CwArc || frame->type == MotionFrame_CcwArc) {
+        frame->offset[0] = get_float(&data);
+        frame->offset[1] = get_float(&data);
+    }
+
+    return true;
+}
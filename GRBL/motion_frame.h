@@ -0,0 +1,99 @@
+/*
+  motion_frame.h - binary framed motion protocol, frame layout shared with host side encoders
+
+  Part of Grbl
+
+  Copyright (c) 2019 Terje Io
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  A frame carries one pre-parsed motion. It is sent as a line of base64 encoded bytes terminated by
+  a LF or CR, after the CMD_MOTION_FRAMES realtime command has switched the input stream to frames.
+  Each frame is acknowledged with ok or error:<n> as a G-code line is.
+
+  Frame layout, multi byte values are little endian, floats are IEEE 754 single precision:
+
+    uint8_t  type           motion_frame_type_t
+    uint8_t  axes           Bit mask of axes with a target value, bit 0 is X
+    uint8_t  flags          motion_frame_flags_t
+    int32_t  line_number    If flags.line_number is set
+    float    target[]       Absolute work coordinate (mm), one for each bit set in axes, X first
+    float    feed_rate      mm/min, if flags.feed_rate is set
+    float    rpm            Spindle speed, if flags.rpm is set
+    float    offset[2]      Arc center offset (mm) from the current position for the first and second
+                            axis of the selected plane (G17: X, Y, G18: Z, X, G19: Y, Z), arcs only
+    uint16_t crc            CRC-16/CCITT-FALSE of all the preceding bytes
+
+  A frame of type MotionFrame_End switches the stream back to G-code, any values it carries are ignored.
+
+  motion_frame.h and motion_frame.c only depend on the standard C library and may be used as is by
+  host side senders for encoding frames.
+*/
+
+#ifndef motion_frame_h
+#define motion_frame_h
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define MOTION_FRAME_MAX_AXES 6
+#define MOTION_FRAME_MAX_SIZE (3 + 4 + MOTION_FRAME_MAX_AXES * 4 + 4 + 4 + 2 * 4 + 2)   // Bytes
+#define MOTION_FRAME_MAX_LENGTH (((MOTION_FRAME_MAX_SIZE + 2) / 3) * 4)                 // Base64 encoded characters
+
+typedef enum {
+    MotionFrame_End = 0,
+    MotionFrame_Linear = 1,   // G1
+    MotionFrame_Seek = 2,     // G0
+    MotionFrame_CwArc = 3,    // G2
+    MotionFrame_CcwArc = 4    // G3
+} motion_frame_type_t;
+
+typedef union {
+    uint8_t value;
+    struct {
+        uint8_t line_number :1,
+                feed_rate   :1,
+                rpm         :1,
+                unassigned  :5;
+    };
+} motion_frame_flags_t;
+
+typedef struct {
+    motion_frame_type_t type;
+    uint8_t axes;
+    motion_frame_flags_t flags;
+    int32_t line_number;
+    float target[MOTION_FRAME_MAX_AXES];    // Values for axes not in the axes bit mask are not used
+    float feed_rate;
+    float rpm;
+    float offset[2];
+} motion_frame_t;
+
+// Computes the CRC-16/CCITT-FALSE checksum of a frame.
+uint16_t motion_frame_crc (const uint8_t *data, uint_fast8_t length);
+
+// Encodes a frame as a 0-terminated base64 string, line must have room for MOTION_FRAME_MAX_LENGTH + 1 characters.
+// Returns the string length.
+uint_fast8_t motion_frame_encode (const motion_frame_t *frame, char *line);
+
+// Encodes length bytes as a 0-terminated base64 string, line must have room for ((length + 2) / 3) * 4 + 1 characters.
+// Returns the string length. Used for encoding status frames as well.
+uint_fast8_t motion_frame_base64_encode (const uint8_t *data, uint_fast8_t length, char *line);
+
+// Decodes a base64 encoded frame, returns false if the frame is malformed or fails the checksum.
+bool motion_frame_decode (const char *line, motion_frame_t *frame);
+
+#endif
@@ -23,27 +23,205 @@
 
 #include "grbl.h"
 
-static plan_block_t block_buffer[BLOCK_BUFFER_SIZE];    // A ring buffer for motion instructions
+static plan_block_t block_buffer_default[BLOCK_BUFFER_SIZE]; // Default size ring buffer, statically allocated
+static plan_block_t *block_buffer = NULL;               // A ring buffer for motion instructions, allocated at startup if larger than default
+static uint_fast8_t block_buffer_size;                  // Number of blocks in the ring buffer
 static uint_fast8_t block_buffer_tail;                  // Index of the block to process now
 static uint_fast8_t block_buffer_head;                  // Index of the next block to be pushed
 static uint_fast8_t next_buffer_head;                   // Index of the next buffer head
 static uint_fast8_t block_buffer_planned;               // Index of the optimally planned block
+static uint32_t override_epoch = 0;                     // Incremented on feed and rapid override changes
+static bool replan = false;                             // Override changed, buffer to be replanned from the tail
 
 static planner_t pl;
 
+// Line held back for merging with subsequent collinear lines
+typedef struct {
+    uint_fast8_t points;                        // Number of end points merged, 0 if no line is held back
+    float start[N_AXIS];                        // Start position of line
+    float target[N_AXIS];                       // End position of last merged line
+    float point[LINE_MERGE_MAX - 1][N_AXIS];    // End positions of merged lines except the last
+    plan_line_data_t data;
+} plan_merge_t;
+
+static plan_merge_t merge;
+
+// Blend replacing the corner at the end of the line held back (G64)
+typedef struct {
+    uint_fast8_t segments;      // Number of segments of blend arc, 0 if no blend pending
+    uint_fast8_t segment;       // Number of segments queued
+    float angle;                // Turn angle
+    float start[N_AXIS];        // Start of blend arc, tangent point on the line held back
+    float end[N_AXIS];          // End of blend arc, tangent point on the next line
+    float center[N_AXIS];       // Center of blend arc
+    float radial[N_AXIS];       // Vector from center to start of blend arc
+    float tangent[N_AXIS];      // Direction of the line held back scaled by the blend arc radius
+    plan_line_data_t data;
+} plan_blend_t;
+
+static plan_blend_t blend;
+
+// Discards any line held back for merging and pending blend
+static void plan_merge_discard ()
+{
+    if(merge.points && merge.data.message) {
+        free(merge.data.message);
+        merge.data.message = NULL;
+    }
+    merge.points = blend.segments = 0;
+}
+
 // Returns the index of the next block in the ring buffer. Also called by stepper segment buffer.
 inline static uint_fast8_t plan_next_block_index (uint_fast8_t block_index)
 {
-    return block_index == (BLOCK_BUFFER_SIZE - 1) ? 0 : block_index + 1;
+    return block_index == (block_buffer_size - 1) ? 0 : block_index + 1;
 }
 
 
 // Returns the index of the previous block in the ring buffer
 inline static uint_fast8_t plan_prev_block_index (uint_fast8_t block_index)
 {
-    return block_index == 0 ? (BLOCK_BUFFER_SIZE - 1) : block_index - 1;
+    return block_index == 0 ? (block_buffer_size - 1) : block_index - 1;
+}
+
+
+/*                        JERK LIMITED (S-CURVE) SPEED RAMPS
+
+  When jerk is limited a speed change is executed as a symmetric seven-segment ramp: acceleration
+  increases linearly to the block acceleration, is held, and then decreases linearly to zero. The
+  average speed of a symmetric ramp is the mean of its start and end speeds, the distance covered is
+  thus the ramp time multiplied by that. With jerk_speed = acceleration^2/jerk being the speed change
+  during the two jerk phases the ramp time for a speed change dv is:
+
+    dv >= jerk_speed: (dv + jerk_speed) / acceleration   (full acceleration is reached)
+    dv <  jerk_speed: 2 * sqrt(dv / jerk)                (triangular acceleration)
+
+  The planner use these relations instead of v^2 = u^2 + 2as so that every planned junction speed can
+  be reached under the jerk limit. The segment generator then executes each ramp over the planned
+  distance, any slack lowers the peak acceleration of the ramp.
+  NOTE: Acceleration is zero at ramp ends, ramps do not extend across blocks. Sequences of very short
+        blocks would be planned at lower speeds than with trapezoidal profiles. Jerk is therefore not
+        limited for blocks too short to reach their programmed rate from standstill, acceleration may
+        change stepwise at junctions to and from these blocks.
+*/
+
+// Returns the distance required to change speed between the given speeds.
+float plan_ramp_distance (plan_block_t *block, float speed, float target_speed)
+{
+    float dv = fabsf(target_speed - speed);
+
+    if (block->jerk == 0.0f)
+        return dv * (speed + target_speed) / (2.0f * block->acceleration);
+
+    return dv >= block->jerk_speed
+            ? (speed + target_speed) * (dv + block->jerk_speed) / (2.0f * block->acceleration)
+            : (speed + target_speed) * sqrtf(dv / block->jerk);
+}
+
+// Returns the maximum speed squared reachable from speed over distance. Symmetric, the same
+// value is the maximum entry speed squared when decelerating to speed over distance.
+float plan_ramp_max_speed_sqr (plan_block_t *block, float speed_sqr, float distance)
+{
+    if (block->jerk == 0.0f)
+        return speed_sqr + 2.0f * block->acceleration * distance;
+
+    float speed = sqrtf(speed_sqr);
+
+    if (distance * block->jerk >= (2.0f * speed + block->jerk_speed) * block->acceleration) {
+        // Full acceleration is reached, solve (2v + dv)(dv + jerk_speed) = 2as for end speed.
+        float k = 2.0f * speed - block->jerk_speed;
+        speed = 0.5f * (sqrtf(k * k + 8.0f * block->acceleration * distance) - block->jerk_speed);
+    } else if (speed > 0.0f) {
+        // Triangular acceleration, solve x^3 + 2vx - s * sqrt(jerk) = 0 for x = sqrt(dv).
+        // Hyperbolic form of the single real root, numerically stable for small distances.
+        float p = 2.0f * speed, r = sqrtf(p / 3.0f);
+        float x = 2.0f * r * sinhf(asinhf(1.5f * distance * sqrtf(block->jerk) / (p * r)) / 3.0f);
+        speed += x * x;
+    } else
+        speed = cbrtf(distance * distance * block->jerk);
+
+    return speed * speed;
 }
 
+#ifdef PLANNER_FIXED_POINT
+
+/*                              FIXED POINT PLANNING
+
+  On targets without a FPU the reverse and forward passes of planner_recalculate() plan entry speeds
+  squared as unsigned integers in units of PLANNER_FX_UNIT (mm/min)^2, values saturate at UINT32_MAX.
+  For trapezoidal ramps the maximum speed squared reachable over a block is then an integer addition
+  of 2 * acceleration * distance, precomputed when the block is added. Jerk limited ramps fall back
+  to the float computation. The passes only write the fixed point entry speed, it is converted to
+  float when the segment generator loads the block and when it reads the exit speed of the executing
+  block. The segment generator updates both when it changes the entry speed of the executing block,
+  whose remaining distance it also updates, the ramp of it is recomputed before the forward pass.
+*/
+
+typedef uint32_t plan_speed_sqr_t;
+
+inline plan_speed_sqr_t plan_fx (float speed_sqr)
+{
+    return speed_sqr >= (float)UINT32_MAX * PLANNER_FX_UNIT ? UINT32_MAX : (uint32_t)(speed_sqr * (1.0f / PLANNER_FX_UNIT));
+}
+
+inline static plan_speed_sqr_t plan_get_entry_speed_sqr (plan_block_t *block)
+{
+    return block->entry_speed_sqr_fx;
+}
+
+inline static void plan_set_entry_speed_sqr (plan_block_t *block, plan_speed_sqr_t speed_sqr)
+{
+    block->entry_speed_sqr_fx = speed_sqr;
+}
+
+inline static plan_speed_sqr_t plan_get_max_entry_speed_sqr (plan_block_t *block)
+{
+    return block->max_entry_speed_sqr_fx;
+}
+
+// Returns the maximum speed squared reachable from speed over the block.
+static plan_speed_sqr_t plan_ramp_speed_sqr (plan_block_t *block, plan_speed_sqr_t speed_sqr)
+{
+    if (block->jerk > 0.0f)
+        return plan_fx(plan_ramp_max_speed_sqr(block, plan_fx_to_float(speed_sqr), block->millimeters));
+
+    plan_speed_sqr_t ramp_speed_sqr = speed_sqr + block->ramp_speed_sqr_fx;
+
+    return ramp_speed_sqr < speed_sqr ? UINT32_MAX : ramp_speed_sqr;
+}
+
+// Recomputes the ramp of the executing block from the remaining distance updated by the segment generator.
+static void plan_fx_reload (plan_block_t *block)
+{
+    block->ramp_speed_sqr_fx = plan_fx(2.0f * block->acceleration * block->millimeters);
+}
+
+#else
+
+typedef float plan_speed_sqr_t;
+
+inline static plan_speed_sqr_t plan_get_entry_speed_sqr (plan_block_t *block)
+{
+    return block->entry_speed_sqr;
+}
+
+inline static void plan_set_entry_speed_sqr (plan_block_t *block, plan_speed_sqr_t speed_sqr)
+{
+    block->entry_speed_sqr = speed_sqr;
+}
+
+inline static plan_speed_sqr_t plan_get_max_entry_speed_sqr (plan_block_t *block)
+{
+    return block->max_entry_speed_sqr;
+}
+
+inline static plan_speed_sqr_t plan_ramp_speed_sqr (plan_block_t *block, plan_speed_sqr_t speed_sqr)
+{
+    return plan_ramp_max_speed_sqr(block, speed_sqr, block->millimeters);
+}
+
+#endif
+
 
 /*                            PLANNER SPEED DEFINITION
                                      +--------+   <- current->nominal_speed
@@ -110,10 +288,15 @@ inline static uint_fast8_t plan_prev_block_index (uint_fast8_t block_index)
   look-ahead blocks numbering up to a hundred or more.
 
 */
+static void plan_update_max_entry_speed (uint_fast8_t block_index);
+
 static void planner_recalculate ()
 {
     // Initialize block index to the last block in the planner buffer.
     uint_fast8_t block_index = plan_prev_block_index(block_buffer_head);
+    bool refresh = replan;
+
+    replan = false;
 
     // Bail. Can't do anything with one only one plan-able block.
     if (block_index == block_buffer_planned)
@@ -122,12 +305,16 @@ static void planner_recalculate ()
     // Reverse Pass: Coarsely maximize all possible deceleration curves back-planning from the last
     // block in buffer. Cease planning when the last optimal planned or tail pointer is reached.
     // NOTE: Forward pass will later refine and correct the reverse pass to create an optimal plan.
-    float entry_speed_sqr;
+    plan_speed_sqr_t entry_speed_sqr;
     plan_block_t *next;
     plan_block_t *current = &block_buffer[block_index];
 
+    // After an override change max entry speeds are updated as the reverse pass reaches the blocks.
+    if (refresh)
+        plan_update_max_entry_speed(block_index);
+
     // Calculate maximum entry speed for last block in buffer, where the exit speed is always zero.
-    current->entry_speed_sqr = min(current->max_entry_speed_sqr, 2.0f * current->acceleration * current->millimeters);
+    plan_set_entry_speed_sqr(current, min(plan_get_max_entry_speed_sqr(current), plan_ramp_speed_sqr(current, 0)));
 
     block_index = plan_prev_block_index(block_index);
     if (block_index == block_buffer_planned) { // Only two plannable blocks in buffer. Reverse pass complete.
@@ -138,6 +325,8 @@ static void planner_recalculate ()
 
         next = current;
         current = &block_buffer[block_index];
+        if (refresh)
+            plan_update_max_entry_speed(block_index);
         block_index = plan_prev_block_index(block_index);
 
         // Check if next block is the tail block(=planned block). If so, update current stepper parameters.
@@ -145,12 +334,17 @@ static void planner_recalculate ()
             st_update_plan_block_parameters();
 
         // Compute maximum entry speed decelerating over the current block from its exit speed.
-        if (current->entry_speed_sqr != current->max_entry_speed_sqr) {
-            entry_speed_sqr = next->entry_speed_sqr + 2.0f * current->acceleration * current->millimeters;
-            current->entry_speed_sqr = entry_speed_sqr < current->max_entry_speed_sqr ? entry_speed_sqr : current->max_entry_speed_sqr;
+        if (plan_get_entry_speed_sqr(current) != plan_get_max_entry_speed_sqr(current)) {
+            entry_speed_sqr = plan_ramp_speed_sqr(current, plan_get_entry_speed_sqr(next));
+            plan_set_entry_speed_sqr(current, entry_speed_sqr < plan_get_max_entry_speed_sqr(current) ? entry_speed_sqr : plan_get_max_entry_speed_sqr(current));
         }
     }
 
+  #ifdef PLANNER_FIXED_POINT
+    if (block_buffer_planned == block_buffer_tail)
+        plan_fx_reload(&block_buffer[block_buffer_tail]);
+  #endif
+
     // Forward Pass: Forward plan the acceleration curve from the planned pointer onward.
     // Also scans for optimal plan breakpoints and appropriately updates the planned pointer.
     next = &block_buffer[block_buffer_planned]; // Begin at buffer planned pointer
@@ -164,11 +358,11 @@ static void planner_recalculate ()
         // Any acceleration detected in the forward pass automatically moves the optimal planned
         // pointer forward, since everything before this is all optimal. In other words, nothing
         // can improve the plan from the buffer tail to the planned pointer by logic.
-        if (current->entry_speed_sqr < next->entry_speed_sqr) {
-            entry_speed_sqr = current->entry_speed_sqr + 2.0f * current->acceleration * current->millimeters;
+        if (plan_get_entry_speed_sqr(current) < plan_get_entry_speed_sqr(next)) {
+            entry_speed_sqr = plan_ramp_speed_sqr(current, plan_get_entry_speed_sqr(current));
         // If true, current block is full-acceleration and we can move the planned pointer forward.
-            if (entry_speed_sqr < next->entry_speed_sqr) {
-                next->entry_speed_sqr = entry_speed_sqr; // Always <= max_entry_speed_sqr. Backward pass sets this.
+            if (entry_speed_sqr < plan_get_entry_speed_sqr(next)) {
+                plan_set_entry_speed_sqr(next, entry_speed_sqr); // Always <= max_entry_speed_sqr. Backward pass sets this.
                 block_buffer_planned = block_index; // Set optimal plan pointer.
             }
         }
@@ -177,7 +371,7 @@ static void planner_recalculate ()
         // point in the buffer. When the plan is bracketed by either the beginning of the
         // buffer and a maximum entry speed or two maximum entry speeds, every block in between
         // cannot logically be further improved. Hence, we don't have to recompute them anymore.
-        if (next->entry_speed_sqr == next->max_entry_speed_sqr)
+        if (plan_get_entry_speed_sqr(next) == plan_get_max_entry_speed_sqr(next))
             block_buffer_planned = block_index;
 
         block_index = plan_next_block_index(block_index);
@@ -187,12 +381,18 @@ static void planner_recalculate ()
 
 inline static void plan_reset_buffer (bool soft_reset)
 {
-    if((block_buffer_tail = soft_reset ? BLOCK_BUFFER_SIZE : 0))
-      do { // Free memory for any pending messages after soft reset
+    if((block_buffer_tail = soft_reset ? block_buffer_size : 0))
+      do { // Free memory for any pending messages and rasters after soft reset
         if(block_buffer[--block_buffer_tail].message) {
             free(block_buffer[block_buffer_tail].message);
             block_buffer[block_buffer_tail].message = NULL;
         }
+      #ifdef LASER_RASTER
+        if(block_buffer[block_buffer_tail].raster) {
+            free(block_buffer[block_buffer_tail].raster);
+            block_buffer[block_buffer_tail].raster = NULL;
+        }
+      #endif
     } while(block_buffer_tail);
     block_buffer_head = 0;      // Empty = tail
     next_buffer_head = 1;       // plan_next_block_index(block_buffer_head)
@@ -200,10 +400,36 @@ inline static void plan_reset_buffer (bool soft_reset)
 }
 
 
+// Allocates the planner ring buffer, called once at startup before plan_reset(). Up to BLOCK_BUFFER_SIZE
+// blocks the static buffer is used, the heap only for larger sizes as many driver projects have a small heap.
+// Returns false if not enough memory is available for the requested number of blocks.
+bool plan_alloc_buffer (uint_fast8_t blocks)
+{
+    plan_block_t *buffer;
+
+    if(blocks < PLANNER_BUFFER_MIN)
+        return false;
+
+    if(blocks <= BLOCK_BUFFER_SIZE)
+        buffer = block_buffer_default;
+    else if((buffer = calloc(blocks, sizeof(plan_block_t))) == NULL)
+        return false;
+
+    if(block_buffer && block_buffer != block_buffer_default)
+        free(block_buffer);
+
+    block_buffer = buffer;
+    block_buffer_size = blocks;
+
+    return true;
+}
+
+
 void plan_reset ()
 {
     static bool soft_reset = false;
     memset(&pl, 0, sizeof(planner_t)); // Clear planner struct
+    plan_merge_discard();
     plan_reset_buffer(soft_reset);
     soft_reset = true;
 }
@@ -217,6 +443,12 @@ void plan_discard_current_block ()
             free(block_buffer[block_buffer_tail].message);
             block_buffer[block_buffer_tail].message = NULL;
         }
+      #ifdef LASER_RASTER
+        if(block_buffer[block_buffer_tail].raster) {
+            free(block_buffer[block_buffer_tail].raster);
+            block_buffer[block_buffer_tail].raster = NULL;
+        }
+      #endif
         // Push block_buffer_planned pointer, if encountered.
         if (block_buffer_tail == block_buffer_planned)
             block_buffer_planned = block_index;
@@ -242,7 +474,11 @@ plan_block_t *plan_get_current_block ()
 inline float plan_get_exec_block_exit_speed_sqr ()
 {
     uint_fast8_t block_index = plan_next_block_index(block_buffer_tail);
+  #ifdef PLANNER_FIXED_POINT
+    return block_index == block_buffer_head ? 0.0f : plan_fx_to_float(block_buffer[block_index].entry_speed_sqr_fx);
+  #else
     return block_index == block_buffer_head ? 0.0f : block_buffer[block_index].entry_speed_sqr;
+  #endif
 }
 
 
@@ -255,7 +491,7 @@ bool plan_check_full_buffer ()
 
 // Computes and returns block nominal speed based on running condition and override values.
 // NOTE: All system motion commands, such as homing/parking, are not subject to overrides.
-float plan_compute_profile_nominal_speed (plan_block_t *block)
+static float plan_compute_nominal_speed (plan_block_t *block)
 {
     float nominal_speed = block->condition.spindle.synchronized ? block->programmed_rate * hal.spindle_get_data(SpindleData_RPM).rpm : block->programmed_rate;
 
@@ -281,22 +517,47 @@ inline static float plan_compute_profile_parameters (plan_block_t *block, float
     block->max_entry_speed_sqr = nominal_speed > prev_nominal_speed ? (prev_nominal_speed * prev_nominal_speed) : (nominal_speed * nominal_speed);
     if (block->max_entry_speed_sqr > block->max_junction_speed_sqr)
         block->max_entry_speed_sqr = block->max_junction_speed_sqr;
+  #ifdef PLANNER_FIXED_POINT
+    block->max_entry_speed_sqr_fx = plan_fx(block->max_entry_speed_sqr);
+  #endif
     return nominal_speed;
 }
 
-// Re-calculates buffered motions profile parameters upon a motion-based override change.
-void plan_update_velocity_profile_parameters ()
+// Returns block nominal speed, recomputed only when overrides have changed since last called for the block.
+// NOTE: Spindle synchronized motion depends on actual spindle speed and is always recomputed.
+float plan_compute_profile_nominal_speed (plan_block_t *block)
 {
-    uint_fast8_t block_index = block_buffer_tail;
-    plan_block_t *block;
-    float prev_nominal_speed = SOME_LARGE_VALUE; // Set high for first block nominal speed calculation.
-
-    while (block_index != block_buffer_head) {
-        block = &block_buffer[block_index];
-        prev_nominal_speed = plan_compute_profile_parameters(block, plan_compute_profile_nominal_speed(block), prev_nominal_speed);
-        block_index = plan_next_block_index(block_index);
+    if (block->override_epoch != override_epoch || block->condition.spindle.synchronized) {
+        block->nominal_speed = plan_compute_nominal_speed(block);
+        block->override_epoch = override_epoch;
     }
-    pl.previous_nominal_speed = prev_nominal_speed; // Update prev nominal speed for next incoming block.
+
+    return block->nominal_speed;
+}
+
+
+// Updates the max entry speed of a queued block, other than the tail, from the current nominal speeds.
+static void plan_update_max_entry_speed (uint_fast8_t block_index)
+{
+    plan_compute_profile_parameters(&block_buffer[block_index], plan_compute_profile_nominal_speed(&block_buffer[block_index]),
+                                     plan_compute_profile_nominal_speed(&block_buffer[plan_prev_block_index(block_index)]));
+}
+
+
+// Returns the jerk limit along the unit vector, axes with no jerk limit set does not constrain it.
+// Returns 0 if no axis in motion is jerk limited.
+static float plan_limit_jerk_by_axis_maximum (float *unit_vec)
+{
+    uint_fast8_t idx = N_AXIS;
+    float limit_value = SOME_LARGE_VALUE;
+
+    do {
+        idx--;
+        if (unit_vec[idx] != 0.0f && settings.jerk[idx] > 0.0f)
+            limit_value = min(limit_value, fabsf(settings.jerk[idx] / unit_vec[idx]));
+    } while(idx);
+
+    return limit_value == SOME_LARGE_VALUE ? 0.0f : limit_value;
 }
 
 
@@ -384,6 +645,10 @@ bool plan_buffer_line (float *target, plan_line_data_t *pl_data)
         return false;
 
     pl_data->message = NULL; // Indicate message is queued for display on execution
+#ifdef LASER_RASTER
+    block->raster = pl_data->raster; // and raster queued for output
+    pl_data->raster = NULL;
+#endif
 
     // Calculate the unit vector of the line move and the block maximum feed rate and acceleration scaled
     // down such that no individual axes maximum values are exceeded with respect to the line direction.
@@ -392,6 +657,9 @@ bool plan_buffer_line (float *target, plan_line_data_t *pl_data)
     block->millimeters = convert_delta_vector_to_unit_vector(unit_vec);
     block->acceleration = limit_value_by_axis_maximum(settings.acceleration, unit_vec);
     block->rapid_rate = limit_value_by_axis_maximum(settings.max_rate, unit_vec);
+  #ifdef PLANNER_FIXED_POINT
+    block->ramp_speed_sqr_fx = plan_fx(2.0f * block->acceleration * block->millimeters);
+  #endif
 
     // Store programmed rate.
     if (block->condition.rapid_motion)
@@ -402,6 +670,14 @@ bool plan_buffer_line (float *target, plan_line_data_t *pl_data)
             block->programmed_rate *= block->millimeters;
     }
 
+    // Jerk is only limited for blocks long enough to reach the programmed rate from standstill, shorter
+    // blocks are planned with trapezoidal profiles. See the note on jerk limited ramps above.
+    if ((block->jerk = plan_limit_jerk_by_axis_maximum(unit_vec)) > 0.0f) {
+        block->jerk_speed = block->acceleration * block->acceleration / block->jerk;
+        if (plan_ramp_distance(block, 0.0f, min(block->programmed_rate, block->rapid_rate)) > block->millimeters)
+            block->jerk = 0.0f;
+    }
+
     // TODO: Need to check this method handling zero junction speeds when starting from rest.
     if ((block_buffer_head == block_buffer_tail) || (block->condition.system_motion)) {
 
@@ -460,10 +736,16 @@ bool plan_buffer_line (float *target, plan_line_data_t *pl_data)
         }
     }
 
+    block->nominal_speed = plan_compute_nominal_speed(block);
+    block->override_epoch = override_epoch;
+
     // Block system motion from updating this data to ensure next g-code motion is computed correctly.
     if (!block->condition.system_motion) {
 
-        pl.previous_nominal_speed = plan_compute_profile_parameters(block, plan_compute_profile_nominal_speed(block), pl.previous_nominal_speed);
+        // Max entry speed is zero when starting from rest, the previous nominal speed is then irrelevant.
+        plan_compute_profile_parameters(block, block->nominal_speed, block_buffer_head == block_buffer_tail
+                                         ? SOME_LARGE_VALUE
+                                         : plan_compute_profile_nominal_speed(&block_buffer[plan_prev_block_index(block_buffer_head)]));
 
         // Update previous path unit_vector and planner position.
         memcpy(pl.previous_unit_vec, unit_vec, sizeof(unit_vec)); // pl.previous_unit_vec[] = unit_vec[]
@@ -481,9 +763,252 @@ bool plan_buffer_line (float *target, plan_line_data_t *pl_data)
 }
 
 
+/*                            COLLINEAR LINE MERGING
+
+  When settings.line_merge_tolerance is non-zero consecutive lines are merged into a single block as
+  long as none of the end points of the merged lines deviates more than the tolerance from the chord
+  from the start of the first line to the end of the last. Merging requires identical conditions
+  (rapid/feed, spindle and coolant state), feed rate and spindle RPM, up to LINE_MERGE_MAX lines are
+  merged into a block. The last line added is held back until a line that cannot be merged is added,
+  the planner is about to run empty or the buffer is synchronized. This increases the look-ahead
+  distance for programs made up of many short segments without increasing the buffer size.
+  NOTE: The merged block reports the line number of the last merged line.
+
+                              PATH BLENDING (G64 P-)
+
+  In G64 mode the line held back is also used for corner rounding. When the next line does not merge
+  with it the corner between them is replaced by an arc tangent to both lines, passing the corner at
+  the path tolerance distance. The arc radius is reduced if needed to keep the arc within the length
+  of the line held back and half the length of the next line. The arc is traced by line segments in
+  the same way as G2/G3 arcs, with the feed rate limited such that the centripetal acceleration does
+  not exceed the acceleration limit in its direction at the middle of the arc.
+  Junctions where the arc would pass less than twice the arc tolerance from the corner, reversals and
+  rapid motions are left to the junction speed limit as in G61 mode.
+*/
+
+// Returns true if a line can be merged with other lines
+inline static bool plan_line_is_mergeable (plan_line_data_t *pl_data)
+{
+    return !(pl_data->condition.system_motion || pl_data->condition.inverse_time ||
+              pl_data->condition.is_rpm_pos_adjusted || pl_data->condition.spindle.synchronized
+#ifdef LASER_RASTER
+               || pl_data->raster
+#endif
+            );
+}
+
+// Returns true if a line can be blended with other lines
+inline static bool plan_line_is_blendable (plan_line_data_t *pl_data)
+{
+    return pl_data->path_tolerance > 0.0f && !pl_data->condition.rapid_motion;
+}
+
+// Returns true if all the end points held back and the end of the held back line are within
+// tolerance of the chord from start to target and in the same order along it.
+static bool plan_merge_fits (float *target)
+{
+    uint_fast8_t idx, point;
+    float chord[N_AXIS], chord_sqr = 0.0f, tolerance_sqr = settings.line_merge_tolerance * settings.line_merge_tolerance;
+    float offset[N_AXIS], *end, dot, dist_sqr, last_dot = 0.0f;
+
+    idx = N_AXIS;
+    do {
+        idx--;
+        chord[idx] = target[idx] - merge.start[idx];
+        chord_sqr += chord[idx] * chord[idx];
+    } while(idx);
+
+    if(chord_sqr == 0.0f)
+        return false;
+
+    for(point = 0; point < merge.points; point++) {
+
+        end = point == merge.points - 1 ? merge.target : merge.point[point];
+        dot = dist_sqr = 0.0f;
+
+        idx = N_AXIS;
+        do {
+            idx--;
+            offset[idx] = end[idx] - merge.start[idx];
+            dot += offset[idx] * chord[idx];
+            dist_sqr += offset[idx] * offset[idx];
+        } while(idx);
+
+        // Reject if going backwards along the chord or passing its end.
+        if(dot <= last_dot || dot >= chord_sqr)
+            return false;
+
+        if(dist_sqr - dot * dot / chord_sqr > tolerance_sqr)
+            return false;
+
+        last_dot = dot;
+    }
+
+    return true;
+}
+
+// Sets up a blend for the corner between the line held back and the next line.
+static void plan_blend_corner (float *target, plan_line_data_t *pl_data)
+{
+    uint_fast8_t idx = N_AXIS;
+    float in[N_AXIS], out[N_AXIS], in_length = 0.0f, out_length = 0.0f, cos_theta = 0.0f;
+    float sin_theta_d2, cos_theta_d2, tan_theta_d2, distance, radius;
+
+    do {
+        idx--;
+        in[idx] = merge.target[idx] - merge.start[idx];
+        out[idx] = target[idx] - merge.target[idx];
+        in_length += in[idx] * in[idx];
+        out_length += out[idx] * out[idx];
+    } while(idx);
+
+    if(in_length == 0.0f || out_length == 0.0f)
+        return;
+
+    in_length = sqrtf(in_length);
+    out_length = sqrtf(out_length);
+
+    idx = N_AXIS;
+    do {
+        idx--;
+        in[idx] /= in_length;
+        out[idx] /= out_length;
+        cos_theta += in[idx] * out[idx];
+    } while(idx);
+
+    // Nothing to blend for nearly straight junctions, do not blend reversals.
+    if(cos_theta > 0.9999f || cos_theta < -0.99f)
+        return;
+
+    // Trig half angle identities, theta is the turn angle.
+    sin_theta_d2 = sqrtf(0.5f * (1.0f - cos_theta));
+    cos_theta_d2 = sqrtf(0.5f * (1.0f + cos_theta));
+    tan_theta_d2 = sin_theta_d2 / cos_theta_d2;
+
+    // Radius of the arc passing at path tolerance distance from the corner. Reduced if the arc tangent points
+    // are further from the corner than the length of the line held back or half the length of the next line.
+    radius = min(pl_data->path_tolerance, merge.data.path_tolerance) * cos_theta_d2 / (1.0f - cos_theta_d2);
+    if((distance = radius * tan_theta_d2) > min(in_length, 0.5f * out_length)) {
+        distance = min(in_length, 0.5f * out_length);
+        radius = distance / tan_theta_d2;
+    }
+
+    if(radius * (1.0f / cos_theta_d2 - 1.0f) < 2.0f * settings.arc_tolerance)
+        return;
+
+    blend.angle = 2.0f * atan2f(sin_theta_d2, cos_theta_d2);
+    blend.segments = radius > settings.arc_tolerance
+                      ? (uint_fast8_t)min(ceilf(0.5f * blend.angle * radius / sqrtf(settings.arc_tolerance * (2.0f * radius - settings.arc_tolerance))), 255.0f)
+                      : 1;
+    blend.segment = 0;
+
+    idx = N_AXIS;
+    do {
+        idx--;
+        blend.start[idx] = merge.target[idx] - in[idx] * distance;
+        blend.end[idx] = merge.target[idx] + out[idx] * distance;
+        blend.center[idx] = merge.target[idx] + (out[idx] - in[idx]) * 0.5f * radius / (sin_theta_d2 * cos_theta_d2);
+        blend.radial[idx] = blend.start[idx] - blend.center[idx];
+        blend.tangent[idx] = in[idx] * radius;
+        out[idx] -= in[idx]; // Direction of centripetal acceleration at the middle of the arc
+    } while(idx);
+
+    memcpy(&blend.data, &merge.data, sizeof(plan_line_data_t));
+    blend.data.message = NULL;
+    blend.data.feed_rate = min(merge.data.feed_rate, pl_data->feed_rate);
+
+    // Limit feed rate to keep centripetal acceleration within limits, computed as for junction speeds.
+    // A single segment is a chamfer, its junctions are handled by the junction speed limit.
+    if(blend.segments > 1) {
+        convert_delta_vector_to_unit_vector(out);
+        blend.data.feed_rate = min(blend.data.feed_rate, sqrtf(limit_value_by_axis_maximum(settings.acceleration, out) * radius));
+    }
+}
+
+// Merges a line with the line held back or holds it back if there is none. Returns false if the line
+// could not be merged or held back, the held back line must then be added by plan_buffer_merged_line()
+// before a retry or if none is held back, the line added by plan_buffer_line().
+bool plan_merge_line (float *target, plan_line_data_t *pl_data)
+{
+    if(blend.segments || !plan_line_is_mergeable(pl_data) ||
+        (settings.line_merge_tolerance <= 0.0f && !plan_line_is_blendable(pl_data)))
+        return false;
+
+    if(merge.points == 0) {
+        system_convert_array_steps_to_mpos(merge.start, pl.position);
+        memcpy(&merge.data, pl_data, sizeof(plan_line_data_t));
+        pl_data->message = NULL; // Indicate message is queued for display on execution
+    } else if(settings.line_merge_tolerance > 0.0f && merge.points < LINE_MERGE_MAX && pl_data->message == NULL &&
+               pl_data->condition.value == merge.data.condition.value &&
+                pl_data->feed_rate == merge.data.feed_rate &&
+                 pl_data->spindle.rpm == merge.data.spindle.rpm &&
+                  plan_merge_fits(target)) {
+        // The line number of the first line merged is kept so that the status report does not run ahead of execution.
+        memcpy(merge.point[merge.points - 1], merge.target, sizeof(merge.target));
+    } else {
+        if(plan_line_is_blendable(pl_data) && plan_line_is_blendable(&merge.data) &&
+            pl_data->condition.value == merge.data.condition.value)
+            plan_blend_corner(target, pl_data);
+        return false;
+    }
+
+    memcpy(merge.target, target, sizeof(merge.target));
+    merge.points++;
+
+    return true;
+}
+
+// Adds the line held back for merging to the buffer, returns false if none. If a blend is pending the
+// line held back is added up to the start of the blend, then the blend segments are added one per call.
+// NOTE: Assumes buffer is available.
+bool plan_buffer_merged_line ()
+{
+    bool ok;
+
+    if(blend.segments) {
+
+        if(merge.points) {
+            merge.points = 0;
+            plan_buffer_line(blend.start, &merge.data);
+        } else {
+
+            uint_fast8_t idx = N_AXIS;
+            float target[N_AXIS], angle = blend.angle * (float)(++blend.segment) / (float)blend.segments;
+            float cos_angle = cosf(angle), sin_angle = sinf(angle);
+
+            do {
+                idx--;
+                target[idx] = blend.center[idx] + cos_angle * blend.radial[idx] + sin_angle * blend.tangent[idx];
+            } while(idx);
+
+            if(blend.segment == blend.segments)
+                blend.segments = 0;
+
+            plan_buffer_line(blend.segments ? target : blend.end, &blend.data);
+        }
+
+        ok = true;
+
+    } else if((ok = merge.points != 0)) {
+        merge.points = 0;
+        plan_buffer_line(merge.target, &merge.data);
+    }
+
+    return ok;
+}
+
+// Returns true if a line is held back for merging or a blend is pending.
+bool plan_merge_pending ()
+{
+    return merge.points != 0 || blend.segments != 0;
+}
+
+
 // Reset the planner position vectors. Called by the system abort/initialization routine.
 void plan_sync_position ()
 {
+    plan_merge_discard(); // Line held back for merging starts from the old position.
+
   #ifdef HAL_KINEMATICS
     hal.kinematics.plan_sync_position (&pl);
   #else
@@ -495,7 +1020,22 @@ void plan_sync_position ()
 // Returns the number of available blocks are in the planner buffer.
 uint8_t plan_get_block_buffer_available ()
 {
-    return (uint8_t)(block_buffer_head >= block_buffer_tail ? ((BLOCK_BUFFER_SIZE - 1) - (block_buffer_head - block_buffer_tail)) : (block_buffer_tail - block_buffer_head - 1));
+    return (uint8_t)(block_buffer_head >= block_buffer_tail ? ((block_buffer_size - 1) - (block_buffer_head - block_buffer_tail)) : (block_buffer_tail - block_buffer_head - 1));
+}
+
+
+// Returns the number of blocks in the planner ring buffer, one less can be queued.
+uint8_t plan_get_block_buffer_size ()
+{
+    return (uint8_t)block_buffer_size;
+}
+
+
+// Returns the number of blocks after the optimally planned block, this is the number of blocks
+// the reverse pass of planner_recalculate() has to walk back over when a new block is added.
+uint8_t plan_get_block_buffer_unplanned ()
+{
+    return (uint8_t)(block_buffer_head >= block_buffer_planned ? (block_buffer_head - block_buffer_planned) : (block_buffer_size - block_buffer_planned + block_buffer_head));
 }
 
 
@@ -521,7 +1061,20 @@ void plan_feed_override (uint_fast8_t feed_override, uint_fast8_t rapid_override
 	  sys.override.feed_rate = (uint8_t)feed_override;
 	  sys.override.rapid_rate = (uint8_t)rapid_override;
 	  sys.report.override_counter = 0; // Set to report change immediately
-	  plan_update_velocity_profile_parameters();
-	  plan_cycle_reinitialize();
+	  override_epoch++;
+	  // Defer replanning to when the planner or the segment generator next needs the plan, blocks
+	  // pick up the new nominal speed and max entry speed as they are reached.
+	  st_update_plan_block_parameters();
+	  block_buffer_planned = block_buffer_tail;
+	  replan = true;
 	}
 }
+
+
+// Replans the buffer if overrides have changed since last planned. Called by the segment generator
+// before loading a block.
+void plan_apply_overrides ()
+{
+    if (replan)
+        planner_recalculate();
+}
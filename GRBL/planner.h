@@ -28,6 +28,28 @@
   #define BLOCK_BUFFER_SIZE 36
 #endif
 
+// Unit of speeds squared in (mm/min)^2 when planning with fixed point math, limits max rate to
+// sqrt(UINT32_MAX * PLANNER_FX_UNIT) = 131070 mm/min with the default value.
+#ifndef PLANNER_FX_UNIT
+  #define PLANNER_FX_UNIT 4.0f
+#endif
+
+// The minimum and maximum number of blocks that can be configured for the planner buffer
+#define PLANNER_BUFFER_MIN 4
+#define PLANNER_BUFFER_MAX 255
+
+// The maximum number of lines that can be merged into a single block
+#ifndef LINE_MERGE_MAX
+  #define LINE_MERGE_MAX 16
+#endif
+
+#ifdef LASER_RASTER
+typedef struct {
+    uint_fast16_t pixels;   // Number of pixels
+    uint8_t power[];        // Pixel power, 0 - 255 maps to 0 - programmed spindle speed
+} laser_raster_t;
+#endif
+
 typedef union {
     uint32_t value;
     struct {
@@ -60,9 +82,12 @@ typedef struct {
     // Fields used by the motion planner to manage acceleration. Some of these values may be updated
     // by the stepper module during execution of special motion cases for replanning purposes.
     float entry_speed_sqr;      // The current planned entry speed at block junction in (mm/min)^2
+                                // NOTE: With PLANNER_FIXED_POINT only valid once loaded by the segment generator.
     float max_entry_speed_sqr;  // Maximum allowable entry speed based on the minimum of junction limit and
                                 // neighboring nominal speeds with overrides in (mm/min)^2
     float acceleration;         // Axis-limit adjusted line acceleration in (mm/min^2). Does not change.
+    float jerk;                 // Axis-limit adjusted line jerk in (mm/min^3), 0 if not jerk limited. Does not change.
+    float jerk_speed;           // Speed change during the jerk phases of a full acceleration ramp, acceleration^2/jerk (mm/min).
     float millimeters;          // The remaining distance for this block to be executed in (mm).
                                 // NOTE: This value may be altered by stepper algorithm during execution.
 
@@ -70,11 +95,23 @@ typedef struct {
     float max_junction_speed_sqr; // Junction entry speed limit based on direction vectors in (mm/min)^2
     float rapid_rate;             // Axis-limit adjusted maximum rate for this block direction in (mm/min)
     float programmed_rate;        // Programmed rate of this block (mm/min).
+    float nominal_speed;          // Programmed rate with overrides applied (mm/min), see plan_compute_profile_nominal_speed().
+    uint32_t override_epoch;      // Override change count when nominal_speed was computed.
+
+  #ifdef PLANNER_FIXED_POINT
+    // Fixed point planner speeds squared in units of PLANNER_FX_UNIT (mm/min)^2.
+    uint32_t entry_speed_sqr_fx;  // Planned entry speed, written by the planner passes.
+    uint32_t max_entry_speed_sqr_fx;
+    uint32_t ramp_speed_sqr_fx;   // Speed squared change over the block at full acceleration, trapezoidal ramps only.
+  #endif
 
     // Stored spindle speed data used by spindle overrides and resuming methods.
     spindle_t spindle;    // Block spindle speed. Copied from pl_line_data.
 
     char *message;                // Message to be displayed when block is executed.
+#ifdef LASER_RASTER
+    laser_raster_t *raster;       // Pixel power to be output along the motion, handed over to the stepper.
+#endif
 } plan_block_t;
 
 
@@ -84,7 +121,11 @@ typedef struct {
     spindle_t spindle;          // Desired spindle speed through line motion.
     planner_cond_t condition;   // Bitflag variable to indicate planner conditions. See defines above.
     int32_t line_number;        // Desired line number to report when executing.
+    float path_tolerance;       // Corner blending tolerance in mm (G64 P-), 0 for exact path.
     char *message;              // Message to be displayed when block is executed.
+#ifdef LASER_RASTER
+    laser_raster_t *raster;     // Pixel power to be output along the motion.
+#endif
 } plan_line_data_t;
 
 
@@ -94,9 +135,11 @@ typedef struct {
                                     // from g-code position for movements requiring multiple line motions,
                                     // i.e. arcs, canned cycles, and backlash compensation.
   float previous_unit_vec[N_AXIS];  // Unit vector of previous path line segment
-  float previous_nominal_speed;     // Nominal speed of previous path line segment
 } planner_t;
 
+// Allocate the planner buffer, called once at startup. Returns false if out of memory.
+bool plan_alloc_buffer(uint_fast8_t blocks);
+
 // Initialize and reset the motion plan subsystem
 void plan_reset(); // Reset all
 //void plan_reset_buffer(); // Reset buffer only.
@@ -106,6 +149,17 @@ void plan_reset(); // Reset all
 // rate is taken to mean "frequency" and would complete the operation in 1/feed_rate minutes.
 bool plan_buffer_line(float *target, plan_line_data_t *pl_data);
 
+// Merges a line with the line held back for merging or holds it back. Returns false if not possible,
+// see plan_buffer_merged_line(). Merging is enabled by a non-zero line merge tolerance setting,
+// lines with a non-zero path tolerance are held back for corner blending.
+bool plan_merge_line(float *target, plan_line_data_t *pl_data);
+
+// Adds the line held back for merging or the next part of a corner blend to the buffer, returns false if there is none.
+bool plan_buffer_merged_line();
+
+// Returns true if a line is held back for merging or a corner blend is pending.
+bool plan_merge_pending();
+
 // Called when the current block is no longer needed. Discards the block and makes the memory
 // availible for new blocks.
 void plan_discard_current_block();
@@ -119,11 +173,25 @@ plan_block_t *plan_get_current_block();
 // Called by step segment buffer when computing executing block velocity profile.
 float plan_get_exec_block_exit_speed_sqr();
 
+#ifdef PLANNER_FIXED_POINT
+// Converts a speed squared in (mm/min)^2 to fixed point, saturates at UINT32_MAX.
+uint32_t plan_fx(float speed_sqr);
+// Converts a fixed point speed squared to (mm/min)^2.
+#define plan_fx_to_float(speed_sqr) ((float)(speed_sqr) * PLANNER_FX_UNIT)
+#endif
+
 // Called by main program during planner calculations and step segment buffer during initialization.
 float plan_compute_profile_nominal_speed(plan_block_t *block);
 
-// Re-calculates buffered motions profile parameters upon a motion-based override change.
-void plan_update_velocity_profile_parameters();
+// Returns the distance required to change speed between the given speeds, accounts for jerk limiting.
+float plan_ramp_distance(plan_block_t *block, float speed, float target_speed);
+
+// Returns the maximum speed squared that can be reached accelerating from speed over distance,
+// accounts for jerk limiting. Also used for the maximum entry speed decelerating to a given exit speed.
+float plan_ramp_max_speed_sqr(plan_block_t *block, float speed_sqr, float distance);
+
+// Replans the buffer after a feed or rapid override change. Called by the segment generator.
+void plan_apply_overrides();
 
 // Reset the planner position vector (in steps)
 void plan_sync_position();
@@ -134,6 +202,12 @@ void plan_cycle_reinitialize();
 // Returns the number of available blocks in the planner buffer.
 uint8_t plan_get_block_buffer_available();
 
+// Returns the size of the planner buffer as allocated at startup.
+uint8_t plan_get_block_buffer_size();
+
+// Returns the number of blocks not yet optimally planned, for profiling.
+uint8_t plan_get_block_buffer_unplanned();
+
 // Returns the status of the block ring buffer. True, if buffer is full.
 bool plan_check_full_buffer();
 
@@ -36,34 +36,485 @@ typedef union {
 
 typedef struct {
     char *message;
-    uint_fast8_t idx;
+    uint_fast16_t idx;
     uint_fast8_t tracker;
     bool show;
 } user_message_t;
 
+// Span of the stream input buffer being read when the stream supports bulk reads.
+typedef struct {
+    char *data;
+    uint16_t length;
+    uint16_t idx;
+} read_span_t;
+
+// Line read from the input stream, filtered and queued for execution.
+typedef struct {
+    char data[LINE_BUFFER_SIZE];    // Zero-terminated.
+    uint_fast16_t length;
+    bool overflow;
+    bool sync;                      // System command or M-word, lines following are not read ahead
+    user_message_t user_message;
+  #ifdef LASER_RASTER
+    user_message_t raster;
+  #endif
+  #ifdef MOTION_FRAMES
+    bool frame;                     // Binary motion frame, decoded into motion when read if valid
+    bool frame_valid;
+    motion_frame_t motion;
+  #endif
+  #ifdef STREAM_WINDOWED_ACK
+    bool numbered;                  // Line carries a sequence number
+    uint32_t seq;
+  #endif
+} queued_line_t;
+
+// Lines are read into the slot following the last line queued, the first line queued is executed.
+typedef struct {
+    uint_fast8_t head;              // Index of the first line queued
+    uint_fast8_t count;             // Number of lines queued, including the line being executed
+    bool read_ahead;                // Set while a queued line is executed
+    volatile bool flush;            // Set when the input stream is cancelled, queued lines are discarded
+    queued_line_t line[LINE_QUEUE_SIZE];
+} line_queue_t;
+
+// Commands not originating from the input stream, queued by protocol_enqueue_command().
+typedef struct {
+    command_priority_t priority;
+    char data[LINE_BUFFER_SIZE];
+} queued_command_t;
+
+// Commands are executed one per pass of the main loop, oldest high priority command first. A normal priority
+// command that has been passed over COMMAND_QUEUE_SIZE times is executed ahead of any high priority command.
+typedef struct {
+    uint_fast8_t count;                 // Number of commands queued
+    uint_fast8_t passed;                // Times the oldest normal priority command has been passed over
+    volatile bool flush;                // Set on stop and jog cancel, queued commands are discarded
+    uint8_t order[COMMAND_QUEUE_SIZE];  // Slot indices, queued commands oldest first followed by free slots
+    queued_command_t slot[COMMAND_QUEUE_SIZE];
+} command_queue_t;
+
 static uint_fast16_t char_counter = 0;
-static char line[LINE_BUFFER_SIZE]; // Line to be executed. Zero-terminated.
+static char eol = '\0';
+static line_flags_t line_flags = {0};
+static bool nocaps = false;
+static line_queue_t queue;
+static command_queue_t commands;
 static char xcommand[LINE_BUFFER_SIZE];
-static user_message_t user_message = {NULL, 0, 0, false};
 static const char *msg = "(MSG,";
+static read_span_t span = {NULL, 0, 0};
+
+#ifdef LASER_RASTER
+#define RASTER_DATA_SIZE (((LASER_RASTER_MAX_PIXELS + 2) / 3) * 4 + 1) // Base64 encoded pixels plus terminator
+
+static const char *rst = "(RASTER,";
+#endif
+#ifdef MOTION_FRAMES
+static volatile bool motion_frames = false; // Input stream carries binary motion frames
+#endif
+#ifdef STREAM_WINDOWED_ACK
+// Sequence numbered line tracking for windowed acknowledgements.
+typedef struct {
+    bool parsing;           // Reading the sequence number prefix
+    bool synced;            // next is valid
+    uint16_t next;          // Expected sequence number of next line
+    uint16_t last;          // Sequence number of last line executed
+    uint_fast8_t pending;   // Number of lines executed but not yet acknowledged
+} line_ack_t;
+
+static line_ack_t ack = {0};
+#endif
+
+// Automatic status report timing.
+typedef struct {
+    uint32_t last;          // Time of last report, in ms
+    uint_fast16_t state;    // System state at last report
+} auto_report_t;
+
+static auto_report_t auto_report = {0};
+
 static void protocol_exec_rt_suspend();
 
-// add gcode to execute not originating from normal input stream
-bool protocol_enqueue_gcode (char *gcode)
+static void protocol_clear_commands (void)
 {
-    bool ok = xcommand[0] == '\0' &&
+    uint_fast8_t idx;
+
+    for(idx = 0; idx < COMMAND_QUEUE_SIZE; idx++)
+        commands.order[idx] = idx;
+
+    commands.count = commands.passed = 0;
+    commands.flush = false;
+}
+
+// add command to execute not originating from normal input stream, returns false if not accepted
+bool protocol_enqueue_command (char *command, command_priority_t priority)
+{
+    bool ok = commands.count < COMMAND_QUEUE_SIZE && !commands.flush && strlen(command) < LINE_BUFFER_SIZE &&
                (sys.state == STATE_IDLE || (sys.state & (STATE_JOG|STATE_TOOL_CHANGE))) &&
                  bit_isfalse(sys_rt_exec_state, EXEC_MOTION_CANCEL);
 
     if(ok && gc_state.file_run)
-        ok = gc_state.modal.program_flow != ProgramFlow_Running || strncmp((char *)gcode, "$J=", 3);
+        ok = gc_state.modal.program_flow != ProgramFlow_Running || strncmp((char *)command, "$J=", 3);
 
-    if(ok)
-        strcpy(xcommand, gcode);
+    if(ok) {
+        queued_command_t *cmd = &commands.slot[commands.order[commands.count]];
+        cmd->priority = priority;
+        strcpy(cmd->data, command);
+        commands.count++;
+    }
 
     return ok;
 }
 
+// add gcode to execute not originating from normal input stream
+bool protocol_enqueue_gcode (char *gcode)
+{
+    return protocol_enqueue_command(gcode, CommandPriority_Normal);
+}
+
+// Moves the next queued command to xcommand, returns false if none.
+// The command is copied out so that its slot may be reused while it is executed.
+static bool protocol_get_command (void)
+{
+    uint_fast8_t idx, pos = 0, slot;
+
+    if(commands.flush)
+        protocol_clear_commands();
+
+    if(commands.count == 0)
+        return false;
+
+    if(commands.slot[commands.order[0]].priority == CommandPriority_Normal && commands.passed < COMMAND_QUEUE_SIZE) {
+        for(idx = 1; idx < commands.count; idx++) {
+            if(commands.slot[commands.order[idx]].priority != CommandPriority_Normal) {
+                pos = idx;
+                break;
+            }
+        }
+    }
+
+    if(pos)
+        commands.passed++;
+    else if(commands.slot[commands.order[0]].priority == CommandPriority_Normal)
+        commands.passed = 0;
+
+    slot = commands.order[pos];
+    strcpy(xcommand, commands.slot[slot].data);
+
+    commands.count--;
+    for(idx = pos; idx < commands.count; idx++)
+        commands.order[idx] = commands.order[idx + 1];
+    commands.order[commands.count] = slot;
+
+    return true;
+}
+
+#ifdef MOTION_FRAMES
+
+// Executes a binary motion frame decoded when read, an end frame has already switched the input stream back to G-code.
+static status_code_t protocol_execute_frame (queued_line_t *line)
+{
+    if(!line->frame_valid)
+        return Status_MotionFrameInvalid;
+
+    if(line->motion.type == MotionFrame_End)
+        return Status_OK;
+
+    if (sys.state & (STATE_ALARM|STATE_ESTOP|STATE_JOG)) // Block motion if in alarm, eStop or jog mode.
+        return Status_SystemGClock;
+
+    return gc_execute_frame(&line->motion);
+}
+
+#endif
+
+#ifdef STREAM_WINDOWED_ACK
+
+// Sends the cumulative acknowledgement for executed lines if any is pending.
+static void protocol_ack_flush (void)
+{
+    if(ack.pending) {
+        ack.pending = 0;
+        report_stream_ack(Status_OK, ack.last);
+    }
+}
+
+// Called before a line is executed, returns false if a numbered line is out of sequence.
+// Pending acknowledgements are sent first if the line is not numbered or is a system command
+// to keep responses in order.
+static bool protocol_ack_begin (queued_line_t *line)
+{
+    if(!line->numbered || line->data[0] == '$')
+        protocol_ack_flush();
+
+    return !line->numbered || (line->seq <= 0xFFFF && (!ack.synced || line->seq == 0 || line->seq == ack.next));
+}
+
+// Called after a numbered line is executed. Errors are reported at once, ok is deferred until the
+// input stream runs empty, STREAM_ACK_INTERVAL lines are pending or sync is requested.
+// A line out of sequence is not executed and leaves the sequence state untouched, the error
+// reports the last line executed after any pending ok so that the sender may resend from there.
+static void protocol_ack_end (queued_line_t *line, status_code_t status_code, bool sync)
+{
+    if(status_code == Status_StreamSequenceError) {
+        protocol_ack_flush();
+        report_stream_ack(status_code, ack.last);
+        return;
+    }
+
+    if(line->seq <= 0xFFFF) {
+        ack.last = (uint16_t)line->seq;
+        ack.next = ack.last + 1;
+        ack.synced = On;
+    }
+
+    if(status_code != Status_OK) {
+        ack.pending = 0;
+        report_stream_ack(status_code, ack.last);
+    } else if(++ack.pending >= STREAM_ACK_INTERVAL || sync)
+        protocol_ack_flush();
+}
+
+#endif
+
+// Returns the next character from the input stream, SERIAL_NO_DATA if none is available. When the stream
+// supports bulk reads characters are taken directly from a span of the input buffer, the span is committed
+// and a new one requested only when exhausted.
+static inline int16_t stream_read (void)
+{
+    if(hal.stream.read_span == NULL)
+        return hal.stream.read();
+
+    if(span.idx == span.length) {
+        if(span.idx)
+            hal.stream.read_commit(span.idx);
+        span.idx = 0;
+        if((span.length = hal.stream.read_span(&span.data)) == 0)
+            return SERIAL_NO_DATA;
+    }
+
+    return (uint8_t)span.data[span.idx++];
+}
+
+// Commits the characters read from the current span and ends it, called at end of line as the stream
+// may be switched by the line executed. Returns false if the input buffer has been flushed or cancelled
+// while the characters were read, or if the stream was switched to one without bulk reads.
+static bool stream_read_end (void)
+{
+    bool ok = span.idx == 0 || (hal.stream.read_commit && hal.stream.read_commit(span.idx));
+
+    span.idx = span.length = 0;
+
+    return ok;
+}
+
+// Resets the line reader state for a new line, read into the queue slot following the last line queued.
+// The slot is reset when the queue is not full, else when the first line queued has been executed.
+static queued_line_t *protocol_line_start (void)
+{
+    queued_line_t *line = &queue.line[(queue.head + queue.count) % LINE_QUEUE_SIZE];
+
+    nocaps = false;
+    char_counter = line_flags.value = 0;
+  #ifdef STREAM_WINDOWED_ACK
+    ack.parsing = Off;
+  #endif
+
+    if(queue.count < LINE_QUEUE_SIZE) {
+        line->sync = line->user_message.show = false;
+      #ifdef LASER_RASTER
+        line->raster.show = false;
+      #endif
+      #ifdef STREAM_WINDOWED_ACK
+        line->numbered = Off;
+      #endif
+    }
+
+    return line;
+}
+
+// Reads lines of incoming stream data into the line queue as the data becomes available. Performs an
+// initial filtering by removing spaces and comments and capitalizing all letters. Reading stops when
+// the queue is full or the last line queued is a system command or has M-words, as these may switch
+// or suspend the input stream or wait for a cycle start. Returns true if there is a line to execute.
+// NOTE: When the input stream is cancelled the lines queued are discarded when the CMD_RESET character
+//       inserted by the cancel is read, characters preceding it are discarded.
+static bool protocol_read_lines (void)
+{
+    int16_t c;
+    queued_line_t *line = &queue.line[(queue.head + queue.count) % LINE_QUEUE_SIZE];
+
+    while((queue.flush || (queue.count < LINE_QUEUE_SIZE && !(queue.count && queue.line[(queue.head + queue.count - 1) % LINE_QUEUE_SIZE].sync))) &&
+           (c = stream_read()) != SERIAL_NO_DATA) {
+
+        if(queue.flush && c != CMD_RESET)
+            continue;
+
+      #ifdef STREAM_WINDOWED_ACK
+        if(ack.parsing) {
+            if(c >= '0' && c <= '9') {
+                if(line->seq <= 0xFFFF) // Out of range values fail the sequence check
+                    line->seq = line->seq * 10 + c - '0';
+                continue;
+            }
+            ack.parsing = Off;
+        }
+      #endif
+
+        if(c == CMD_RESET) {
+
+            // Discard lines queued, except the line being executed.
+            queue.count = queue.read_ahead ? 1 : 0;
+            queue.flush = false;
+
+            eol = '\0';
+            commands.flush = true;
+            line = protocol_line_start();
+          #ifdef MOTION_FRAMES
+            motion_frames = false;
+          #endif
+
+            if (sys.state == STATE_JOG) // Block all other states from invoking motion cancel.
+                system_set_exec_state_flag(EXEC_MOTION_CANCEL);
+
+      #ifdef STREAM_WINDOWED_ACK
+        } else if(c == '@' && char_counter == 0 && !line_flags.value && !line->numbered) {
+            // Sequence number prefix, only recognized at the start of a line.
+            ack.parsing = line->numbered = On;
+            line->seq = 0;
+      #endif
+      #ifdef MOTION_FRAMES
+        } else if(c == CMD_MOTION_FRAMES) {
+            // Switch to frames at the start of a line only, ignore it elsewhere.
+            if(char_counter == 0 && !line_flags.value)
+                motion_frames = On;
+
+        } else if(motion_frames && c != '\n' && c != '\r') {
+            // Frames are base64 encoded, collect all printable characters as is.
+            if(c > ' ') {
+                if(char_counter < (LINE_BUFFER_SIZE - 1))
+                    line->data[char_counter++] = c;
+                else
+                    line_flags.overflow = On;
+            }
+      #endif
+        } else if ((c == '\n') || (c == '\r')) { // End of line reached
+
+            // Discard the line if input was flushed or cancelled before it was committed.
+            if(!stream_read_end()) {
+                protocol_line_start();
+                continue;
+            }
+
+            // Check for possible secondary end of line character, do not process as empty line
+            // if part of crlf (or lfcr pair) as this produces a possibly unwanted double response
+            if(char_counter == 0 && eol && eol != c) {
+                eol = '\0';
+                continue;
+            } else
+                eol = (char)c;
+
+            line->data[char_counter] = '\0'; // Set string termination character.
+            line->length = char_counter;
+            line->overflow = line_flags.overflow;
+
+          #ifdef MOTION_FRAMES
+            // Decode frames when read as an end frame switches the input stream back to G-code.
+            if((line->frame = motion_frames) && char_counter && !line_flags.overflow &&
+                 (line->frame_valid = motion_frame_decode(line->data, &line->motion)) && line->motion.type == MotionFrame_End)
+                motion_frames = false;
+          #endif
+
+            // Queue line and reset tracking data for next line.
+            queue.count++;
+            line = protocol_line_start();
+
+        } else if (c <= (nocaps ? ' ' - 1 : ' ') || line_flags.value) {
+            // Throw away all whitepace, control characters, comment characters and overflow characters.
+            if(c >= ' ' && line_flags.comment_parentheses) {
+                if(line->user_message.tracker == 5)
+                    line->user_message.message[line->user_message.idx++] = c == ')' ? '\0' : c;
+                else if(line->user_message.tracker > 0 && CAPS(c) == msg[line->user_message.tracker])
+                    line->user_message.tracker++;
+                else
+                    line->user_message.tracker = 0;
+              #ifdef LASER_RASTER
+                if(line->raster.tracker == 8) {
+                    if(c == ')')
+                        line->raster.message[line->raster.idx] = '\0';
+                    else if(line->raster.idx < RASTER_DATA_SIZE - 1)
+                        line->raster.message[line->raster.idx++] = c;
+                    else
+                        line_flags.overflow = On;
+                } else if(line->raster.tracker > 0 && CAPS(c) == rst[line->raster.tracker])
+                    line->raster.tracker++;
+                else
+                    line->raster.tracker = 0;
+              #endif
+                if (c == ')') {
+                    // End of '()' comment. Resume line.
+                    line_flags.comment_parentheses = Off;
+                    line->user_message.show = line->user_message.show || line->user_message.tracker == 5;
+                  #ifdef LASER_RASTER
+                    line->raster.show = line->raster.show || line->raster.tracker == 8;
+                  #endif
+                }
+            }
+        } else if (char_counter == 0 && c == '/') {
+            line_flags.block_delete = sys.block_delete_enabled;
+        } else if (char_counter == 0 && c == '$') {
+           // Do not uppercase system commands here - will destroy passwords etc...
+            nocaps = line->sync = On;
+            line->data[char_counter++] = c;
+        } else if (c == '(') {
+            // Enable comments flag and ignore all characters until ')' or EOL unless it is a message.
+            // NOTE: This doesn't follow the NIST definition exactly, but is good enough for now.
+            // In the future, we could simply remove the items within the comments, but retain the
+            // comment control characters, so that the g-code parser can error-check it.
+            if((line_flags.comment_parentheses = !line_flags.comment_semicolon)) {
+                if(hal.show_message) {
+                    if(line->user_message.message == NULL)
+                        line->user_message.message = malloc(LINE_BUFFER_SIZE);
+                    if(line->user_message.message) {
+                        line->user_message.idx = 0;
+                        line->user_message.tracker = 1;
+                    }
+                }
+              #ifdef LASER_RASTER
+                if(line->raster.message == NULL)
+                    line->raster.message = malloc(RASTER_DATA_SIZE);
+                if(line->raster.message) {
+                    line->raster.idx = 0;
+                    line->raster.tracker = 1;
+                }
+              #endif
+            }
+        } else if (c == ';') {
+            // NOTE: ';' comment to EOL is a LinuxCNC definition. Not NIST.
+            line_flags.comment_semicolon = !line_flags.comment_parentheses;
+        } else if (char_counter >= (LINE_BUFFER_SIZE - 1)) {
+            // Detect line buffer overflow and set flag.
+            line_flags.overflow = On;
+        } else if ((line->data[char_counter++] = nocaps ? c : CAPS(c)) == 'M')
+            line->sync = On;
+    }
+
+    return queue.count != 0 && !queue.flush;
+}
+
+// Returns the number of lines in the line queue, including the line being executed.
+uint_fast8_t protocol_get_lines_queued (void)
+{
+    return queue.count;
+}
+
+// Reads lines ahead into the line queue while the line being executed waits for room in the planner buffer.
+void protocol_read_ahead (void)
+{
+    if(queue.read_ahead)
+        protocol_read_lines();
+}
+
 /*
   GRBL PRIMARY LOOP:
 */
@@ -90,7 +541,7 @@ bool protocol_main_loop()
             protocol_execute_realtime(); // Enter safety door mode. Should return as IDLE state.
         }
         // All systems go!
-        system_execute_startup(line); // Execute startup script.
+        system_execute_startup(queue.line[0].data); // Execute startup script, the line queue is empty.
     }
 
     // ---------------------------------------------------------------------------------
@@ -98,114 +549,83 @@ bool protocol_main_loop()
     // This is also where Grbl idles while waiting for something to do.
     // ---------------------------------------------------------------------------------
 
-    int16_t c;
-    char eol = '\0';
-    line_flags_t line_flags = {0};
-    bool nocaps = false;
-
-    xcommand[0] = '\0';
-    user_message.show = false;
+    protocol_clear_commands();
+    queue.head = queue.count = 0;
+    queue.read_ahead = queue.flush = false;
+    protocol_line_start();
+    stream_read_end();
+  #ifdef MOTION_FRAMES
+    motion_frames = false;
+  #endif
+  #ifdef STREAM_WINDOWED_ACK
+    memset(&ack, 0, sizeof(line_ack_t));
+  #endif
 
     while(true) {
 
-        // Process one line of incoming stream data, as the data becomes available. Performs an
-        // initial filtering by removing spaces and comments and capitalizing all letters.
-        while((c = hal.stream.read()) != SERIAL_NO_DATA) {
-
-            if(c == CMD_RESET) {
-
-                eol = xcommand[0] = '\0';
-                nocaps = user_message.show = false;
-                char_counter = line_flags.value = 0;
-
-                if (sys.state == STATE_JOG) // Block all other states from invoking motion cancel.
-                    system_set_exec_state_flag(EXEC_MOTION_CANCEL);
-
-            } else if ((c == '\n') || (c == '\r')) { // End of line reached
-
-                // Check for possible secondary end of line character, do not process as empty line
-                // if part of crlf (or lfcr pair) as this produces a possibly unwanted double response
-                if(char_counter == 0 && eol && eol != c) {
-                    eol = '\0';
-                    continue;
-                } else
-                    eol = (char)c;
-
-                if(!protocol_execute_realtime()) // Runtime command check point.
-                    return !sys.exit;            // Bail to calling function upon system abort
+        // Read lines of incoming stream data into the line queue as the data becomes available and
+        // execute them one by one, reporting the status of execution.
+        while(protocol_read_lines()) {
+
+            queued_line_t *line = &queue.line[queue.head];
+
+            if(!protocol_execute_realtime()) // Runtime command check point.
+                return !sys.exit;            // Bail to calling function upon system abort
+
+            if(queue.flush) // Input stream cancelled, discard queued lines.
+                continue;
+
+          #ifdef REPORT_ECHO_LINE_RECEIVED
+            report_echo_line_received(line->data);
+          #endif
+
+            queue.read_ahead = On;
+
+            // Direct and execute one line of formatted input, and report status of execution.
+          #ifdef STREAM_WINDOWED_ACK
+            if (!protocol_ack_begin(line)) // Numbered line out of sequence.
+                gc_state.last_error = Status_StreamSequenceError;
+            else
+          #endif
+            if (line->overflow) // Report line overflow error.
+                gc_state.last_error = Status_Overflow;
+            else if ((line->data[0] == '\0' || line->length == 0) && !line->user_message.show) // Empty or comment line. For syncing purposes.
+                gc_state.last_error = Status_OK;
+          #ifdef MOTION_FRAMES
+            else if (line->frame)
+                gc_state.last_error = protocol_execute_frame(line);
+          #endif
+            else if (line->data[0] == '$') // Grbl '$' system command
+                gc_state.last_error = system_execute_line(line->data);
+            else if (sys.state & (STATE_ALARM|STATE_ESTOP|STATE_JOG)) // Everything else is gcode. Block if in alarm, eStop or jog mode.
+                gc_state.last_error = Status_SystemGClock;
+            else { // Parse and execute g-code block.
+              #ifdef LASER_RASTER
+                gc_set_raster_data(line->raster.show ? line->raster.message : NULL);
+              #endif
+                gc_state.last_error = gc_execute_block(line->data, line->user_message.show ? line->user_message.message : NULL);
+            }
 
-                line[char_counter] = '\0'; // Set string termination character.
+            queue.read_ahead = Off;
 
-              #ifdef REPORT_ECHO_LINE_RECEIVED
-                report_echo_line_received(line);
-              #endif
+          #ifdef STREAM_WINDOWED_ACK
+            if (line->numbered)
+                protocol_ack_end(line, gc_state.last_error, line->length == 0);
+            else
+          #endif
+            hal.report.status_message(gc_state.last_error);
 
-                // Direct and execute one line of formatted input, and report status of execution.
-                if (line_flags.overflow) // Report line overflow error.
-                    gc_state.last_error = Status_Overflow;
-                else if ((line[0] == '\0' || char_counter == 0) && !user_message.show) // Empty or comment line. For syncing purposes.
-                    gc_state.last_error = Status_OK;
-                else if (line[0] == '$') // Grbl '$' system command
-                    gc_state.last_error = system_execute_line(line);
-                else if (sys.state & (STATE_ALARM|STATE_ESTOP|STATE_JOG)) // Everything else is gcode. Block if in alarm, eStop or jog mode.
-                    gc_state.last_error = Status_SystemGClock;
-                else  // Parse and execute g-code block.
-                    gc_state.last_error = gc_execute_block(line, user_message.show ? user_message.message : NULL);
-
-                hal.report.status_message(gc_state.last_error);
-
-                // Reset tracking data for next line.
-                nocaps = user_message.show = false;
-                char_counter = line_flags.value = 0;
-
-            } else if (c <= (nocaps ? ' ' - 1 : ' ') || line_flags.value) {
-                // Throw away all whitepace, control characters, comment characters and overflow characters.
-                if(c >= ' ' && line_flags.comment_parentheses) {
-                    if(user_message.tracker == 5)
-                        user_message.message[user_message.idx++] = c == ')' ? '\0' : c;
-                    else if(user_message.tracker > 0 && CAPS(c) == msg[user_message.tracker])
-                        user_message.tracker++;
-                    else
-                        user_message.tracker = 0;
-                    if (c == ')') {
-                        // End of '()' comment. Resume line.
-                        line_flags.comment_parentheses = Off;
-                        user_message.show = user_message.show || user_message.tracker == 5;
-                    }
-                }
-            } else if (char_counter == 0 && c == '/') {
-                line_flags.block_delete = sys.block_delete_enabled;
-            } else if (char_counter == 0 && c == '$') {
-               // Do not uppercase system commands here - will destroy passwords etc...
-                nocaps = On;
-                line[char_counter++] = c;
-            } else if (c == '(') {
-                // Enable comments flag and ignore all characters until ')' or EOL unless it is a message.
-                // NOTE: This doesn't follow the NIST definition exactly, but is good enough for now.
-                // In the future, we could simply remove the items within the comments, but retain the
-                // comment control characters, so that the g-code parser can error-check it.
-                if((line_flags.comment_parentheses = !line_flags.comment_semicolon)) {
-                    if(hal.show_message) {
-                        if(user_message.message == NULL)
-                            user_message.message = malloc(LINE_BUFFER_SIZE);
-                        if(user_message.message) {
-                            user_message.idx = 0;
-                            user_message.tracker = 1;
-                        }
-                    }
-                }
-            } else if (c == ';') {
-                // NOTE: ';' comment to EOL is a LinuxCNC definition. Not NIST.
-                line_flags.comment_semicolon = !line_flags.comment_parentheses;
-            } else if (char_counter >= (LINE_BUFFER_SIZE - 1)) {
-                // Detect line buffer overflow and set flag.
-                line_flags.overflow = On;
-            } else
-                line[char_counter++] = nocaps ? c : CAPS(c);
+            queue.head = (queue.head + 1) % LINE_QUEUE_SIZE;
+            if(queue.count-- == LINE_QUEUE_SIZE)
+                protocol_line_start();
         }
 
-        // Handle extra command (internal stream)
-        if(xcommand[0] != '\0') {
+      #ifdef STREAM_WINDOWED_ACK
+        protocol_ack_flush(); // Input stream is empty, acknowledge lines executed.
+      #endif
+
+        // Handle extra command (internal stream), one per pass
+        if(protocol_get_command()) {
 
             if (xcommand[0] == '$') // Grbl '$' system command
                 system_execute_line(xcommand);
@@ -213,13 +633,15 @@ bool protocol_main_loop()
                 hal.report.status_message(Status_SystemGClock);
             else // Parse and execute g-code block.
                 gc_execute_block(xcommand, NULL);
-
-            xcommand[0] = '\0';
         }
 
         // If there are no more characters in the input stream buffer to be processed and executed,
         // this indicates that g-code streaming has either filled the planner buffer or has
         // completed. In either case, auto-cycle start, if enabled, any queued moves.
+        // A line held back for merging is queued when the planner is about to run empty.
+        if(plan_get_block_buffer_available() >= plan_get_block_buffer_size() - 2)
+            mc_line_flush();
+
         protocol_auto_cycle_start();
 
         if(!protocol_execute_realtime() && sys.abort) // Runtime command check point.
@@ -235,6 +657,9 @@ bool protocol_main_loop()
 void protocol_buffer_synchronize ()
 {
     // If system is queued, ensure cycle resumes if the auto start flag is present.
+    mc_line_flush();
+    if(sys.state == STATE_CHECK_MODE && sys.estimate)
+        estimator_flush(); // Execute remaining motions in simulated time.
     protocol_auto_cycle_start();
     while (protocol_execute_realtime() && (plan_get_current_block() || sys.state == STATE_CYCLE));
 }
@@ -339,6 +764,20 @@ bool protocol_exec_rt_system ()
 
     }
 
+    // Push a status report when the report interval has elapsed or the system state has changed.
+    if(settings.report_interval && hal.get_elapsed_ticks) {
+        uint32_t ms = hal.get_elapsed_ticks();
+        if(ms - auto_report.last >= settings.report_interval || sys.state != auto_report.state) {
+            auto_report.last = ms;
+            auto_report.state = sys.state;
+          #ifdef STATUS_FRAMES
+            system_set_exec_state_flag(settings.report_frames ? EXEC_STATUS_FRAME : EXEC_STATUS_REPORT);
+          #else
+            system_set_exec_state_flag(EXEC_STATUS_REPORT);
+          #endif
+        }
+    }
+
     if (sys_rt_exec_state && (rt_exec = system_clear_exec_states())) { // Get and clear volatile sys_rt_exec_state atomically.
 
         // Execute system abort.
@@ -374,11 +813,17 @@ bool protocol_exec_rt_system ()
         if (rt_exec & EXEC_STATUS_REPORT)
             report_realtime_status();
 
+      #ifdef STATUS_FRAMES
+        // Execute and send binary status frame to output stream
+        if (rt_exec & EXEC_STATUS_FRAME)
+            status_frame_report();
+      #endif
+
         // Execute and print PID log to output stream
         if (rt_exec & EXEC_PID_REPORT)
             report_pid_log();
 
-        rt_exec &= ~(EXEC_STOP|EXEC_STATUS_REPORT|EXEC_PID_REPORT); // clear requests already processed
+        rt_exec &= ~(EXEC_STOP|EXEC_STATUS_REPORT|EXEC_STATUS_FRAME|EXEC_PID_REPORT); // clear requests already processed
 
         // Let state machine handle any remaining requests
         if(rt_exec)
@@ -563,6 +1008,10 @@ ISR_CODE bool protocol_process_realtime (char c)
         case CMD_STOP: // Set as true
             system_set_exec_state_flag(EXEC_STOP);
             char_counter = 0;
+            queue.flush = commands.flush = true;
+          #ifdef MOTION_FRAMES
+            motion_frames = false;
+          #endif
             hal.stream.cancel_read_buffer();
             add = false;
             break;
@@ -584,6 +1033,13 @@ ISR_CODE bool protocol_process_realtime (char c)
             add = false;
             break;
 
+      #ifdef STATUS_FRAMES
+        case CMD_STATUS_FRAME:
+            system_set_exec_state_flag(EXEC_STATUS_FRAME);
+            add = false;
+            break;
+      #endif
+
         case CMD_PID_REPORT:
             system_set_exec_state_flag(EXEC_PID_REPORT);
             add = false;
@@ -608,9 +1064,15 @@ ISR_CODE bool protocol_process_realtime (char c)
 
         case CMD_JOG_CANCEL: // Cancel jogging
             char_counter = 0;
+            queue.flush = commands.flush = true;
             hal.stream.cancel_read_buffer();
             break;
 
+      #ifdef MOTION_FRAMES
+        case CMD_MOTION_FRAMES: // Kept in the stream, the protocol loop switches to frames when it is read.
+            return add;
+      #endif
+
         case CMD_OVERRIDE_FEED_RESET:
         case CMD_OVERRIDE_FEED_COARSE_PLUS:
         case CMD_OVERRIDE_FEED_COARSE_MINUS:
@@ -32,6 +32,18 @@
   #define LINE_BUFFER_SIZE 257 // 256 characters plus terminator
 #endif
 
+// Number of lines in the line queue. Lines are read into the queue, and filtered, ahead of the line
+// being executed while it waits for room in the planner buffer. Set to 1 to disable reading ahead.
+#ifndef LINE_QUEUE_SIZE
+  #define LINE_QUEUE_SIZE 4
+#endif
+
+// Number of commands not originating from the input stream, e.g. jog commands from a keypad, that may be
+// queued by protocol_enqueue_gcode() and protocol_enqueue_command(). One is executed per pass of the main loop.
+#ifndef COMMAND_QUEUE_SIZE
+  #define COMMAND_QUEUE_SIZE 4
+#endif
+
 // Starts Grbl main loop. It handles all incoming characters from the input stream and executes
 // them as they complete. It is also responsible for finishing the initialization procedures.
 bool protocol_main_loop();
@@ -40,6 +52,12 @@ bool protocol_main_loop();
 bool protocol_execute_realtime();
 bool protocol_exec_rt_system();
 
+// Reads input lines into the line queue while a line waits for room in the planner buffer
+void protocol_read_ahead (void);
+
+// Returns the number of lines in the line queue, including the line being executed
+uint_fast8_t protocol_get_lines_queued (void);
+
 // Executes the auto cycle feature, if enabled.
 void protocol_auto_cycle_start();
 
@@ -48,6 +66,7 @@ void protocol_buffer_synchronize();
 
 bool protocol_process_realtime (char c);
 bool protocol_enqueue_gcode (char *data);
+bool protocol_enqueue_command (char *data, command_priority_t priority);
 void protocol_message (char *message);
 
 // work in progress...
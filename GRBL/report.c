@@ -31,7 +31,16 @@
 
 #include "grbl.h"
 
+#define RT_REPORT_SIZE (2 * (STRLEN_COORDVALUE + 1) * N_AXIS + 200) // Two sets of coordinates plus other fields
+
+// Realtime report assembled before it is written.
+typedef struct {
+    char data[RT_REPORT_SIZE];
+    uint_fast16_t length;
+} rt_report_t;
+
 static char buf[(STRLEN_COORDVALUE + 1) * N_AXIS];
+static rt_report_t rt_report;
 static char *(*get_axis_values)(float *axis_values);
 static char *(*get_rate_value)(float value);
 
@@ -57,6 +66,35 @@ char *appendbuf (int argc, ...)
     return buf;
 }
 
+// Appends a string to the realtime report, the report assembled so far is written out first if the
+// string does not fit. Passed to the driver as the stream write function for its report fields.
+static void rt_append (const char *s)
+{
+    char c, *d = &rt_report.data[rt_report.length], *end = &rt_report.data[RT_REPORT_SIZE - 1];
+    const char *start = s;
+
+    while((c = *s++)) {
+        if(d == end) {
+            // Report buffer full: write out what was assembled before this string and restart with it,
+            // or write the string directly if it does not fit in an empty buffer.
+            if(rt_report.length == 0) {
+                hal.stream.write_all(start);
+                return;
+            }
+            rt_report.data[rt_report.length] = '\0';
+            hal.stream.write_all(rt_report.data);
+            rt_report.length = 0;
+            s = start;
+            d = rt_report.data;
+            continue;
+        }
+        *d++ = c;
+    }
+
+    *d = '\0';
+    rt_report.length = d - rt_report.data;
+}
+
 // Convert axis position values to null terminated string (mm).
 static char *get_axis_values_mm (float *axis_values)
 {
@@ -163,6 +201,26 @@ void report_status_message (status_code_t status_code)
     }
 }
 
+#ifdef STREAM_WINDOWED_ACK
+
+// Acknowledges all lines up to and including the line with sequence number seq, status_code is that of the last
+// line. The number of free planner blocks and input buffer characters is appended as streaming credit.
+void report_stream_ack (status_code_t status_code, uint16_t seq)
+{
+    if(status_code == Status_OK)
+        hal.stream.write("ok:");
+    else
+        hal.stream.write(appendbuf(3, "error:", uitoa((uint32_t)status_code), ","));
+
+    hal.stream.write(uitoa((uint32_t)seq));
+    hal.stream.write(",");
+    hal.stream.write(uitoa((uint32_t)plan_get_block_buffer_available()));
+    hal.stream.write(",");
+    hal.stream.write(uitoa((uint32_t)hal.stream.get_rx_buffer_available()));
+    hal.stream.write("\r\n");
+}
+
+#endif
 
 // Prints alarm messages.
 void report_alarm_message (alarm_code_t alarm_code)
@@ -249,7 +307,7 @@ void report_init_message (void)
 // Grbl help message
 void report_grbl_help (void)
 {
-    hal.stream.write("[HLP:$$ $# $G $I $N $x=val $Nx=line $J=line $SLP $C $X $H $B ~ ! ? ctrl-x]\r\n");
+    hal.stream.write("[HLP:$$ $# $G $I $N $x=val $Nx=line $J=line $SLP $C $E $X $H $B ~ ! ? ctrl-x]\r\n");
 }
 
 
@@ -312,6 +370,9 @@ void report_grbl_settings (void)
     if(hal.driver_cap.spindle_sync || hal.driver_cap.spindle_pid)
         report_uint_setting(Setting_SpindlePPR, settings.spindle.ppr);
     report_uint_setting(Setting_LatheMode, settings.flags.lathe_mode);
+    report_float_setting(Setting_LineMergeTolerance, settings.line_merge_tolerance, N_DECIMAL_SETTINGVALUE);
+    report_uint_setting(Setting_PlannerBlocks, settings.planner_blocks);
+    report_uint_setting(Setting_SegmentBlocks, settings.segment_blocks);
 
     report_uint_setting(Setting_HomingLocateCycles, settings.homing.locate_cycles);
 
@@ -331,6 +392,11 @@ void report_grbl_settings (void)
     report_uint_setting(Setting_CheckLimitsAtInit, settings.limits.flags.check_at_init);
     report_uint_setting(Setting_HomingInitLock, settings.homing.flags.init_lock);
     report_uint_setting(Settings_Stream, (uint32_t)settings.stream);
+    if(hal.get_elapsed_ticks)
+        report_uint_setting(Setting_StatusReportInterval, settings.report_interval);
+#ifdef STATUS_FRAMES
+    report_uint_setting(Setting_StatusReportFrames, settings.report_frames);
+#endif
 
     if(hal.driver_cap.spindle_pid) {
         report_float_setting(Setting_SpindlePGain, settings.spindle.pid.p_gain, N_DECIMAL_SETTINGVALUE);
@@ -372,6 +438,10 @@ void report_grbl_settings (void)
                     report_float_setting((setting_type_t)(val + idx), -settings.max_travel[idx], N_DECIMAL_SETTINGVALUE);
                     break;
 
+                case AxisSetting_Jerk:
+                    report_float_setting((setting_type_t)(val + idx), settings.jerk[idx] / (60.0f * 60.0f * 60.0f), N_DECIMAL_SETTINGVALUE);
+                    break;
+
                 default:
                     if(hal.driver_settings_report)
                         hal.driver_settings_report(true, (axis_setting_type_t)set_idx, idx);
@@ -499,6 +569,9 @@ void report_gcode_modes (void)
 
     hal.stream.write(gc_state.canned.return_mode == CCReturnMode_RPos ? " G99" : " G98");
 
+    if(gc_state.modal.control == ControlMode_Continuous) // NOTE: G61 is default and not reported for compatibility.
+        hal.stream.write(" G64");
+
     hal.stream.write(gc_state.modal.scaling_active ? " G51" : " G50");
 
     if(gc_state.modal.scaling_active) {
@@ -670,7 +743,7 @@ void report_build_info (char *line)
     hal.stream.write(buf);
 
     // NOTE: Compiled values, like override increments/max/min values, may be added at some point later.
-    hal.stream.write(uitoa((uint32_t)(BLOCK_BUFFER_SIZE - 1)));
+    hal.stream.write(uitoa((uint32_t)(plan_get_block_buffer_size() - 1)));
     hal.stream.write(",");
     hal.stream.write(uitoa(hal.rx_buffer_size));
     hal.stream.write(",");
@@ -711,6 +784,18 @@ void report_build_info (char *line)
     strcat(buf, "PID,");
 #endif
 
+#ifdef MOTION_FRAMES
+    strcat(buf, "FRM,");
+#endif
+
+#ifdef STREAM_WINDOWED_ACK
+    strcat(buf, "ACK,");
+#endif
+
+#ifdef STATUS_FRAMES
+    strcat(buf, "SF,");
+#endif
+
     append = &buf[strlen(buf) - 1];
     if(*append == ',')
         *append = '\0';
@@ -748,50 +833,54 @@ void report_realtime_status (void)
     memcpy(current_position, sys_position, sizeof(sys_position));
     system_convert_array_steps_to_mpos(print_position, current_position);
 
+    rt_report.length = 0;
+
     // Report current machine state and sub-states
-    hal.stream.write_all("<");
+    rt_append("<");
 
     switch (sys.state) {
 
         case STATE_IDLE:
-            hal.stream.write_all("Idle");
+            rt_append("Idle");
             break;
 
         case STATE_CYCLE:
-            hal.stream.write_all("Run");
+            rt_append("Run");
             break;
 
         case STATE_HOLD:
-            hal.stream.write_all(appendbuf(2, "Hold:", uitoa((uint32_t)(sys.holding_state - 1))));
+            rt_append("Hold:");
+            rt_append(uitoa((uint32_t)(sys.holding_state - 1)));
             break;
 
         case STATE_JOG:
-            hal.stream.write_all("Jog");
+            rt_append("Jog");
             break;
 
         case STATE_HOMING:
-            hal.stream.write_all("Home");
+            rt_append("Home");
             break;
 
         case STATE_ESTOP:
         case STATE_ALARM:
-            hal.stream.write_all("Alarm");
+            rt_append("Alarm");
             break;
 
         case STATE_CHECK_MODE:
-            hal.stream.write_all("Check");
+            rt_append("Check");
             break;
 
         case STATE_SAFETY_DOOR:
-            hal.stream.write_all(appendbuf(2, "Door:", uitoa((uint32_t)sys.parking_state)));
+            rt_append("Door:");
+            rt_append(uitoa((uint32_t)sys.parking_state));
             break;
 
         case STATE_SLEEP:
-            hal.stream.write_all("Sleep");
+            rt_append("Sleep");
             break;
 
         case STATE_TOOL_CHANGE:
-            hal.stream.write_all("Tool");
+            rt_append("Tool");
             break;
     }
 
@@ -807,34 +896,55 @@ void report_realtime_status (void)
     }
 
     // Report position
-    hal.stream.write_all(settings.status_report.machine_position ? "|MPos:" : "|WPos:");
-    hal.stream.write_all(get_axis_values(print_position));
+    rt_append(settings.status_report.machine_position ? "|MPos:" : "|WPos:");
+    rt_append(get_axis_values(print_position));
 
     // Returns planner and output stream buffer states.
 
     if (settings.status_report.buffer_state) {
-        hal.stream.write_all("|Bf:");
-        hal.stream.write_all(uitoa((uint32_t)plan_get_block_buffer_available()));
-        hal.stream.write_all(",");
-        hal.stream.write_all(uitoa(hal.stream.get_rx_buffer_available()));
+        rt_append("|Bf:");
+        rt_append(uitoa((uint32_t)plan_get_block_buffer_available()));
+        rt_append(",");
+        rt_append(uitoa(hal.stream.get_rx_buffer_available()));
+#ifdef SEGMENT_BUFFER_STATS
+        st_segment_stats_t segment_stats;
+        st_get_segment_stats(&segment_stats);
+        rt_append("|SB:");
+        rt_append(uitoa((uint32_t)segment_stats.fill));
+        rt_append(",");
+        rt_append(uitoa((uint32_t)segment_stats.low));
+        rt_append(",");
+        rt_append(uitoa((uint32_t)segment_stats.high));
+        rt_append(",");
+        rt_append(uitoa(segment_stats.underruns));
+        rt_append(segment_stats.underrun ? ",U" : ",E");
+#endif
     }
 
     if(settings.status_report.line_numbers) {
         // Report current line number
         plan_block_t *cur_block = plan_get_current_block();
-        if (cur_block != NULL && cur_block->line_number > 0)
-            hal.stream.write_all(appendbuf(2, "|Ln:", uitoa((uint32_t)cur_block->line_number)));
+        if (cur_block != NULL && cur_block->line_number > 0) {
+            rt_append("|Ln:");
+            rt_append(uitoa((uint32_t)cur_block->line_number));
+        }
     }
 
     // Report realtime feed speed
     if(settings.status_report.feed_speed) {
         if(hal.driver_cap.variable_spindle) {
-            hal.stream.write_all(appendbuf(2, "|FS:", get_rate_value(st_get_realtime_rate())));
-            hal.stream.write_all(appendbuf(2, ",", ftoa(sys.spindle_rpm, N_DECIMAL_RPMVALUE)));
-            if(hal.spindle_get_data /* && sys.mpg_mode */)
-                hal.stream.write_all(appendbuf(2, ",", ftoa(hal.spindle_get_data(SpindleData_RPM).rpm, N_DECIMAL_RPMVALUE)));
-        } else
-            hal.stream.write_all(appendbuf(2, "|F:", get_rate_value(st_get_realtime_rate())));
+            rt_append("|FS:");
+            rt_append(get_rate_value(st_get_realtime_rate()));
+            rt_append(",");
+            rt_append(ftoa(sys.spindle_rpm, N_DECIMAL_RPMVALUE));
+            if(hal.spindle_get_data /* && sys.mpg_mode */) {
+                rt_append(",");
+                rt_append(ftoa(hal.spindle_get_data(SpindleData_RPM).rpm, N_DECIMAL_RPMVALUE));
+            }
+        } else {
+            rt_append("|F:");
+            rt_append(get_rate_value(st_get_realtime_rate()));
+        }
     }
 
     if(settings.status_report.pin_state) {
@@ -872,7 +982,7 @@ void report_realtime_status (void)
                     *append++ = 'T';
             }
             *append = '\0';
-            hal.stream.write_all(buf);
+            rt_append(buf);
         }
     }
 
@@ -887,8 +997,8 @@ void report_realtime_status (void)
                                       ? (REPORT_WCO_REFRESH_BUSY_COUNT - 1) // Reset counter for slow refresh
                                       : (REPORT_WCO_REFRESH_IDLE_COUNT - 1);
             sys.report.flags.add_report = Off; // Set override on next report.
-            hal.stream.write_all("|WCO:");
-            hal.stream.write_all(get_axis_values(wco));
+            rt_append("|WCO:");
+            rt_append(get_axis_values(wco));
         }
     }
 
@@ -898,9 +1008,12 @@ void report_realtime_status (void)
             sys.report.override_counter--;
         else if(sys.report.flags.add_report) {
 
-            hal.stream.write_all(appendbuf(2, "|Ov:", uitoa((uint32_t)sys.override.feed_rate)));
-            hal.stream.write_all(appendbuf(2, ",", uitoa((uint32_t)sys.override.rapid_rate)));
-            hal.stream.write_all(appendbuf(2, ",", uitoa((uint32_t)sys.override.spindle_rpm)));
+            rt_append("|Ov:");
+            rt_append(uitoa((uint32_t)sys.override.feed_rate));
+            rt_append(",");
+            rt_append(uitoa((uint32_t)sys.override.rapid_rate));
+            rt_append(",");
+            rt_append(uitoa((uint32_t)sys.override.spindle_rpm));
 
             spindle_state_t sp_state = hal.spindle_get_state();
             coolant_state_t cl_state = hal.coolant_get_state();
@@ -923,7 +1036,7 @@ void report_realtime_status (void)
                     *append++ = 'T';
 
                 *append = '\0';
-                hal.stream.write_all(buf);
+                rt_append(buf);
             }
 
             sys.report.override_counter = sys.state & (STATE_HOMING|STATE_CYCLE|STATE_HOLD|STATE_JOG|STATE_SAFETY_DOOR)
@@ -932,26 +1045,28 @@ void report_realtime_status (void)
 
         }
     } else if(gc_state.tool_change)
-        hal.stream.write_all("|A:T");
+        rt_append("|A:T");
 
     if(sys.report.flags.scaling) {
         axis_signals_tostring(buf, gc_get_g51_state());
-        hal.stream.write_all("|Sc:");
-        hal.stream.write_all(buf);
+        rt_append("|Sc:");
+        rt_append(buf);
         sys.report.flags.scaling = Off;
     }
 
     if(sys.report.flags.mpg_mode) {
-        hal.stream.write_all(sys.mpg_mode ? "|MPG:1" : "|MPG:0");
+        rt_append(sys.mpg_mode ? "|MPG:1" : "|MPG:0");
         sys.report.flags.mpg_mode = Off;
     }
 
     if(hal.driver_rt_report)
-        hal.driver_rt_report(hal.stream.write_all);
+        hal.driver_rt_report(rt_append);
 
     sys.report.flags.add_report = false;
 
-    hal.stream.write_all(">\r\n");
+    rt_append(">\r\n");
+
+    hal.stream.write_all(rt_report.data);
 }
 
 
@@ -981,3 +1096,66 @@ void report_pid_log (void)
     hal.report.status_message(Status_GcodeUnsupportedCommand);
 #endif
 }
+
+#ifdef STEPPER_ISR_STATS
+
+// Writes a cycle count as microseconds if the cycle counter frequency is known, as counts if not.
+static void report_cycles (const char *name, uint32_t cycles)
+{
+    hal.stream.write(name);
+    if(hal.f_cycle_counter)
+        hal.stream.write(ftoa((float)cycles * 1000000.0f / (float)hal.f_cycle_counter, 2));
+    else
+        hal.stream.write(uitoa(cycles));
+}
+
+// Prints stepper ISR execution times, in microseconds when the cycle counter frequency is known.
+// MaxRate is the ISR rate (Hz) that the longest execution time allows, the step rate ceiling.
+status_code_t report_stepper_isr_stats (void)
+{
+    st_isr_stats_t stats;
+
+    if(!st_get_isr_stats(&stats))
+        return Status_InvalidStatement;
+
+    hal.stream.write("[ISR:Count:");
+    hal.stream.write(uitoa(stats.count));
+    report_cycles("|Min:", stats.min);
+    report_cycles("|Avg:", stats.count ? (uint32_t)(stats.total / stats.count) : 0);
+    report_cycles("|Max:", stats.max);
+    hal.stream.write("|Segments:");
+    hal.stream.write(uitoa(stats.segments));
+    report_cycles("|SegmentMax:", stats.segment_max);
+    hal.stream.write("|Blocks:");
+    hal.stream.write(uitoa(stats.blocks));
+    report_cycles("|BlockMax:", stats.block_max);
+    if(hal.f_cycle_counter && stats.max) {
+        hal.stream.write("|MaxRate:");
+        hal.stream.write(uitoa(hal.f_cycle_counter / stats.max));
+    }
+    hal.stream.write("]\r\n");
+
+#ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+    uint_fast8_t level, levels = st_get_amass_levels();
+
+    hal.stream.write("[AMASS:Levels:");
+    hal.stream.write(uitoa(levels));
+    hal.stream.write("|Cutoff:");
+    for(level = 1; level <= levels; level++) {
+        if(level > 1)
+            hal.stream.write(",");
+        hal.stream.write(uitoa(st_get_amass_cutoff(level)));
+    }
+    hal.stream.write("|Segments:");
+    for(level = 0; level <= levels; level++) {
+        if(level)
+            hal.stream.write(",");
+        hal.stream.write(uitoa(stats.amass[level]));
+    }
+    hal.stream.write("]\r\n");
+#endif
+
+    return Status_OK;
+}
+
+#endif
@@ -30,6 +30,11 @@ void report_init (void);
 // Prints system status messages.
 void report_status_message (status_code_t status_code);
 
+#ifdef STREAM_WINDOWED_ACK
+// Prints cumulative acknowledgement of sequence numbered lines.
+void report_stream_ack (status_code_t status_code, uint16_t seq);
+#endif
+
 // Prints system alarm messages.
 void report_alarm_message (alarm_code_t alarm_code);
 
@@ -72,4 +77,9 @@ void report_build_info (char *line);
 // Prints current PID log.
 void report_pid_log (void);
 
+#ifdef STEPPER_ISR_STATS
+// Prints stepper ISR execution times.
+status_code_t report_stepper_isr_stats (void);
+#endif
+
 #endif
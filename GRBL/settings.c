@@ -24,6 +24,17 @@
 
 settings_t settings;
 
+// Compile time check that the global settings and the checksum fit in front of the tool table.
+#ifdef N_TOOLS
+typedef char settings_size_check_t[EEPROM_ADDR_GLOBAL + sizeof(settings_t) + 1 <= EEPROM_ADDR_TOOL_TABLE ? 1 : -1];
+#else
+typedef char settings_size_check_t[EEPROM_ADDR_GLOBAL + sizeof(settings_t) + 1 <= EEPROM_ADDR_PARAMETERS ? 1 : -1];
+#endif
+
+// Layout of version 14 settings, a prefix of the current settings struct.
+#define SETTINGS_V14_SIZE offsetof(settings_t, jerk)
+#define EEPROM_ADDR_TOOL_TABLE_V14 256U
+
 const settings_t defaults = {
 
     .version = SETTINGS_VERSION,
@@ -31,7 +42,10 @@ const settings_t defaults = {
     .stream = (stream_setting_t)DEFAULT_STREAM,
     .junction_deviation = DEFAULT_JUNCTION_DEVIATION,
     .arc_tolerance = DEFAULT_ARC_TOLERANCE,
+    .line_merge_tolerance = DEFAULT_LINE_MERGE_TOLERANCE,
     .g73_retract = DEFAULT_G73_RETRACT,
+    .planner_blocks = DEFAULT_PLANNER_BLOCKS,
+    .segment_blocks = DEFAULT_SEGMENT_BLOCKS,
 
     .flags.report_inches = DEFAULT_REPORT_INCHES,
     .flags.laser_mode = DEFAULT_LASER_MODE,
@@ -73,6 +87,8 @@ const settings_t defaults = {
     .status_report.pin_state = REPORT_FIELD_PIN_STATE,
     .status_report.work_coord_offset = REPORT_FIELD_WORK_COORD_OFFSET,
     .status_report.overrrides = REPORT_FIELD_OVERRIDES,
+    .report_interval = DEFAULT_STATUS_REPORT_INTERVAL,
+    .report_frames = DEFAULT_STATUS_REPORT_FRAMES,
 
     .limits.flags.hard_enabled = DEFAULT_HARD_LIMIT_ENABLE,
     .limits.flags.soft_enabled = DEFAULT_SOFT_LIMIT_ENABLE,
@@ -109,12 +125,16 @@ const settings_t defaults = {
     .max_travel[X_AXIS] = (-DEFAULT_X_MAX_TRAVEL),
     .max_travel[Y_AXIS] = (-DEFAULT_Y_MAX_TRAVEL),
     .max_travel[Z_AXIS] = (-DEFAULT_Z_MAX_TRAVEL),
+    .jerk[X_AXIS] = DEFAULT_X_JERK,
+    .jerk[Y_AXIS] = DEFAULT_Y_JERK,
+    .jerk[Z_AXIS] = DEFAULT_Z_JERK,
 
   #ifdef A_AXIS
     .steps_per_mm[A_AXIS] = DEFAULT_A_STEPS_PER_MM,
     .max_rate[A_AXIS] = DEFAULT_A_MAX_RATE,
     .acceleration[A_AXIS] = DEFAULT_A_ACCELERATION,
     .max_travel[A_AXIS] = (-DEFAULT_A_MAX_TRAVEL),
+    .jerk[A_AXIS] = DEFAULT_A_JERK,
     .homing.cycle[A_AXIS] = 0,
   #endif
   #ifdef B_AXIS
@@ -122,6 +142,7 @@ const settings_t defaults = {
     .max_rate[B_AXIS] = DEFAULT_B_MAX_RATE,
     .acceleration[B_AXIS] = DEFAULT_B_ACCELERATION,
     .max_travel[B_AXIS] = (-DEFAULT_B_MAX_TRAVEL),
+    .jerk[B_AXIS] = DEFAULT_B_JERK,
     .homing.cycle[B_AXIS] = 0,
   #endif
   #ifdef C_AXIS
@@ -129,6 +150,7 @@ const settings_t defaults = {
     .acceleration[C_AXIS] = DEFAULT_C_ACCELERATION,
     .max_rate[C_AXIS] = DEFAULT_C_MAX_RATE,
     .max_travel[C_AXIS] = (-DEFAULT_C_MAX_TRAVEL),
+    .jerk[C_AXIS] = DEFAULT_C_JERK,
     .homing.cycle[C_AXIS] = 0,
   #endif
 
@@ -264,6 +286,50 @@ void write_global_settings ()
     }
 }
 
+// Upgrade settings stored by version 14. Settings added since are set to their defaults and
+// the tool table and the driver areas below it are moved to their current addresses, other data is kept as is.
+// Returns false if the stored settings are not from version 14 or are corrupt.
+static bool settings_upgrade (void)
+{
+    if(hal.eeprom.type == EEPROM_None || hal.eeprom.get_byte(0) != 14)
+        return false;
+
+    memcpy(&settings, &defaults, sizeof(settings_t));
+
+    if(!hal.eeprom.memcpy_from_with_checksum((uint8_t *)&settings, EEPROM_ADDR_GLOBAL, SETTINGS_V14_SIZE))
+        return false;
+
+    settings.version = SETTINGS_VERSION;
+
+#ifdef N_TOOLS
+    // Tools are moved up, start from the last one so that none is overwritten before it is moved.
+    // Settings are written last as they may overlap the start of the old tool table.
+    uint_fast8_t idx = N_TOOLS;
+    tool_data_t tool_data;
+
+    do {
+        idx--;
+        if(!hal.eeprom.memcpy_from_with_checksum((uint8_t *)&tool_data, EEPROM_ADDR_TOOL_TABLE_V14 + idx * (sizeof(tool_data_t) + 1), sizeof(tool_data_t)))
+            memset(&tool_data, 0, sizeof(tool_data_t));
+        settings_write_tool_data(idx + 1, &tool_data);
+    } while(idx);
+#endif
+
+    // Driver areas are allocated below the tool table and have been moved up with it, copy the space
+    // between the old settings and the old tool table to its new location, last byte first as they overlap.
+    uint32_t addr = EEPROM_ADDR_TOOL_TABLE_V14;
+
+    do {
+        addr--;
+        hal.eeprom.put_byte(addr + EEPROM_ADDR_TOOL_TABLE - EEPROM_ADDR_TOOL_TABLE_V14, hal.eeprom.get_byte(addr));
+    } while(addr > EEPROM_ADDR_GLOBAL + SETTINGS_V14_SIZE + 1);
+
+    write_global_settings();
+    eeprom_emu_sync_physical();
+
+    return true;
+}
+
 
 // Restore Grbl global settings to defaults and write to persistent storage
 void settings_restore (uint8_t restore_flag) {
@@ -385,6 +451,11 @@ status_code_t settings_store_global_setting (uint_fast16_t parameter, char *sval
                 settings.max_travel[axis_idx] = -value; // Store as negative for grbl internal use.
                 break;
 
+            case AxisSetting_Jerk:
+                found = true;
+                settings.jerk[axis_idx] = value * 60.0f * 60.0f * 60.0f; // Convert to mm/min^3 for grbl internal use.
+                break;
+
             default: // for stopping compiler warning
                 break;
         }
@@ -440,6 +511,18 @@ status_code_t settings_store_global_setting (uint_fast16_t parameter, char *sval
                 settings.status_report.mask = int_value;
                 break;
 
+            case Setting_StatusReportInterval:
+                if(value > 0.0f && !hal.get_elapsed_ticks)
+                    return Status_SettingDisabled;
+                settings.report_interval = value <= 0.0f ? 0 : (value < (float)STATUS_REPORT_INTERVAL_MIN ? STATUS_REPORT_INTERVAL_MIN : (value > 65535.0f ? 65535 : (uint16_t)value));
+                break;
+
+          #ifdef STATUS_FRAMES
+            case Setting_StatusReportFrames:
+                settings.report_frames = int_value != 0;
+                break;
+          #endif
+
             case Setting_JunctionDeviation:
                 settings.junction_deviation = value;
                 break;
@@ -448,6 +531,18 @@ status_code_t settings_store_global_setting (uint_fast16_t parameter, char *sval
                 settings.arc_tolerance = value;
                 break;
 
+            case Setting_LineMergeTolerance:
+                settings.line_merge_tolerance = value;
+                break;
+
+            case Setting_PlannerBlocks: // Takes effect on restart
+                settings.planner_blocks = value < (float)PLANNER_BUFFER_MIN ? PLANNER_BUFFER_MIN : (value > (float)PLANNER_BUFFER_MAX ? PLANNER_BUFFER_MAX : (uint8_t)value);
+                break;
+
+            case Setting_SegmentBlocks: // Takes effect on restart
+                settings.segment_blocks = value < (float)SEGMENT_BUFFER_MIN ? SEGMENT_BUFFER_MIN : (value > (float)SEGMENT_BUFFER_MAX ? SEGMENT_BUFFER_MAX : (uint8_t)value);
+                break;
+
             case Setting_ReportInches:
                 settings.flags.report_inches = int_value != 0;
                 report_init();
@@ -692,7 +787,7 @@ status_code_t settings_store_global_setting (uint_fast16_t parameter, char *sval
 
 // Initialize the config subsystem
 void settings_init() {
-    if(!read_global_settings()) {
+    if(!(read_global_settings() || settings_upgrade())) {
         hal.report.status_message(Status_SettingReadFail);
         settings_restore(SETTINGS_RESTORE_ALL); // Force restore all EEPROM data.
         report_init();
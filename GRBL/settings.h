@@ -27,7 +27,7 @@
 
 // Version of the persistent storage data. Will be used to migrate existing data from older versions of Grbl
 // when firmware is upgraded. Always stored in byte 0 of eeprom
-#define SETTINGS_VERSION 14  // NOTE: Check settings_reset() when moving to next version.
+#define SETTINGS_VERSION 15  // NOTE: Check settings_upgrade() when moving to next version.
 
 // Define settings restore bitflags.
 #define SETTINGS_RESTORE_DEFAULTS bit(0)
@@ -42,9 +42,9 @@
 // Define persistent storage memory address location values for Grbl settings and parameters
 // NOTE: 1KB persistent storage is the minimum required. The upper half is reserved for parameters and
 // the startup script. The lower half contains the global settings and space for future
-// developments.
+// developments. Drivers may claim the space in front of the tool table for their settings.
 #define EEPROM_ADDR_GLOBAL         1U
-#define EEPROM_ADDR_TOOL_TABLE     256U
+#define EEPROM_ADDR_TOOL_TABLE     288U
 #define EEPROM_ADDR_PARAMETERS     512U
 #define EEPROM_ADDR_STARTUP_BLOCK  768U
 #define EEPROM_ADDR_BUILD_INFO     942U
@@ -81,7 +81,7 @@ typedef enum {
 #define N_COORDINATE_SYSTEMS (SettingIndex_NCoord - 3)  // Number of supported work coordinate systems (from index 1)
 
 // Define Grbl axis settings numbering scheme. Starts at Setting_AxisSettingsBase, every INCREMENT, over N_SETTINGS.
-#define AXIS_N_SETTINGS          4
+#define AXIS_N_SETTINGS          7
 #define AXIS_SETTINGS_INCREMENT  10  // Must be greater than the number of axis settings
 
 typedef enum {
@@ -122,6 +122,9 @@ typedef enum {
     Setting_StepperDeenergizeMask = 37,
     Setting_SpindlePPR = 38,
     Setting_LatheMode = 39,
+    Setting_LineMergeTolerance = 40,
+    Setting_PlannerBlocks = 41,
+    Setting_SegmentBlocks = 42,
 
     Setting_HomingLocateCycles = 43,
     Setting_HomingCycle_1 = 44,
@@ -146,6 +149,8 @@ typedef enum {
     Setting_CheckLimitsAtInit = 65,
     Setting_HomingInitLock = 66,
     Settings_Stream = 70,
+    Setting_StatusReportInterval = 71,
+    Setting_StatusReportFrames = 72,
 // Optional settings for closed loop spindle speed control
     Setting_SpindlePGain = 80,
     Setting_SpindleIGain = 81,
@@ -175,7 +180,8 @@ typedef enum {
     AxisSetting_Acceleration = 2,
     AxisSetting_MaxTravel = 3,
     AxisSetting_StepperCurrent = 4,
-    AxisSetting_MicroSteps = 5
+    AxisSetting_MicroSteps = 5,
+    AxisSetting_Jerk = 6
 } axis_setting_type_t;
 
 typedef enum {
@@ -341,6 +347,13 @@ typedef struct {
     limit_settings_t limits;
     parking_settings_t parking;
     position_pid_t position; // Used for synchronized motion
+    // Settings added in version 15, new settings are added at the end so that older versions are a prefix of the struct
+    float jerk[N_AXIS];         // 0 if axis is not jerk limited
+    float line_merge_tolerance; // 0 disables merging of collinear lines
+    uint16_t report_interval;   // Automatic status report interval in ms, 0 = disabled
+    uint8_t planner_blocks;     // Size of planner buffer, allocated at startup
+    uint8_t segment_blocks;     // Size of step segment buffer, allocated at startup
+    bool report_frames;         // Push binary status frames instead of status reports
 } settings_t;
 
 // Setting structs that may be used by driver
@@ -0,0 +1,242 @@
+/*
+  status_frame.c - binary realtime status frames
+
+  Part of Grbl
+
+  Copyright (c) 2019 Terje Io
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "grbl.h"
+
+#ifdef STATUS_FRAMES
+
+#define STATUS_FRAME_MAX_SIZE (2 + 2 + 1 + N_AXIS * 4 + 3 + 2 * 4 + 4 + 4 + 1 + N_AXIS * 4 + 2 + 2) // Bytes
+
+// Values sent in the last frame, fields not sent are compared against these.
+typedef struct {
+    uint8_t state;
+    uint8_t substate;
+    int32_t position[N_AXIS];
+    uint8_t planner;
+    uint16_t rx;
+    float feed_rate;
+    float rpm;
+    int32_t line_number;
+    uint8_t override[3];
+    uint8_t accessories;
+    float wco[N_AXIS];
+    uint8_t limits;
+    uint8_t control;
+} status_values_t;
+
+static uint8_t sequence = 0;
+static status_values_t last;
+
+static uint8_t *put_value (uint8_t *data, uint32_t value, uint_fast8_t bytes)
+{
+    while(bytes--) {
+        *data++ = (uint8_t)value;
+        value >>= 8;
+    }
+
+    return data;
+}
+
+static uint8_t *put_float (uint8_t *data, float value)
+{
+    uint32_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+
+    return put_value(data, bits, 4);
+}
+
+static status_frame_state_t get_state (uint8_t *substate)
+{
+    status_frame_state_t state = StatusFrame_Idle;
+
+    *substate = 0;
+
+    switch (sys.state) {
+
+        case STATE_CYCLE:
+            state = StatusFrame_Run;
+            break;
+
+        case STATE_HOLD:
+            state = StatusFrame_Hold;
+            *substate = (uint8_t)(sys.holding_state - 1);
+            break;
+
+        case STATE_JOG:
+            state = StatusFrame_Jog;
+            break;
+
+        case STATE_HOMING:
+            state = StatusFrame_Home;
+            break;
+
+        case STATE_ESTOP:
+        case STATE_ALARM:
+            state = StatusFrame_Alarm;
+            break;
+
+        case STATE_CHECK_MODE:
+            state = StatusFrame_Check;
+            break;
+
+        case STATE_SAFETY_DOOR:
+            state = StatusFrame_Door;
+            *substate = (uint8_t)sys.parking_state;
+            break;
+
+        case STATE_SLEEP:
+            state = StatusFrame_Sleep;
+            break;
+
+        case STATE_TOOL_CHANGE:
+            state = StatusFrame_Tool;
+            break;
+    }
+
+    return state;
+}
+
+// Adds a bit mask of changed axes followed by their values, all axes for a key frame.
+// Values are 32 bit, int32_t or float. Returns NULL if no axis has changed.
+static uint8_t *put_axes (uint8_t *data, const void *values, void *last_values, bool key)
+{
+    uint_fast8_t idx;
+    uint32_t value, last_value;
+    uint8_t *axes = data++;
+
+    *axes = 0;
+
+    for(idx = 0; idx < N_AXIS; idx++) {
+        memcpy(&value, (const uint32_t *)values + idx, sizeof(uint32_t));
+        memcpy(&last_value, (uint32_t *)last_values + idx, sizeof(uint32_t));
+        if(key || value != last_value) {
+            *axes |= bit(idx);
+            memcpy((uint32_t *)last_values + idx, &value, sizeof(uint32_t));
+            data = put_value(data, value, 4);
+        }
+    }
+
+    return *axes ? data : NULL;
+}
+
+void status_frame_report (void)
+{
+    char line[4 + ((STATUS_FRAME_MAX_SIZE + 2) / 3) * 4 + 4];
+    uint8_t data[STATUS_FRAME_MAX_SIZE], *end = &data[2], *next;
+    uint_fast8_t idx;
+    bool key;
+    status_frame_fields_t fields = {0};
+
+    if((key = sys.report.frame_counter == 0))
+        sys.report.frame_counter = STATUS_FRAME_KEY_INTERVAL - 1;
+    else
+        sys.report.frame_counter--;
+
+    uint8_t substate, state = (uint8_t)get_state(&substate);
+    if(key || state != last.state || substate != last.substate) {
+        fields.state = On;
+        *end++ = last.state = state;
+        *end++ = last.substate = substate;
+    }
+
+    int32_t position[N_AXIS];
+    memcpy(position, sys_position, sizeof(sys_position));
+    if((next = put_axes(end, position, last.position, key))) {
+        fields.position = On;
+        end = next;
+    }
+
+    if(settings.status_report.buffer_state) {
+        uint8_t planner = plan_get_block_buffer_available();
+        uint16_t rx = hal.stream.get_rx_buffer_available();
+        if(key || planner != last.planner || rx != last.rx) {
+            fields.buffers = On;
+            *end++ = last.planner = planner;
+            end = put_value(end, last.rx = rx, 2);
+        }
+    }
+
+    if(settings.status_report.feed_speed) {
+        float feed_rate = st_get_realtime_rate();
+        if(key || feed_rate != last.feed_rate || sys.spindle_rpm != last.rpm) {
+            fields.feed_speed = On;
+            end = put_float(end, last.feed_rate = feed_rate);
+            end = put_float(end, last.rpm = sys.spindle_rpm);
+        }
+    }
+
+    if(settings.status_report.line_numbers) {
+        plan_block_t *cur_block = plan_get_current_block();
+        int32_t line_number = cur_block ? cur_block->line_number : 0;
+        if(key || line_number != last.line_number) {
+            fields.line_number = On;
+            end = put_value(end, (uint32_t)(last.line_number = line_number), 4);
+        }
+    }
+
+    if(settings.status_report.overrrides) {
+        spindle_state_t sp_state = hal.spindle_get_state();
+        coolant_state_t cl_state = hal.coolant_get_state();
+        uint8_t accessories = (sp_state.on ? bit(0) : 0) | (sp_state.on && sp_state.ccw ? bit(1) : 0) |
+                               (cl_state.flood ? bit(2) : 0) | (cl_state.mist ? bit(3) : 0) | (gc_state.tool_change ? bit(4) : 0);
+        if(key || sys.override.feed_rate != last.override[0] || sys.override.rapid_rate != last.override[1] ||
+                   sys.override.spindle_rpm != last.override[2] || accessories != last.accessories) {
+            fields.overrides = On;
+            *end++ = last.override[0] = sys.override.feed_rate;
+            *end++ = last.override[1] = sys.override.rapid_rate;
+            *end++ = last.override[2] = sys.override.spindle_rpm;
+            *end++ = last.accessories = accessories;
+        }
+    }
+
+    if(settings.status_report.work_coord_offset) {
+        float wco[N_AXIS];
+        for (idx = 0; idx < N_AXIS; idx++)
+            wco[idx] = gc_state.modal.coord_system.xyz[idx] + gc_state.g92_coord_offset[idx] + gc_state.tool_length_offset[idx];
+        if((next = put_axes(end, wco, last.wco, key))) {
+            fields.wco = On;
+            end = next;
+        }
+    }
+
+    if(settings.status_report.pin_state) {
+        uint8_t limits = hal.limits_get_state().value;
+        uint8_t control = (hal.system_control_get_state().value & 0x7F) | (hal.probe_get_state && hal.probe_get_state() ? bit(7) : 0);
+        if(key || limits != last.limits || control != last.control) {
+            fields.signals = On;
+            *end++ = last.limits = limits;
+            *end++ = last.control = control;
+        }
+    }
+
+    data[0] = (sequence++ & 0x7F) | (key ? STATUS_FRAME_KEY : 0);
+    data[1] = fields.value;
+    end = put_value(end, motion_frame_crc(data, end - data), 2);
+
+    strcpy(line, "[SF:");
+    idx = 4 + motion_frame_base64_encode(data, end - data, &line[4]);
+    strcpy(&line[idx], "]\r\n");
+
+    hal.stream.write_all(line);
+}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+  status_frame.h - binary realtime status frames
+
+  Part of Grbl
+
+  Copyright (c) 2019 Terje Io
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  A status frame is a compact alternative to the realtime status report. It is sent on the
+  CMD_STATUS_FRAME realtime command, or pushed in place of the status report when $71 and $72
+  are set, as a line of base64 encoded bytes:
+
+    [SF:<base64>]
+
+  Frame layout, multi byte values are little endian, floats are IEEE 754 single precision:
+
+    uint8_t  sequence       Bits 0 - 6: incremented by one for each frame sent, wraps. Bit 7: key frame
+    uint8_t  fields         status_frame_fields_t, fields present in the frame in the order below
+    uint8_t  state          status_frame_state_t                                   | state
+    uint8_t  substate       Hold or door substate as reported by Hold:<n> or Door:<n>
+    uint8_t  axes           Bit mask of axes with a position value, bit 0 is X    | position
+    int32_t  position[]     Machine position in steps, one for each bit set in axes
+    uint8_t  planner        Free planner blocks                                    | buffers
+    uint16_t rx             Free input buffer characters
+    float    feed_rate      Current feed rate, mm/min                              | feed_speed
+    float    rpm            Programmed spindle speed
+    int32_t  line_number    Line number of executing block, 0 if none              | line_number
+    uint8_t  feed_override  %                                                      | overrides
+    uint8_t  rapid_override %
+    uint8_t  rpm_override   %
+    uint8_t  accessories    bit 0: spindle on, 1: CCW, 2: flood, 3: mist, 4: tool change pending
+    uint8_t  axes           Bit mask of axes with a WCO value, bit 0 is X          | wco
+    float    wco[]          Work coordinate offset, mm, one for each bit set in axes
+    uint8_t  limits         Limit switch inputs, bit 0 is X                        | signals
+    uint8_t  control        bit 0: reset, 1: feed hold, 2: cycle start, 3: door, 4: block delete,
+                            5: optional stop, 6: E-stop, 7: probe
+    uint16_t crc            CRC-16/CCITT-FALSE of all the preceding bytes, as for motion frames
+
+  Only fields and axes that have changed since the previous frame are sent, except for key frames
+  which carry all fields and axes enabled by the $10 status report mask. A key frame is sent every
+  STATUS_FRAME_KEY_INTERVAL frames and as the first frame after a reset. A receiver that detects a
+  gap in the sequence should discard its values until the next key frame.
+*/
+
+#ifndef status_frame_h
+#define status_frame_h
+
+#define STATUS_FRAME_KEY 0x80 // Key frame flag in sequence byte
+
+typedef enum {
+    StatusFrame_Idle = 0,
+    StatusFrame_Run = 1,
+    StatusFrame_Hold = 2,
+    StatusFrame_Jog = 3,
+    StatusFrame_Home = 4,
+    StatusFrame_Alarm = 5,
+    StatusFrame_Check = 6,
+    StatusFrame_Door = 7,
+    StatusFrame_Sleep = 8,
+    StatusFrame_Tool = 9
+} status_frame_state_t;
+
+typedef union {
+    uint8_t value;
+    struct {
+        uint8_t state       :1,
+                position    :1,
+                buffers     :1,
+                feed_speed  :1,
+                line_number :1,
+                overrides   :1,
+                wco         :1,
+                signals     :1;
+    };
+} status_frame_fields_t;
+
+// Sends a status frame, called on the CMD_STATUS_FRAME realtime command.
+void status_frame_report (void);
+
+#endif
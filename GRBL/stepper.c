@@ -46,33 +46,70 @@ typedef union {
     };
 } prep_flags_t;
 
+// Jerk limited (S-curve) speed ramp, see planner.c for the definition.
+typedef struct {
+    bool active;
+    float mm_start;         // Start of ramp measured from end of block (mm)
+    float mm_end;           // End of ramp measured from end of block (mm)
+    float speed_start;      // (mm/min)
+    float speed_end;        // (mm/min)
+    float duration;         // (min)
+    float time;             // Time elapsed since start of ramp (min)
+    float t_jerk;           // Duration of each of the jerk phases (min)
+    float jerk;             // Signed, negative when decelerating (mm/min^3)
+    float acceleration;     // Signed peak acceleration (mm/min^2)
+    ramp_type_t next;       // Ramp state to enter when completed
+} s_curve_t;
+
 // Holds the planner block Bresenham algorithm execution data for the segments in the segment
 // buffer. Normally, this buffer is partially in-use, but, for the worst case scenario, it will
-// never exceed the number of accessible stepper buffer segments (SEGMENT_BUFFER_SIZE-1).
+// never exceed the number of accessible stepper buffer segments (segment_buffer_size - 1).
 // NOTE: This data is copied from the prepped planner blocks so that the planner blocks may be
 // discarded when entirely consumed and completed by the segment buffer. Also, AMASS alters this
 // data for its own use.
-static st_block_t st_block_buffer[SEGMENT_BUFFER_SIZE - 1];
+static st_block_t st_block_buffer_default[SEGMENT_BUFFER_SIZE - 1];
+static st_block_t *st_block_buffer = NULL;
 
 // Primary stepper segment ring buffer. Contains small, short line segments for the stepper
 // algorithm to execute, which are "checked-out" incrementally from the first block in the
 // planner buffer. Once "checked-out", the steps in the segments buffer cannot be modified by
 // the planner, where the remaining planner block steps still can.
-static segment_t segment_buffer[SEGMENT_BUFFER_SIZE];
+static segment_t segment_buffer_default[SEGMENT_BUFFER_SIZE];
+static segment_t *segment_buffer = NULL;
+static uint_fast8_t segment_buffer_size;    // Number of segments, both buffers are allocated at startup if larger than default
+#ifdef STEP_PATTERN_OUTPUT
+static axes_signals_t pattern_default[SEGMENT_BUFFER_SIZE * STEP_PATTERN_MAX_TICKS];
+#endif
 
 // Stepper ISR data struct. Contains the running data for the main stepper ISR.
 static stepper_t st;
 
 #ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
 typedef struct {
-    uint32_t level_1;
-    uint32_t level_2;
-    uint32_t level_3;
+    uint_fast8_t levels;                // Number of levels in use
+    uint32_t cutoff[MAX_AMASS_LEVEL];   // Step timer cycles per step where level n + 1 starts
 } amass_t;
 
 static amass_t amass;
 #endif
 
+#ifdef STEPPER_ISR_STATS
+typedef enum {
+    ISRLoad_None = 0,
+    ISRLoad_Segment,
+    ISRLoad_Block
+} isr_load_t;
+
+static volatile st_isr_stats_t isr_stats;
+static volatile bool isr_stats_reset = true;
+#endif
+
+#ifdef SEGMENT_BUFFER_STATS
+static volatile uint32_t segment_underruns = 0;
+static volatile bool segment_underrun = false;
+static uint_fast8_t segment_fill_low = UINT8_MAX, segment_fill_high = 0;
+#endif
+
 // Stepper timer ticks per minute
 static float cycles_per_min;
 
@@ -108,10 +145,20 @@ typedef struct {
     float exit_speed;       // Exit speed of executing block (mm/min)
     float accelerate_until; // Acceleration ramp end measured from end of block (mm)
     float decelerate_after; // Deceleration ramp start measured from end of block (mm)
+    float jerk;             // Jerk of executing block, 0 for trapezoidal profiles (mm/min^3)
+    s_curve_t s_curve;      // Current jerk limited ramp
     float target_position;  //
     float target_feed;      //
     float inv_feedrate;     // Used by PWM laser mode to speed up segment calculations.
     float current_spindle_rpm;
+#ifdef STEP_PATTERN_OUTPUT
+    st_block_t *pattern_block;  // Block of the last segment traced, Bresenham counters are reset on a new block
+    uint32_t counter[N_AXIS];   // Bresenham counters at the end of the last segment traced
+#endif
+#ifdef ADAPTIVE_SEGMENT_TIME
+    float buffer_time;          // Execution time of segments in the segment buffer (min)
+    uint_fast8_t time_tail;     // Segment buffer tail when buffer_time was last updated
+#endif
 } st_prep_t;
 
 static st_prep_t prep;
@@ -240,13 +287,95 @@ ISR_CODE void st_go_idle ()
    which for Grbl must be less than 33.3usec (@30kHz ISR rate). Oscilloscope measured time in
    ISR is 5usec typical and 25usec maximum, well below requirement.
    NOTE: This ISR expects at least one step to be executed per segment.
+   NOTE: Enable STEPPER_ISR_STATS in config.h to measure execution times, reported by $T.
 */
+
+#ifdef STEPPER_ISR_STATS
+
+// Records ISR execution time, called on ISR exit.
+ISR_CODE static inline void isr_stats_update (uint32_t start, isr_load_t load)
+{
+    uint32_t cycles = hal.get_cycle_count() - start;
+
+    if(isr_stats_reset) {
+        memset((void *)&isr_stats, 0, sizeof(st_isr_stats_t));
+        isr_stats.min = UINT32_MAX;
+        isr_stats_reset = false;
+    }
+
+    isr_stats.count++;
+    isr_stats.total += cycles;
+
+    if(cycles < isr_stats.min)
+        isr_stats.min = cycles;
+
+    if(cycles > isr_stats.max)
+        isr_stats.max = cycles;
+
+    if(load != ISRLoad_None) {
+        isr_stats.segments++;
+      #ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+        isr_stats.amass[st.amass_level]++;
+      #endif
+        if(load == ISRLoad_Block) {
+            isr_stats.blocks++;
+            if(cycles > isr_stats.block_max)
+                isr_stats.block_max = cycles;
+        } else if(cycles > isr_stats.segment_max)
+            isr_stats.segment_max = cycles;
+    }
+}
+
+// Copies the ISR statistics, retries if modified by the ISR while copying.
+bool st_get_isr_stats (st_isr_stats_t *stats)
+{
+    if(hal.get_cycle_count == NULL)
+        return false;
+
+    do {
+        memcpy(stats, (void *)&isr_stats, sizeof(st_isr_stats_t));
+    } while(stats->count != isr_stats.count);
+
+    if(stats->count == 0 || isr_stats_reset)
+        memset(stats, 0, sizeof(st_isr_stats_t));
+
+    return true;
+}
+
+void st_reset_isr_stats (void)
+{
+    isr_stats_reset = true;
+}
+
+#endif
+
 ISR_CODE void stepper_driver_interrupt_handler (void)
 {
+#ifdef STEPPER_ISR_STATS
+    isr_load_t load = ISRLoad_None;
+    uint32_t start = hal.get_cycle_count ? hal.get_cycle_count() : 0;
+#endif
+
     // Start a step pulse when there is a block to execute.
     if(st.exec_block)
         hal.stepper_pulse_start(&st);
 
+#ifdef STEP_PATTERN_OUTPUT
+    // A step pattern has been played out by the driver, update position and discard the segment.
+    if (st.exec_segment && st.exec_segment->pattern_ticks) {
+        uint_fast8_t idx = N_AXIS;
+        do {
+            idx--;
+            if(st.dir_outbits.value & bit(idx))
+                sys_position[idx] -= st.exec_segment->pattern_steps[idx];
+            else
+                sys_position[idx] += st.exec_segment->pattern_steps[idx];
+        } while(idx);
+        st.exec_segment = NULL;
+        segment_buffer_tail = segment_buffer_tail == (segment_buffer_size - 1) ? 0 : segment_buffer_tail + 1;
+    }
+#endif
+
     // If there is no step segment, attempt to pop one from the stepper buffer
     if (st.exec_segment == NULL) {
         // Anything in the buffer? If so, load and initialize next step segment.
@@ -259,9 +388,17 @@ ISR_CODE void stepper_driver_interrupt_handler (void)
             hal.stepper_cycles_per_tick(st.exec_segment->cycles_per_tick);
             st.step_count = st.exec_segment->n_step; // NOTE: Can sometimes be zero when moving slow.
 
+          #ifdef STEPPER_ISR_STATS
+            load = ISRLoad_Segment;
+          #endif
+
             // If the new segment starts a new planner block, initialize stepper variables and counters.
             if (st.exec_block != st.exec_segment->exec_block) {
 
+              #ifdef STEPPER_ISR_STATS
+                load = ISRLoad_Block;
+              #endif
+
                 st.exec_block = st.exec_segment->exec_block;
                 st.step_event_count = st.exec_block->step_event_count;
                 st.dir_outbits = st.exec_block->direction_bits;
@@ -289,6 +426,16 @@ ISR_CODE void stepper_driver_interrupt_handler (void)
               #ifndef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
                 memcpy(st.steps, st.exec_block->steps, sizeof(st.steps));
               #endif
+
+              #ifdef LASER_RASTER
+                // Pixel changes are traced as steps of an extra axis, starting with power for the first pixel.
+                st.raster_counter = st.raster_pixel = 0;
+               #ifndef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+                st.raster_steps = st.exec_block->raster_steps;
+               #endif
+                if(st.exec_block->raster)
+                    hal.spindle_update_rpm(st.exec_block->raster_rpm * (float)st.exec_block->raster->power[0]);
+              #endif
             }
 
           #ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
@@ -306,12 +453,50 @@ ISR_CODE void stepper_driver_interrupt_handler (void)
            #ifdef C_AXIS
             st.steps[C_AXIS] = st.exec_block->steps[C_AXIS] >> st.amass_level;
            #endif
+           #ifdef LASER_RASTER
+            st.raster_steps = st.exec_block->raster_steps >> st.amass_level;
+           #endif
          #endif
 
             if(st.exec_segment->update_rpm)
                 hal.spindle_update_rpm(st.exec_segment->spindle_rpm);
 
+          #ifdef STEP_PATTERN_OUTPUT
+            // Hand precomputed step patterns over to the driver, the handler is called again when completed.
+            if(st.exec_segment->pattern_ticks) {
+                st.step_outbits.value = 0;
+                hal.stepper_pattern_start(&st);
+              #ifdef STEPPER_ISR_STATS
+                if(hal.get_cycle_count)
+                    isr_stats_update(start, load);
+              #endif
+                return;
+            }
+
+            // Otherwise load the Bresenham counters tracked by the segment generator.
+            st.counter_x = st.exec_segment->counter[X_AXIS];
+            st.counter_y = st.exec_segment->counter[Y_AXIS];
+            st.counter_z = st.exec_segment->counter[Z_AXIS];
+           #ifdef A_AXIS
+            st.counter_a = st.exec_segment->counter[A_AXIS];
+           #endif
+           #ifdef B_AXIS
+            st.counter_b = st.exec_segment->counter[B_AXIS];
+           #endif
+           #ifdef C_AXIS
+            st.counter_c = st.exec_segment->counter[C_AXIS];
+           #endif
+          #endif
+
         } else {
+
+          #ifdef SEGMENT_BUFFER_STATS
+            // Motion remains if the segment generator is part way through a planner block, or has not
+            // yet loaded the next one, unless it stopped at the end of a feed hold or system motion.
+            if((segment_underrun = !sys.step_control.end_motion && (pl_block != NULL || plan_get_current_block() != NULL)))
+                segment_underruns++;
+          #endif
+
             // Segment buffer empty. Shutdown.
             st_go_idle();
             // Ensure pwm is set properly upon completion of rate-controlled motion.
@@ -320,6 +505,11 @@ ISR_CODE void stepper_driver_interrupt_handler (void)
 
             system_set_exec_state_flag(EXEC_CYCLE_COMPLETE); // Flag main program for cycle complete
 
+          #ifdef STEPPER_ISR_STATS
+            if(hal.get_cycle_count)
+                isr_stats_update(start, load);
+          #endif
+
             return; // Nothing to do but exit.
         }
     }
@@ -385,6 +575,17 @@ ISR_CODE void stepper_driver_interrupt_handler (void)
       }
   #endif
 
+#ifdef LASER_RASTER
+    // Set laser power when the next pixel is entered, the laser is switched off at the end of the raster.
+    if (st.raster_steps && (st.raster_counter += st.raster_steps) >= st.step_event_count) {
+        st.raster_counter -= st.step_event_count;
+        if (st.raster_pixel < st.exec_block->raster->pixels)
+            hal.spindle_update_rpm(++st.raster_pixel == st.exec_block->raster->pixels
+                                    ? 0.0f
+                                    : st.exec_block->raster_rpm * (float)st.exec_block->raster->power[st.raster_pixel]);
+    }
+#endif
+
     st.step_outbits.value = step_outbits.value;
 
     // During a homing cycle, lock out and prevent desired axes from moving.
@@ -394,8 +595,71 @@ ISR_CODE void stepper_driver_interrupt_handler (void)
     if (st.step_count == 0 || --st.step_count == 0) {
         // Segment is complete. Discard current segment and advance segment indexing.
         st.exec_segment = NULL;
-        segment_buffer_tail = segment_buffer_tail == (SEGMENT_BUFFER_SIZE - 1) ? 0 : segment_buffer_tail + 1;
+        segment_buffer_tail = segment_buffer_tail == (segment_buffer_size - 1) ? 0 : segment_buffer_tail + 1;
+    }
+
+#ifdef STEPPER_ISR_STATS
+    if(hal.get_cycle_count)
+        isr_stats_update(start, load);
+#endif
+}
+
+// Allocates the step segment buffer and the stepper block buffer, called once at startup before st_reset().
+// Up to SEGMENT_BUFFER_SIZE segments the static buffers are used, the heap only for larger sizes as many
+// driver projects have a small heap.
+// Returns false if not enough memory is available for the requested number of segments.
+bool st_alloc_buffer (uint_fast8_t segments)
+{
+    segment_t *segment;
+    st_block_t *block;
+    bool is_default = segments <= SEGMENT_BUFFER_SIZE;
+
+    if(segments < SEGMENT_BUFFER_MIN)
+        return false;
+
+    if(is_default) {
+        segment = segment_buffer_default;
+        block = st_block_buffer_default;
+    } else {
+        if((segment = calloc(segments, sizeof(segment_t))) == NULL)
+            return false;
+        if((block = calloc(segments - 1, sizeof(st_block_t))) == NULL) {
+            free(segment);
+            return false;
+        }
+    }
+
+#ifdef STEP_PATTERN_OUTPUT
+    axes_signals_t *pattern = NULL;
+
+    if(hal.stepper_pattern_start) {
+        if(is_default)
+            pattern = pattern_default;
+        else if((pattern = calloc(segments * STEP_PATTERN_MAX_TICKS, sizeof(axes_signals_t))) == NULL) {
+            free(block);
+            free(segment);
+            return false;
+        }
+    }
+
+    if(segment_buffer && segment_buffer[0].pattern && segment_buffer[0].pattern != pattern_default)
+        free(segment_buffer[0].pattern);
+
+    uint_fast8_t idx;
+    for(idx = 0; idx < segments; idx++)
+        segment[idx].pattern = pattern ? &pattern[idx * STEP_PATTERN_MAX_TICKS] : NULL;
+#endif
+
+    if(segment_buffer && segment_buffer != segment_buffer_default) {
+        free(segment_buffer);
+        free(st_block_buffer);
     }
+
+    segment_buffer = segment;
+    st_block_buffer = block;
+    segment_buffer_size = segments;
+
+    return true;
 }
 
 // Reset and clear stepper subsystem variables
@@ -408,13 +672,19 @@ void st_reset ()
 
     // Set up stepper block ringbuffer as circular linked list and add id
     uint_fast8_t idx;
-    for(idx = 0 ; idx <= SEGMENT_BUFFER_SIZE - 2 ; idx++) {
-        st_block_buffer[idx].next = &st_block_buffer[idx == SEGMENT_BUFFER_SIZE - 2 ? 0 : idx + 1];
+    for(idx = 0 ; idx <= segment_buffer_size - 2 ; idx++) {
+        st_block_buffer[idx].next = &st_block_buffer[idx == segment_buffer_size - 2 ? 0 : idx + 1];
         st_block_buffer[idx].id = idx + 1;
+#ifdef LASER_RASTER
+        if(st_block_buffer[idx].raster) {
+            free(st_block_buffer[idx].raster);
+            st_block_buffer[idx].raster = NULL;
+        }
+#endif
     }
 
     // Add id to segment buffer enteries
-    for(idx = 0 ; idx <= SEGMENT_BUFFER_SIZE - 1 ; idx++) {
+    for(idx = 0 ; idx <= segment_buffer_size - 1 ; idx++) {
         segment_buffer[idx].id = idx + 1;
         segment_buffer[idx].amass_level = 0;
     }
@@ -430,12 +700,13 @@ void st_reset ()
     segment_next_head = 1;
 
 #ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
-    // TODO: move to driver?
     // AMASS_LEVEL0: Normal operation. No AMASS. No upper cutoff frequency. Starts at LEVEL1 cutoff frequency.
-    // Defined as step timer frequency / Cutoff frequency in Hz
-    amass.level_1 = hal.f_step_timer / 8000;
-    amass.level_2 = hal.f_step_timer / 4000;
-    amass.level_3 = hal.f_step_timer / 2000;
+    // Level n cutoff frequency is the maximum ISR rate / 2^n, defined as step timer frequency / cutoff frequency in Hz.
+    uint32_t isr_rate = hal.f_step_isr_max ? hal.f_step_isr_max : AMASS_ISR_RATE_MAX;
+
+    amass.levels = 0;
+    while(amass.levels < hal.driver_cap.amass_level && (isr_rate >>= 1))
+        amass.cutoff[amass.levels++] = hal.f_step_timer / isr_rate;
 #endif
 
     cycles_per_min = (float)hal.f_step_timer * 60.0f;
@@ -445,12 +716,29 @@ void st_reset ()
     hal.stepper_set_directions(st.dir_outbits);
 }
 
+#ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+
+uint_fast8_t st_get_amass_levels (void)
+{
+    return amass.levels;
+}
+
+uint32_t st_get_amass_cutoff (uint_fast8_t level)
+{
+    return level > 0 && level <= amass.levels ? hal.f_step_timer / amass.cutoff[level - 1] : 0;
+}
+
+#endif
+
 // Called by planner_recalculate() when the executing block is updated by the new plan.
 void st_update_plan_block_parameters ()
 {
     if (pl_block != NULL) { // Ignore if at start of a new block.
         prep.recalculate.recalculate = On;
         pl_block->entry_speed_sqr = prep.current_speed * prep.current_speed; // Update entry speed.
+      #ifdef PLANNER_FIXED_POINT
+        pl_block->entry_speed_sqr_fx = plan_fx(pl_block->entry_speed_sqr);
+      #endif
         pl_block = NULL; // Flag st_prep_segment() to load and check active velocity profile.
     }
 }
@@ -490,6 +778,227 @@ void st_parking_restore_buffer()
     pl_block = NULL; // Set to reload next block.
 }
 
+// Returns the speed reached when decelerating from speed over the given distance in a single jerk limited ramp.
+// NOTE: ramp distance is not monotonic in the end speed, a bisection search is used to find a solution.
+//       min_speed must be a speed not reachable within the distance.
+static float s_curve_exit_speed (float speed, float min_speed, float distance)
+{
+    float exit_speed = speed;
+    uint_fast8_t iterations = 16;
+
+    do {
+        float mid_speed = 0.5f * (min_speed + exit_speed);
+        if (plan_ramp_distance(pl_block, mid_speed, speed) > distance)
+            min_speed = mid_speed;
+        else
+            exit_speed = mid_speed;
+    } while(--iterations);
+
+    return exit_speed; // Ramp distance <= distance.
+}
+
+// Computes the velocity profile of a jerk limited block, the same profile types as for the trapezoidal
+// profiles in st_prep_buffer() are used but ramp distances are computed with the jerk aware relations
+// of the planner. Entry speed is the current speed.
+static void s_curve_compute_profile (void)
+{
+    if (sys.step_control.execute_hold) { // [Forced Deceleration to Zero Velocity]
+        prep.ramp_type = Ramp_Decel;
+        float decel_dist = pl_block->millimeters - plan_ramp_distance(pl_block, 0.0f, prep.current_speed);
+        if (decel_dist < 0.0f) // Deceleration through entire planner block. End of feed hold is not in this block.
+            prep.exit_speed = s_curve_exit_speed(prep.current_speed, 0.0f, pl_block->millimeters);
+        else {
+            prep.mm_complete = decel_dist; // End of feed hold.
+            prep.exit_speed = 0.0f;
+        }
+        return;
+    }
+
+    // [Normal Operation]
+    prep.ramp_type = Ramp_Accel; // Initialize as acceleration ramp.
+    prep.exit_speed = sys.step_control.execute_sys_motion ? 0.0f : sqrtf(plan_get_exec_block_exit_speed_sqr());
+
+    float nominal_speed = plan_compute_profile_nominal_speed(pl_block);
+
+    prep.target_feed = nominal_speed;
+
+    if (prep.current_speed > nominal_speed) { // Only occurs during override reductions.
+        float decel_dist = plan_ramp_distance(pl_block, nominal_speed, prep.current_speed);
+        if (decel_dist >= pl_block->millimeters) { // Deceleration-only.
+            prep.ramp_type = Ramp_Decel;
+            prep.exit_speed = s_curve_exit_speed(prep.current_speed, nominal_speed, pl_block->millimeters);
+            prep.recalculate.decel_override = On; // Flag to load next block as deceleration override.
+        } else { // Decelerate to cruise or cruise-decelerate types.
+            prep.accelerate_until = pl_block->millimeters - decel_dist;
+            prep.decelerate_after = plan_ramp_distance(pl_block, prep.exit_speed, nominal_speed);
+            prep.maximum_speed = nominal_speed;
+            prep.ramp_type = Ramp_DecelOverride;
+        }
+    } else {
+        float accel_dist = plan_ramp_distance(pl_block, prep.current_speed, nominal_speed);
+        float decel_dist = plan_ramp_distance(pl_block, prep.exit_speed, nominal_speed);
+        if (accel_dist + decel_dist <= pl_block->millimeters) { // Trapezoid type, possibly without acceleration and/or deceleration.
+            prep.accelerate_until = pl_block->millimeters - accel_dist;
+            prep.decelerate_after = decel_dist;
+            prep.maximum_speed = nominal_speed;
+            if (accel_dist == 0.0f)
+                prep.ramp_type = Ramp_Cruise;
+        } else {
+            // Triangle, acceleration-only or deceleration-only type. Search for the peak speed
+            // where the acceleration and deceleration ramps fits in the block.
+            float peak_speed = max(prep.current_speed, prep.exit_speed);
+            if (plan_ramp_distance(pl_block, prep.current_speed, peak_speed) + plan_ramp_distance(pl_block, prep.exit_speed, peak_speed) < pl_block->millimeters) {
+                uint_fast8_t iterations = 12;
+                do {
+                    float mid_speed = 0.5f * (peak_speed + nominal_speed);
+                    if (plan_ramp_distance(pl_block, prep.current_speed, mid_speed) + plan_ramp_distance(pl_block, prep.exit_speed, mid_speed) > pl_block->millimeters)
+                        nominal_speed = mid_speed;
+                    else
+                        peak_speed = mid_speed;
+                } while(--iterations);
+            }
+            prep.maximum_speed = peak_speed;
+            if (peak_speed == prep.current_speed) // Deceleration-only type.
+                prep.ramp_type = Ramp_Decel;
+            else {
+                // Any slack is added to the deceleration ramp.
+                prep.accelerate_until = pl_block->millimeters - plan_ramp_distance(pl_block, prep.current_speed, peak_speed);
+                if (prep.accelerate_until < 0.0f)
+                    prep.accelerate_until = 0.0f;
+                prep.decelerate_after = prep.accelerate_until;
+            }
+        }
+    }
+}
+
+// Starts a jerk limited ramp from the current speed and position, ending at the given position and speed.
+// Ramp time is given by the distance and the mean speed, peak acceleration is the lowest that
+// reaches the end speed within that time when acceleration is changed at the jerk limit.
+static void s_curve_start (float mm_start, float mm_end, float speed_end, ramp_type_t next)
+{
+    float dv = fabsf(speed_end - prep.current_speed), sum = prep.current_speed + speed_end;
+
+    prep.s_curve.active = true;
+    prep.s_curve.next = next;
+    prep.s_curve.time = 0.0f;
+    prep.s_curve.mm_start = mm_start;
+    prep.s_curve.mm_end = mm_end;
+    prep.s_curve.speed_start = prep.current_speed;
+    prep.s_curve.speed_end = speed_end;
+    prep.s_curve.duration = sum > 0.0f ? 2.0f * (mm_start - mm_end) / sum : 0.0f;
+
+    if (dv == 0.0f || prep.s_curve.duration <= 0.0f)
+        prep.s_curve.t_jerk = prep.s_curve.jerk = prep.s_curve.acceleration = 0.0f;
+    else {
+        float jt = prep.jerk * prep.s_curve.duration, discriminant = jt * jt - 4.0f * prep.jerk * dv;
+        if (discriminant > 0.0f) {
+            prep.s_curve.acceleration = 0.5f * (jt - sqrtf(discriminant));
+            prep.s_curve.t_jerk = prep.s_curve.acceleration / prep.jerk;
+            prep.s_curve.jerk = prep.jerk;
+        } else { // Distance is marginally short due to round-off, jerk slightly exceeds the limit.
+            prep.s_curve.t_jerk = 0.5f * prep.s_curve.duration;
+            prep.s_curve.acceleration = dv / prep.s_curve.t_jerk;
+            prep.s_curve.jerk = prep.s_curve.acceleration / prep.s_curve.t_jerk;
+        }
+        if (speed_end < prep.current_speed) {
+            prep.s_curve.acceleration = -prep.s_curve.acceleration;
+            prep.s_curve.jerk = -prep.s_curve.jerk;
+        }
+    }
+}
+
+// Returns the distance travelled since the start of the ramp at the given time and updates the current speed.
+static float s_curve_distance (float t)
+{
+    float distance;
+    s_curve_t *ramp = &prep.s_curve;
+
+    if (t <= ramp->t_jerk) { // Increasing acceleration
+        prep.current_speed = ramp->speed_start + 0.5f * ramp->jerk * t * t;
+        distance = t * (ramp->speed_start + ramp->jerk * t * t / 6.0f);
+    } else if (t < ramp->duration - ramp->t_jerk) { // Constant acceleration
+        float speed = ramp->speed_start + 0.5f * ramp->jerk * ramp->t_jerk * ramp->t_jerk;
+        t -= ramp->t_jerk;
+        prep.current_speed = speed + ramp->acceleration * t;
+        distance = ramp->t_jerk * (ramp->speed_start + ramp->jerk * ramp->t_jerk * ramp->t_jerk / 6.0f) +
+                    t * (speed + 0.5f * ramp->acceleration * t);
+    } else { // Decreasing acceleration, computed backwards from the end of the ramp.
+        t = ramp->duration - t;
+        prep.current_speed = ramp->speed_end - 0.5f * ramp->jerk * t * t;
+        distance = ramp->mm_start - ramp->mm_end - t * (ramp->speed_end - ramp->jerk * t * t / 6.0f);
+    }
+
+    return distance;
+}
+
+#ifdef STEP_PATTERN_OUTPUT
+
+// Traces the Bresenham line for a segment the same way as the stepper ISR does, starting from the counters
+// at the end of the previous segment. Records the step outputs per tick as a pattern if the driver can play
+// it out, if not only the counters are advanced and recorded for the stepper ISR to start from.
+static void st_prep_pattern (segment_t *segment)
+{
+    uint_fast8_t idx;
+    uint_fast16_t tick, ticks = segment->n_step ? segment->n_step : 1; // The ISR executes one tick for zero step segments.
+    uint32_t steps[N_AXIS], step_event_count = st_prep_block->step_event_count;
+
+    if (prep.pattern_block != st_prep_block) {
+        prep.pattern_block = st_prep_block;
+        idx = N_AXIS;
+        do {
+            prep.counter[--idx] = step_event_count >> 1;
+        } while(idx);
+    }
+
+    idx = N_AXIS;
+    do {
+        idx--;
+      #ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+        steps[idx] = st_prep_block->steps[idx] >> segment->amass_level;
+      #else
+        steps[idx] = st_prep_block->steps[idx];
+      #endif
+    } while(idx);
+
+    memcpy(segment->counter, prep.counter, sizeof(prep.counter));
+
+    if (hal.stepper_pattern_start == NULL || ticks > STEP_PATTERN_MAX_TICKS || segment->spindle_sync ||
+         sys.state == STATE_HOMING || sys_probe_state == Probe_Active
+#ifdef LASER_RASTER
+          || st_prep_block->raster
+#endif
+       ) {
+        // Output by the stepper ISR, advance counters to the end of the segment.
+        // NOTE: Counters stay within 1 to step_event_count as at most one step is taken per tick.
+        segment->pattern_ticks = 0;
+        idx = N_AXIS;
+        do {
+            idx--;
+            uint64_t counter = (uint64_t)prep.counter[idx] + (uint64_t)ticks * steps[idx];
+            prep.counter[idx] = (uint32_t)(counter - ((counter - 1) / step_event_count) * step_event_count);
+        } while(idx);
+    } else {
+        axes_signals_t step_outbits;
+        segment->pattern_ticks = ticks;
+        memset(segment->pattern_steps, 0, sizeof(segment->pattern_steps));
+        for(tick = 0; tick < ticks; tick++) {
+            step_outbits.value = 0;
+            idx = N_AXIS;
+            do {
+                idx--;
+                if ((prep.counter[idx] += steps[idx]) > step_event_count) {
+                    step_outbits.value |= bit(idx);
+                    prep.counter[idx] -= step_event_count;
+                    segment->pattern_steps[idx]++;
+                }
+            } while(idx);
+            segment->pattern[tick] = step_outbits;
+        }
+    }
+}
+
+#endif
+
 /* Prepares step segment buffer. Continuously called from main program.
 
    The segment buffer is an intermediary buffer interface between the execution of steps
@@ -509,13 +1018,27 @@ void st_prep_buffer()
     if (sys.step_control.end_motion)
         return;
 
+#ifdef SEGMENT_BUFFER_STATS
+    // Record the fill level the stepper ISR has drained the buffer to when motion is ongoing.
+    if(sys.state == STATE_CYCLE && (pl_block != NULL || plan_get_current_block() != NULL)) {
+        uint_fast8_t fill = segment_buffer_head >= segment_buffer_tail
+                             ? segment_buffer_head - segment_buffer_tail
+                             : segment_buffer_size - segment_buffer_tail + segment_buffer_head;
+        if(fill < segment_fill_low)
+            segment_fill_low = fill;
+        if(fill > segment_fill_high)
+            segment_fill_high = fill;
+    }
+#endif
+
     while (segment_buffer_tail != segment_next_head) { // Check if we need to fill the buffer.
 
         // Determine if we need to load a new planner block or if the block needs to be recomputed.
         if (pl_block == NULL) {
 
-            // Query planner for a queued block
+            // Query planner for a queued block, any pending override change is applied to the plan first.
 
+            plan_apply_overrides();
             pl_block = sys.step_control.execute_sys_motion ? plan_get_system_motion_block() : plan_get_current_block();
 
             if (pl_block == NULL)
@@ -536,6 +1059,10 @@ void st_prep_buffer()
                 // when the segment buffer completes the planner block, it may be discarded when the
                 // segment buffer finishes the prepped block, but the stepper ISR is still executing it.
 
+              #ifdef LASER_RASTER
+                bool raster_end = st_prep_block->raster != NULL;
+              #endif
+
                 st_prep_block = st_prep_block->next;
 
                 uint_fast8_t idx = N_AXIS;
@@ -572,15 +1099,45 @@ void st_prep_buffer()
                     // New block loaded mid-hold. Override planner block entry speed to enforce deceleration.
                     prep.current_speed = prep.exit_speed;
                     pl_block->entry_speed_sqr = prep.exit_speed * prep.exit_speed;
+                  #ifdef PLANNER_FIXED_POINT
+                    pl_block->entry_speed_sqr_fx = plan_fx(pl_block->entry_speed_sqr);
+                  #endif
                     prep.recalculate.decel_override = Off;
-                } else
+                } else {
+                  #ifdef PLANNER_FIXED_POINT
+                    pl_block->entry_speed_sqr = plan_fx_to_float(pl_block->entry_speed_sqr_fx); // Planned in fixed point.
+                  #endif
                     prep.current_speed = sqrtf(pl_block->entry_speed_sqr);
+                }
 
                 // Setup laser mode variables. PWM rate adjusted motions will always complete a motion with the
                 // spindle off.
                 if ((st_prep_block->dynamic_rpm = pl_block->condition.is_rpm_rate_adjusted || pl_block->condition.is_rpm_pos_adjusted))
                     // Pre-compute inverse programmed rate to speed up PWM updating per step segment.
                     prep.inv_feedrate = pl_block->condition.is_laser_ppi_mode ? 1.0f : 1.0f / pl_block->programmed_rate;
+
+              #ifdef LASER_RASTER
+                // Take over the raster from the planner block, it is freed when the stepper block is reused.
+                // Power is set per pixel by the stepper ISR and restored for the first block after a raster.
+                if(st_prep_block->raster)
+                    free(st_prep_block->raster);
+                if((st_prep_block->raster = pl_block->raster)) {
+                    pl_block->raster = NULL;
+                    st_prep_block->dynamic_rpm = false;
+                    if(st_prep_block->raster->pixels > pl_block->step_event_count)
+                        st_prep_block->raster->pixels = pl_block->step_event_count;
+                  #ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+                    st_prep_block->raster_steps = st_prep_block->raster->pixels << MAX_AMASS_LEVEL;
+                  #else
+                    st_prep_block->raster_steps = st_prep_block->raster->pixels << 1;
+                  #endif
+                    st_prep_block->raster_rpm = pl_block->condition.spindle.on ? spindle_set_rpm(pl_block->spindle.rpm, sys.override.spindle_rpm) / 255.0f : 0.0f;
+                } else {
+                    st_prep_block->raster_steps = 0;
+                    if(raster_end)
+                        sys.step_control.update_spindle_rpm = On;
+                }
+              #endif
             }
 
             /* ---------------------------------------------------------------------------------
@@ -590,9 +1147,12 @@ void st_prep_buffer()
              hold, override the planner velocities and decelerate to the target exit speed.
             */
             prep.mm_complete = 0.0f; // Default velocity profile complete at 0.0mm from end of block.
+            prep.s_curve.active = false;
             float inv_2_accel = 0.5f / pl_block->acceleration;
 
-            if (sys.step_control.execute_hold) { // [Forced Deceleration to Zero Velocity]
+            if ((prep.jerk = pl_block->jerk) > 0.0f) // [Jerk limited]
+                s_curve_compute_profile();
+            else if (sys.step_control.execute_hold) { // [Forced Deceleration to Zero Velocity]
                 // Compute velocity profile parameters for a feed hold in-progress. This profile overrides
                 // the planner block profile, enforcing a deceleration to zero speed.
                 prep.ramp_type = Ramp_Decel;
@@ -700,6 +1260,24 @@ void st_prep_buffer()
           such as from a feed hold.
         */
         float dt_max = DT_SEGMENT; // Maximum segment time
+
+#ifdef ADAPTIVE_SEGMENT_TIME
+        // Remove the time of segments executed since last segment from the buffered time.
+        while(prep.time_tail != segment_buffer_tail) {
+            prep.buffer_time -= segment_buffer[prep.time_tail].dt;
+            prep.time_tail = prep.time_tail == (segment_buffer_size - 1) ? 0 : prep.time_tail + 1;
+        }
+        if(prep.time_tail == segment_buffer_head)
+            prep.buffer_time = 0.0f; // Buffer is empty, clear any accumulated round-off.
+
+        if(!(sys.step_control.execute_hold || sys.step_control.execute_sys_motion || pl_block->condition.spindle.synchronized)) {
+            if(prep.ramp_type == Ramp_Cruise)
+                dt_max = DT_SEGMENT * SEGMENT_TIME_CRUISE_SCALE;
+            else if(prep.buffer_time >= (float)(segment_buffer_size - 1) * DT_SEGMENT * 0.5f)
+                dt_max = DT_SEGMENT / SEGMENT_TIME_RAMP_SCALE;
+        }
+#endif
+
         float dt = 0.0f; // Initialize segment time
         float time_var = dt_max; // Time worker variable
         float mm_var; // mm - Distance worker variable
@@ -712,7 +1290,32 @@ void st_prep_buffer()
 
         do {
 
-            switch (prep.ramp_type) {
+            if (prep.jerk > 0.0f && prep.ramp_type != Ramp_Cruise) {
+                // Jerk limited acceleration or deceleration ramp, speed and distance are computed from the ramp time.
+                if (!prep.s_curve.active) switch (prep.ramp_type) {
+
+                    case Ramp_Accel:
+                        s_curve_start(mm_remaining, prep.accelerate_until, prep.maximum_speed,
+                                       prep.accelerate_until == prep.decelerate_after ? Ramp_Decel : Ramp_Cruise);
+                        break;
+
+                    case Ramp_DecelOverride:
+                        s_curve_start(mm_remaining, prep.accelerate_until, prep.maximum_speed, Ramp_Cruise);
+                        break;
+
+                    default: // case Ramp_Decel:
+                        s_curve_start(mm_remaining, prep.mm_complete, prep.exit_speed, Ramp_Decel);
+                        break;
+                }
+                if ((prep.s_curve.time += time_var) >= prep.s_curve.duration) { // End of ramp.
+                    time_var -= prep.s_curve.time - prep.s_curve.duration;
+                    mm_remaining = prep.s_curve.mm_end;
+                    prep.current_speed = prep.s_curve.speed_end;
+                    prep.ramp_type = prep.s_curve.next;
+                    prep.s_curve.active = false;
+                } else
+                    mm_remaining = prep.s_curve.mm_start - s_curve_distance(prep.s_curve.time);
+            } else switch (prep.ramp_type) {
 
                 case Ramp_DecelOverride:
                     speed_var = pl_block->acceleration * time_var;
@@ -776,6 +1379,12 @@ void st_prep_buffer()
 
             dt += time_var; // Add computed ramp time to total segment time.
 
+#ifdef ADAPTIVE_SEGMENT_TIME
+            // End a lengthened cruise segment early when it runs into a ramp.
+            if (dt_max > DT_SEGMENT && prep.ramp_type != Ramp_Cruise)
+                dt_max = dt > DT_SEGMENT ? dt : DT_SEGMENT;
+#endif
+
             if (dt < dt_max)
                 time_var = dt_max - dt;// **Incomplete** At ramp junction.
             else {
@@ -794,6 +1403,15 @@ void st_prep_buffer()
            Compute spindle spindle speed for step segment
         */
 
+#ifdef LASER_RASTER
+        if (st_prep_block->raster) {
+            // Power is set per pixel by the stepper ISR, spindle override changes are applied to the pixel scale.
+            if (sys.step_control.update_spindle_rpm) {
+                st_prep_block->raster_rpm = pl_block->condition.spindle.on ? spindle_set_rpm(pl_block->spindle.rpm, sys.override.spindle_rpm) / 255.0f : 0.0f;
+                sys.step_control.update_spindle_rpm = Off;
+            }
+        } else
+#endif
         if (sys.step_control.update_spindle_rpm || st_prep_block->dynamic_rpm) {
             if (pl_block->condition.spindle.on) {
                 // NOTE: Feed and rapid overrides are independent of PWM value and do not alter laser power/rate.
@@ -868,10 +1486,11 @@ void st_prep_buffer()
       #ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
         // Compute step timing and multi-axis smoothing level.
         // NOTE: AMASS overdrives the timer with each level, so only one prescalar is required.
-        if (cycles < amass.level_1)
-            prep_segment->amass_level = 0;
-        else {
-            prep_segment->amass_level = cycles < amass.level_2 ? 1 : (cycles < amass.level_3 ? 2 : 3);
+        prep_segment->amass_level = 0;
+        while(prep_segment->amass_level < amass.levels && cycles >= amass.cutoff[prep_segment->amass_level])
+            prep_segment->amass_level++;
+
+        if(prep_segment->amass_level) {
             cycles >>= prep_segment->amass_level;
             prep_segment->n_step <<= prep_segment->amass_level;
         }
@@ -879,9 +1498,18 @@ void st_prep_buffer()
 
         prep_segment->cycles_per_tick = cycles;
 
+      #ifdef STEP_PATTERN_OUTPUT
+        st_prep_pattern(prep_segment);
+      #endif
+
+      #ifdef ADAPTIVE_SEGMENT_TIME
+        prep_segment->dt = dt;
+        prep.buffer_time += dt;
+      #endif
+
         // Segment complete! Increment segment buffer indices, so stepper ISR can immediately execute it.
         segment_buffer_head = segment_next_head;
-        segment_next_head = segment_next_head == (SEGMENT_BUFFER_SIZE - 1) ? 0 : segment_next_head + 1;
+        segment_next_head = segment_next_head == (segment_buffer_size - 1) ? 0 : segment_next_head + 1;
 
         // Update the appropriate planner and segment data.
         pl_block->millimeters = mm_remaining;
@@ -914,6 +1542,29 @@ void st_prep_buffer()
 }
 
 
+#ifdef SEGMENT_BUFFER_STATS
+
+void st_get_segment_stats (st_segment_stats_t *stats)
+{
+    uint_fast8_t tail = segment_buffer_tail;
+
+    stats->underruns = segment_underruns;
+    stats->underrun = segment_underrun;
+    stats->fill = segment_buffer_head >= tail ? segment_buffer_head - tail : segment_buffer_size - tail + segment_buffer_head;
+
+    if(segment_fill_low > segment_fill_high)
+        stats->low = stats->high = stats->fill; // No motion since last call.
+    else {
+        stats->low = segment_fill_low;
+        stats->high = segment_fill_high;
+    }
+
+    segment_fill_low = UINT8_MAX;
+    segment_fill_high = 0;
+}
+
+#endif
+
 // Called by realtime status reporting to fetch the current speed being executed. This value
 // however is not exactly the current speed, but the speed computed in the last step segment
 // in the segment buffer. It will always be behind by up to the number of segment blocks (-1)
@@ -29,6 +29,10 @@
   #define SEGMENT_BUFFER_SIZE 10
 #endif
 
+// The minimum and maximum number of segments that can be configured for the step segment buffer
+#define SEGMENT_BUFFER_MIN 3
+#define SEGMENT_BUFFER_MAX 255
+
 // Holds the planner block Bresenham algorithm execution data for the segments in the segment buffer.
 // NOTE: This data is copied from the prepped planner blocks so that the planner blocks may be
 // discarded when entirely consumed and completed by the segment buffer. Also, AMASS alters this
@@ -44,6 +48,11 @@ typedef struct st_block {
     float programmed_rate;
     char *message;                  // Message to be displayed when block is executed
     bool dynamic_rpm;               // Tracks motions that require dynamic RPM adjustment
+#ifdef LASER_RASTER
+    laser_raster_t *raster;         // Pixel power to output, NULL if none
+    uint32_t raster_steps;          // Number of pixels scaled as axis steps for the Bresenham line tracer
+    float raster_rpm;               // RPM per pixel power unit, spindle override applied
+#endif
 } st_block_t;
 
 typedef struct {
@@ -57,6 +66,15 @@ typedef struct {
     bool spindle_sync;              // True if block is spindle synchronized
     bool cruising;                  // True when in cruising part of profile, only set for spindle synced moves
     uint_fast8_t amass_level;       // Indicates AMASS level for the ISR to execute this segment
+#ifdef ADAPTIVE_SEGMENT_TIME
+    float dt;                       // Segment execution time (min), used by the segment generator only
+#endif
+#ifdef STEP_PATTERN_OUTPUT
+    axes_signals_t *pattern;        // Step outputs for each timer tick of the segment
+    uint_fast16_t pattern_ticks;    // Number of ticks in pattern, 0 if the segment is output by the stepper ISR
+    uint_fast16_t pattern_steps[N_AXIS]; // Steps per axis in pattern, for position update
+    uint32_t counter[N_AXIS];       // Bresenham counters at start of segment
+#endif
 } segment_t;
 
 // Stepper ISR data struct. Contains the running data for the main stepper ISR.
@@ -83,6 +101,11 @@ typedef struct {
 //    uint_fast16_t spindle_pwm;
     uint_fast16_t step_count;       // Steps remaining in line segment motion
     uint32_t step_event_count;
+#ifdef LASER_RASTER
+    uint32_t raster_counter;        // Bresenham counter for pixel changes
+    uint32_t raster_steps;          // Raster pixel increment for this segment, 0 if no raster
+    uint_fast16_t raster_pixel;     // Index of pixel being output
+#endif
     st_block_t *exec_block;         // Pointer to the block data for the segment being executed
     segment_t *exec_segment;        // Pointer to the segment being executed
 } stepper_t;
@@ -96,6 +119,9 @@ void st_wake_up();
 // Immediately disables steppers
 void st_go_idle();
 
+// Allocate the step segment buffer, called once at startup. Returns false if out of memory.
+bool st_alloc_buffer(uint_fast8_t segments);
+
 // Reset the stepper subsystem variables
 void st_reset();
 
@@ -114,6 +140,57 @@ void st_update_plan_block_parameters();
 // Called by realtime status reporting if realtime rate reporting is enabled in config.h.
 float st_get_realtime_rate();
 
+#ifdef SEGMENT_BUFFER_STATS
+
+// Segment buffer fill levels and underruns.
+typedef struct {
+    uint32_t underruns;             // Number of times the segment buffer ran empty before the end of motion
+    bool underrun;                  // True if the last stop was an underrun, false if at end of motion
+    uint_fast8_t fill;              // Number of segments in the buffer
+    uint_fast8_t low;               // Lowest fill level seen by the segment generator during motion
+    uint_fast8_t high;              // Highest fill level seen by the segment generator during motion
+} st_segment_stats_t;
+
+// Copies the segment buffer statistics, fill levels are reset to the current fill level on each call.
+void st_get_segment_stats (st_segment_stats_t *stats);
+
+#endif
+
+#ifdef STEPPER_ISR_STATS
+
+// Stepper ISR execution times, in hal.get_cycle_count() counts.
+typedef struct {
+    uint32_t count;                 // Number of ISR invocations
+    uint32_t min;                   // Shortest execution time
+    uint32_t max;                   // Longest execution time
+    uint64_t total;                 // Sum of execution times
+    uint32_t segments;              // Number of segment loads, including those starting a new block
+    uint32_t segment_max;           // Longest execution time when loading a segment of the current block
+    uint32_t blocks;                // Number of segment loads starting a new block
+    uint32_t block_max;             // Longest execution time when starting a new block, includes AMASS rescale and message enqueue
+#ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+    uint32_t amass[MAX_AMASS_LEVEL + 1]; // Number of segment loads per AMASS level
+#endif
+} st_isr_stats_t;
+
+// Copies the stepper ISR statistics, returns false if the driver does not provide a cycle counter.
+bool st_get_isr_stats (st_isr_stats_t *stats);
+
+// Clears the stepper ISR statistics, takes effect on next ISR invocation.
+void st_reset_isr_stats (void);
+
+#endif
+
+#ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+
+// Returns the number of AMASS levels in use.
+uint_fast8_t st_get_amass_levels (void);
+
+// Returns the cutoff frequency (Hz) below which the given AMASS level (1 - levels in use) is used.
+uint32_t st_get_amass_cutoff (uint_fast8_t level);
+
+#endif
+
 void stepper_driver_interrupt_handler (void);
 
 #endif
@@ -150,6 +150,26 @@ status_code_t system_execute_line (char *line)
                 retval = Status_IdleError;
             break;
 
+        case 'E': // Set job time estimation mode [IDLE/CHECK]
+            if (line[2] != '\0')
+                retval = Status_InvalidStatement;
+            else if (sys.state == STATE_CHECK_MODE) {
+                // Report times for motions executed since the last program end, if any, and reset as for $C.
+                if(sys.estimate) {
+                    protocol_buffer_synchronize();
+                    estimator_report();
+                }
+                mc_reset();
+                hal.report.feedback_message(Message_Disabled);
+            } else if (sys.state == STATE_IDLE) { // Requires idle mode.
+                estimator_start();
+                sys.estimate = true;
+                set_state(STATE_CHECK_MODE);
+                hal.report.feedback_message(Message_Enabled);
+            } else
+                retval = Status_IdleError;
+            break;
+
         case 'X': // Disable alarm lock [ALARM]
             if (line[2] != '\0' )
                 retval = Status_InvalidStatement;
@@ -351,6 +371,17 @@ status_code_t system_execute_line (char *line)
                 retval = Status_IdleError;
             break;
 
+#ifdef STEPPER_ISR_STATS
+        case 'T': // Print or clear stepper ISR statistics
+            if (line[2] == '\0')
+                retval = report_stepper_isr_stats();
+            else if (line[2] == 'R' && line[3] == '\0')
+                st_reset_isr_stats();
+            else
+                retval = Status_InvalidStatement;
+            break;
+#endif
+
 #ifdef DEBUGOUT
         case 'Q':
             hal.stream.write(uitoa((uint32_t)sizeof(settings_t)));
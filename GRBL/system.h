@@ -40,6 +40,7 @@
 #define EXEC_SLEEP          bit(8)
 #define EXEC_TOOL_CHANGE    bit(9)
 #define EXEC_PID_REPORT     bit(10)
+#define EXEC_STATUS_FRAME   bit(11)
 
 // Define system state bit map. The state variable primarily tracks the individual functions
 // of Grbl to manage each without overlapping. It is also used as a messaging flag for
@@ -179,6 +180,7 @@ typedef union {
 typedef struct {
     int8_t override_counter;        // Tracks when to add override data to status reports.
     uint8_t wco_counter;            // Tracks when to add work coordinate offset data to status reports.
+    uint8_t frame_counter;          // Tracks when to send a status frame with all fields, 0 for next frame.
     report_tracking_flags_t flags;  // Tracks when to add assorted info to status reports.
 } report_tracking_t;
 
@@ -200,6 +202,7 @@ typedef struct {
     bool mpg_mode;                      // MPG mode flag. Set when switched to secondary input stream.
     bool soft_limit;                    // Tracks soft limit errors for the state machine. (boolean)
     bool block_delete_enabled;          // Set to true to enable block delete
+    bool estimate;                      // Check mode runs motions through the planner for job time estimation ($E)
     volatile bool steppers_deenergize;	// Set to true to deenergize stepperes
     bool probe_succeeded;               // Tracks if last probing cycle was successful.
     bool suspend;                       // System suspend state flag.
@@ -0,0 +1,138 @@
+#!/usr/bin/env python
+"""\
+
+Randomized g-code corpus generator for parser differential checks
+
+Writes a reproducible mix of lines to stdout, mostly CAM style motion
+lines with X, Y, Z, F and N words and the modal changes that affect
+how they are interpreted: units, distance mode, coordinate systems,
+G92 and tool length offsets, planes, feed rate modes, arcs, spindle
+and tool words. Erroneous lines (repeated, unused, unknown or negative
+words, missing feed rates and axis words) and $G and $# reports are
+interspersed so that error codes, the modal state and the offsets are
+compared as well. The same seed always gives the same corpus:
+
+  gcode_corpus.py [lines [seed]] > corpus.nc
+
+See drivers/Linux/jobs/parser_check.sh for use.
+
+---------------------
+The MIT License (MIT)
+
+Copyright (c) 2019 Terje Io
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+---------------------
+"""
+
+import sys
+import random
+
+def coord(rnd, span=100.0):
+    return '%.3f' % rnd.uniform(-span, span)
+
+def axes(rnd, letters='XYZ'):
+    words = [axis + coord(rnd) for axis in letters if rnd.random() < 0.6]
+    return ''.join(words) if words else letters[rnd.randrange(len(letters))] + coord(rnd)
+
+def motion(rnd):
+    block = ''
+    r = rnd.random()
+    if r < 0.15:
+        block = 'G0'
+    elif r < 0.3:
+        block = 'G1'
+    if rnd.random() < 0.1:
+        block += 'N%d' % rnd.randrange(100000)
+    block += axes(rnd)
+    if rnd.random() < 0.2:
+        block += 'F%d' % rnd.randrange(1, 5000)
+    return block
+
+def arc(rnd):
+    block = rnd.choice(('G2', 'G3'))
+    if rnd.random() < 0.5:
+        radius = rnd.uniform(5.0, 50.0)
+        return block + 'X%sY%sR%.3f' % (coord(rnd, 2 * radius), coord(rnd, 2 * radius), radius)
+    return block + 'X%sY%sI%sJ%s' % (coord(rnd, 20), coord(rnd, 20), coord(rnd, 20), coord(rnd, 20))
+
+def modal(rnd):
+    return rnd.choice((
+        lambda: rnd.choice(('G20', 'G21', 'G21', 'G21')),
+        lambda: rnd.choice(('G90', 'G90', 'G91')),
+        lambda: 'G%d' % rnd.choice((54, 54, 55, 56, 57, 58, 59)),
+        lambda: rnd.choice(('G17', 'G17', 'G18', 'G19')),
+        lambda: rnd.choice(('G94', 'G94', 'G93')) + 'F%d' % rnd.randrange(1, 5000),
+        lambda: 'G92' + axes(rnd),
+        lambda: rnd.choice(('G92.1', 'G92.2', 'G92.3')),
+        lambda: 'G10L2P%d' % rnd.randrange(7) + axes(rnd),
+        lambda: 'G10L20P%d' % rnd.randrange(7) + axes(rnd),
+        lambda: 'G43.1Z' + coord(rnd, 10),
+        lambda: 'G49',
+        lambda: 'G53G0' + axes(rnd),
+        lambda: 'G80',
+        lambda: 'M3S%d' % rnd.randrange(10000),
+        lambda: 'M5',
+        lambda: 'S%d' % rnd.randrange(10000),
+        lambda: 'T%d' % rnd.randrange(10),
+        lambda: 'G4P%.2f' % rnd.uniform(0, 1),
+        lambda: rnd.choice(('M7', 'M8', 'M9')),
+        lambda: 'F%d' % rnd.randrange(1, 5000),
+        lambda: 'G1' + axes(rnd) + 'S%d' % rnd.randrange(10000),
+        lambda: 'G0' + axes(rnd) + 'G21',
+    ))()
+
+def erroneous(rnd):
+    return rnd.choice((
+        lambda: 'X1X2',
+        lambda: 'G1X%sF-%d' % (coord(rnd), rnd.randrange(1, 5000)),
+        lambda: 'G1X%sP1' % coord(rnd),
+        lambda: 'G0X%sQ2' % coord(rnd),
+        lambda: 'G2X%s' % coord(rnd),
+        lambda: 'G0G1X1',
+        lambda: 'G80X1',
+        lambda: 'G1X%sE1' % coord(rnd),
+        lambda: 'N%d X1' % (10000001 + rnd.randrange(100)),
+        lambda: 'G93G1X%s' % coord(rnd),
+        lambda: 'G1Y',
+        lambda: 'T300',
+        lambda: 'G4',
+    ))()
+
+def corpus(lines=60000, seed=1):
+    """Generator returning lines of the corpus without EOL."""
+    rnd = random.Random(seed)
+    for n in range(lines):
+        r = rnd.random()
+        if r < 0.6:
+            yield motion(rnd)
+        elif r < 0.7:
+            yield arc(rnd)
+        elif r < 0.9:
+            yield modal(rnd)
+        elif r < 0.97:
+            yield erroneous(rnd)
+        else:
+            yield rnd.choice(('$G', '$#'))
+
+if __name__ == '__main__':
+    lines = int(sys.argv[1]) if len(sys.argv) > 1 else 60000
+    seed = int(sys.argv[2]) if len(sys.argv) > 2 else 1
+    for line in corpus(lines, seed):
+        sys.stdout.write(line + '\n')
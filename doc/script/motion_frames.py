@@ -0,0 +1,132 @@
+#!/usr/bin/env python
+"""\
+
+Binary motion frame encoder for grblHAL builds with MOTION_FRAMES enabled
+
+Encodes G0, G1, G2 and G3 motions as base64 encoded frames, see
+GRBL/motion_frame.h for the frame layout. May be imported by senders,
+or run as a script to convert a g-code file to a frame stream:
+
+  motion_frames.py job.nc > job.frm
+
+Runs of simple motion lines (G0-G3 with X, Y, Z, I, J, F, S and N
+words in G17, G21 and G90 mode) are converted to frames preceded by
+the CMD_MOTION_FRAMES realtime command (0x8B) and followed by an end
+frame, all other lines are passed through as is. Arcs must be in the
+XY plane with I and J offsets. Each frame is acknowledged with ok or
+error:<n> as a g-code line is, so character counting streaming works
+unchanged.
+
+---------------------
+The MIT License (MIT)
+
+Copyright (c) 2019 Terje Io
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+---------------------
+"""
+
+import re
+import sys
+import struct
+import base64
+
+CMD_MOTION_FRAMES = b'\x8b'
+
+FRAME_END = 0
+FRAME_LINEAR = 1    # G1
+FRAME_SEEK = 2      # G0
+FRAME_CW_ARC = 3    # G2
+FRAME_CCW_ARC = 4   # G3
+
+AXES = 'XYZABC'
+
+def crc16(data):
+    # CRC-16/CCITT-FALSE
+    crc = 0xFFFF
+    for byte in bytearray(data):
+        crc ^= byte << 8
+        for bit in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+def encode(type, target={}, feed_rate=None, rpm=None, offset=None, line_number=None):
+    """Returns a frame as a base64 encoded line without EOL.
+    target is a dict of absolute work coordinates (mm) keyed by axis letter,
+    offset the arc center offset (mm) from the current position in the selected plane."""
+    axes = 0
+    flags = 0
+    for idx, axis in enumerate(AXES):
+        if axis in target:
+            axes |= 1 << idx
+    if line_number is not None: flags |= 0x01
+    if feed_rate is not None: flags |= 0x02
+    if rpm is not None: flags |= 0x04
+    data = struct.pack('<BBB', type, axes, flags)
+    if line_number is not None:
+        data += struct.pack('<i', line_number)
+    for axis in AXES:
+        if axis in target:
+            data += struct.pack('<f', target[axis])
+    if feed_rate is not None:
+        data += struct.pack('<f', feed_rate)
+    if rpm is not None:
+        data += struct.pack('<f', rpm)
+    if type in (FRAME_CW_ARC, FRAME_CCW_ARC):
+        data += struct.pack('<ff', offset[0], offset[1])
+    data += struct.pack('<H', crc16(data))
+    return base64.b64encode(data).decode('ascii')
+
+def end():
+    return encode(FRAME_END)
+
+def convert(lines):
+    """Generator converting g-code lines to frame stream lines."""
+    motion = None
+    in_frames = False
+    for line in lines:
+        block = re.sub(r'\s|\(.*?\)|;.*', '', line).upper()
+        words = re.findall(r'([A-Z])([-+]?[0-9]*\.?[0-9]+\.?)', block)
+        values = dict((letter, float(value)) for letter, value in words)
+        simple = ''.join(letter + value for letter, value in words) == block and len(values) == len(words) and \
+                 set(values) <= set('GXYZIJFSN') and values.get('G', 0) in (0, 1, 2, 3)
+        if 'G' in values:
+            motion = int(values['G']) if simple else None
+        if not (simple and motion is not None and set(values) & set('XYZ')):
+            if in_frames:
+                yield end() + '\n'
+                in_frames = False
+            yield line
+            continue
+        if not in_frames:
+            yield CMD_MOTION_FRAMES.decode('latin-1')
+            in_frames = True
+        frame_type = (FRAME_SEEK, FRAME_LINEAR, FRAME_CW_ARC, FRAME_CCW_ARC)[motion]
+        arc = frame_type in (FRAME_CW_ARC, FRAME_CCW_ARC)
+        yield encode(frame_type, dict((axis, values[axis]) for axis in 'XYZ' if axis in values),
+                     values.get('F'), values.get('S'),
+                     (values.get('I', 0.0), values.get('J', 0.0)) if arc else None,
+                     int(values['N']) if 'N' in values else None) + '\n'
+    if in_frames:
+        yield end() + '\n'
+
+if __name__ == '__main__':
+    out = getattr(sys.stdout, 'buffer', sys.stdout)
+    for line in convert(open(sys.argv[1])):
+        out.write(line.encode('latin-1'))
@@ -0,0 +1,148 @@
+#!/usr/bin/env python
+"""\
+
+Binary status frame decoder for grblHAL builds with STATUS_FRAMES enabled
+
+Decodes [SF:...] lines, see GRBL/status_frame.h for the frame layout, and
+keeps track of the last value of each field as frames only carry changes.
+May be imported by senders, or run as a filter printing each frame as a
+status report like line with machine position in steps:
+
+  grblHAL_sim < job.nc | status_frames.py
+
+Lines that are not status frames are passed through as is.
+
+---------------------
+The MIT License (MIT)
+
+Copyright (c) 2019 Terje Io
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+---------------------
+"""
+
+import sys
+import struct
+import base64
+
+from motion_frames import crc16
+
+STATES = ('Idle', 'Run', 'Hold', 'Jog', 'Home', 'Alarm', 'Check', 'Door', 'Sleep', 'Tool')
+
+STATUS_FRAME_KEY = 0x80
+
+FIELD_STATE = 0x01
+FIELD_POSITION = 0x02
+FIELD_BUFFERS = 0x04
+FIELD_FEED_SPEED = 0x08
+FIELD_LINE_NUMBER = 0x10
+FIELD_OVERRIDES = 0x20
+FIELD_WCO = 0x40
+FIELD_SIGNALS = 0x80
+
+class StatusDecoder(object):
+    """Decodes frames and keeps the last value of each field, valid is False
+    from a gap in the sequence until the next key frame."""
+
+    def __init__(self):
+        self.sequence = None
+        self.valid = False
+        self.values = {}
+
+    def decode(self, line):
+        """Decodes a [SF:...] line, returns the updated values or None if the line
+        is not a valid frame."""
+        line = line.strip()
+        if not (line.startswith('[SF:') and line.endswith(']')):
+            return None
+        try:
+            data = bytearray(base64.b64decode(line[4:-1]))
+        except Exception:
+            return None
+        if len(data) < 4 or crc16(bytes(data[:-2])) != struct.unpack('<H', bytes(data[-2:]))[0]:
+            return None
+        sequence, fields, key = data[0] & 0x7F, data[1], data[0] & STATUS_FRAME_KEY
+        if self.sequence is not None and sequence != (self.sequence + 1) & 0x7F:
+            self.valid = False
+        self.sequence = sequence
+        pos = [2]
+
+        def get(fmt):
+            value = struct.unpack_from('<' + fmt, bytes(data), pos[0])
+            pos[0] += struct.calcsize('<' + fmt)
+            return value if len(value) > 1 else value[0]
+
+        def get_axes(name, fmt):
+            axes = get('B')
+            values = self.values.setdefault(name, {})
+            for idx in range(8):
+                if axes & (1 << idx):
+                    values['XYZABCUV'[idx]] = get(fmt)
+            return axes
+
+        if key:
+            self.values = {}
+        if fields & FIELD_STATE:
+            state, substate = get('BB')
+            self.values['state'] = STATES[state] if state < len(STATES) else str(state)
+            self.values['substate'] = substate
+        if fields & FIELD_POSITION:
+            get_axes('position', 'i')
+        if fields & FIELD_BUFFERS:
+            self.values['planner'], self.values['rx'] = get('BH')
+        if fields & FIELD_FEED_SPEED:
+            self.values['feed_rate'], self.values['rpm'] = get('ff')
+        if fields & FIELD_LINE_NUMBER:
+            self.values['line_number'] = get('i')
+        if fields & FIELD_OVERRIDES:
+            self.values['overrides'] = get('BBB')
+            self.values['accessories'] = get('B')
+        if fields & FIELD_WCO:
+            get_axes('wco', 'f')
+        if fields & FIELD_SIGNALS:
+            self.values['limits'], self.values['control'] = get('BB')
+        if key:
+            self.valid = True
+        return self.values
+
+    def format(self):
+        v = self.values
+        s = '<' + v.get('state', '?')
+        if v.get('state') in ('Hold', 'Door'):
+            s += ':%d' % v['substate']
+        s += '|MSteps:' + ','.join(str(v) for k, v in sorted(v.get('position', {}).items(), key=lambda a: 'XYZABCUV'.index(a[0])))
+        if 'planner' in v:
+            s += '|Bf:%d,%d' % (v['planner'], v['rx'])
+        if v.get('line_number'):
+            s += '|Ln:%d' % v['line_number']
+        if 'feed_rate' in v:
+            s += '|FS:%g,%g' % (v['feed_rate'], v['rpm'])
+        if 'overrides' in v:
+            s += '|Ov:%d,%d,%d' % v['overrides']
+        if 'wco' in v:
+            s += '|WCO:' + ','.join('%.3f' % v for k, v in sorted(v['wco'].items(), key=lambda a: 'XYZABCUV'.index(a[0])))
+        return s + ('>' if self.valid else '>?')
+
+if __name__ == '__main__':
+    decoder = StatusDecoder()
+    for line in sys.stdin:
+        if decoder.decode(line) is not None:
+            print(decoder.format())
+        else:
+            sys.stdout.write(line)
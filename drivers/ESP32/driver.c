@@ -323,6 +323,12 @@ static void driver_delay_ms (uint32_t ms, void (*callback)(void))
     }
 }
 
+// Milliseconds since startup, derived from the FreeRTOS tick count.
+static uint32_t getElapsedTicks (void)
+{
+    return xTaskGetTickCount() * portTICK_PERIOD_MS;
+}
+
 #ifdef DEBUGOUT
 static void debug_out (bool enable)
 {
@@ -1026,7 +1032,7 @@ static bool driver_setup (settings_t *settings)
 
   // Set defaults
 
-    IOInitDone = settings->version == 14;
+    IOInitDone = settings->version == 15;
 
     settings_changed(settings);
 
@@ -1133,6 +1139,7 @@ bool driver_init (void)
     hal.f_step_timer = rtc_clk_apb_freq_get() / STEPPER_DRIVER_PRESCALER; // 20 MHz
     hal.rx_buffer_size = RX_BUFFER_SIZE;
     hal.delay_ms = driver_delay_ms;
+    hal.get_elapsed_ticks = getElapsedTicks;
     hal.settings_changed = settings_changed;
 
     hal.stepper_wake_up = stepperWakeUp;
@@ -262,7 +262,7 @@ void keypad_process_keypress (uint_fast16_t state)
 		}
 
 		if(!(jogCommand && keyreleased)) { // key still pressed? - do not execute jog command if released!
-			addedGcode = hal.protocol_enqueue_gcode((char *)command);
+			addedGcode = hal.protocol_enqueue_command((char *)command, CommandPriority_High);
 			jogging = jogging || (jogCommand && addedGcode);
 		}
 	}
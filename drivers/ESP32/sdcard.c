@@ -72,6 +72,7 @@ static file_t file = {
 };
 
 static io_stream_t active_stream;
+static volatile bool cancel_read = false;
 
 static file_status_t allowed (char *filename, bool is_file)
 {
@@ -212,6 +213,7 @@ static status_code_t sdcard_ls (char *buf)
 static void sdcard_end_job (void)
 {
     file_close();
+    cancel_read = false;
     memcpy(&hal.stream, &active_stream, sizeof(io_stream_t));   // Restore stream pointers
     hal.stream.reset_read_buffer();                             // and flush input buffer
     hal.driver_rt_report = NULL;
@@ -246,6 +248,11 @@ static int16_t sdcard_read (void)
 {
     int16_t c = -1;
 
+    if(cancel_read) { // Input cancelled, return the CMD_RESET character the protocol loop waits for
+        cancel_read = false;
+        return CMD_RESET;
+    }
+
     if(file.eol == 1)
         file.line++;
 
@@ -266,6 +273,15 @@ static int16_t sdcard_read (void)
     return c;
 }
 
+// Called from the real time command handler on a stop or jog cancel.
+static void sdcard_cancel (void)
+{
+    if(hal.stream.read == sdcard_read)
+        cancel_read = true;                 // Reading from SD card, let sdcard_read() return CMD_RESET
+    else
+        active_stream.cancel_read_buffer(); // Input is from the originating stream while suspended
+}
+
 static void sdcard_report (stream_write_ptr stream_write)
 {
     stream_write("|SD:");
@@ -310,6 +326,7 @@ static status_code_t sdcard_parse (uint_fast16_t state, char *line, char *lcline
                     memcpy(&active_stream, &hal.stream, sizeof(io_stream_t));   // Save current stream pointers
                     hal.stream.type = StreamSetting_SDCard;                     // then redirect to read from SD card instead
                     hal.stream.read = sdcard_read;                  			// ...
+                    hal.stream.cancel_read_buffer = sdcard_cancel;              // ...
                     hal.stream.suspend_read = sdcard_suspend;      	 			// ...
                     hal.driver_rt_report = sdcard_report;      					// Sdd percent complete to real time report
                     hal.report.status_message = trap_status_report;             // Redirect status message and feedback message
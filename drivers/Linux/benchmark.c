@@ -0,0 +1,841 @@
+/*
+  benchmark.c - planner throughput benchmark for Linux hosts (simulator)
+
+  Part of Grbl
+
+  Copyright (c) 2019 Terje Io
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//
+// $PB[=<blocks>] - feeds synthetic moves through mc_line() and mc_arc() with the planner buffer kept full,
+// the oldest block is discarded as if executed each time a new block is to be added.
+// Reports blocks per second, worst case time for adding a block and the distribution of
+// how many blocks the reverse pass of the planner walks back over.
+// Feed override changes are then applied to a full buffer, the worst case and average time spent in the
+// override handler and the worst case time for the subsequent replan by the segment generator are reported.
+//
+// Planning runs in a non idle state (alarm) to stop cycle start, the stepper is not involved.
+// Change $41 and restart to compare buffer sizes.
+//
+// $PR[=<pixels>] - requires LASER_RASTER, engraves a synthetic grayscale image through the g-code parser,
+// first with one G1 S- motion per pixel and then with one G1 motion per row carrying the pixels as a
+// raster. Reports pixels per second parsed and planned, bytes per pixel streamed and the pixel rate a
+// 115200 baud serial link can carry.
+//
+// $PF[=<lines>] - requires MOTION_FRAMES, feeds the short CAM segments of $PB through the g-code parser,
+// first as G1 lines and then as binary motion frames. Reports lines per second decoded and planned, bytes
+// per line streamed and the number of lines per second a 115200 baud serial link can carry.
+//
+// $PS[=<reports>] - generates realtime status reports with the output stream replaced by a sink that
+// only counts, as seen by the driver. Reports the time per report, the number of stream writes and
+// bytes per report and the report rate a 115200 baud serial link can carry. With STATUS_FRAMES
+// enabled binary status frames are then generated the same way. X and Y are moved between reports,
+// reports are generated in the current state. Position and report refresh counters are restored afterwards.
+//
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <signal.h>
+
+#include "driver.h"
+#include "serial.h"
+#include "benchmark.h"
+
+#define BENCHMARK_BLOCKS 1000000
+#define BENCHMARK_REPORTS 100000
+#define PARSER_LINES 256            // Distinct lines cycled through by the parser benchmark
+#define RASTER_WIDTH 128            // Pixels per row
+#define RASTER_PITCH 0.1f           // mm
+#define LINK_BYTES_PER_SECOND 11520 // 115200 baud
+#define DEPTH_BUCKETS 9             // 1, 2, 3-4, 5-8, 9-16, 17-32, 33-64, 65-128, 129+
+
+typedef struct {
+    uint32_t blocks;
+    uint64_t depth_sum;
+    uint32_t depth[DEPTH_BUCKETS];
+    uint64_t last_ns;
+    uint64_t max_ns;
+} bench_stats_t;
+
+static bench_stats_t stats;
+static void (*execute_realtime)(uint_fast16_t state);
+static status_code_t (*on_sys_command_execute)(uint_fast16_t state, char *line, char *lcline) = NULL;
+
+static uint64_t get_ns (void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+// Called from mc_line() before a block is added to the planner, simulates execution by discarding
+// the oldest block when the buffer is full. Time is measured from call to call and thus includes the
+// previous plan_buffer_line() call.
+static void bench_realtime (uint_fast16_t state)
+{
+    uint_fast8_t bucket = 0, depth;
+    uint64_t now = get_ns();
+
+    if(stats.last_ns && now - stats.last_ns > stats.max_ns)
+        stats.max_ns = now - stats.last_ns;
+
+    if(plan_check_full_buffer())
+        plan_discard_current_block();
+
+    depth = plan_get_block_buffer_unplanned() + 1;
+
+    while(bucket < DEPTH_BUCKETS - 1 && depth > (1U << bucket))
+        bucket++;
+
+    stats.depth[bucket]++;
+    stats.depth_sum += depth;
+    stats.blocks++;
+    stats.last_ns = get_ns();
+}
+
+static void bench_report (const char *name, uint64_t elapsed_ns)
+{
+    char buf[200];
+    uint_fast8_t idx, len;
+    static const char *bucket_name[DEPTH_BUCKETS] = { "1", "2", "3-4", "5-8", "9-16", "17-32", "33-64", "65-128", "129+" };
+
+    sprintf(buf, "[PB:%s|Blocks:%lu|Time:%.3f|Rate:%.0f|Max:%.1f|Depth:%.2f]" ASCII_EOL,
+             name, (unsigned long)stats.blocks, (double)elapsed_ns / 1e9, stats.blocks / ((double)elapsed_ns / 1e9),
+              (double)stats.max_ns / 1000.0, stats.blocks ? (double)stats.depth_sum / stats.blocks : 0.0);
+    hal.stream.write(buf);
+
+    len = sprintf(buf, "[PBDEPTH:%s", name);
+    for(idx = 0; idx < DEPTH_BUCKETS; idx++) {
+        if(stats.depth[idx])
+            len += sprintf(&buf[len], "|%s:%lu", bucket_name[idx], (unsigned long)stats.depth[idx]);
+    }
+    strcpy(&buf[len], "]" ASCII_EOL);
+    hal.stream.write(buf);
+}
+
+static void bench_begin (void)
+{
+    memset(&stats, 0, sizeof(bench_stats_t));
+    plan_reset();
+    plan_sync_position();
+}
+
+// Short CAM segments, zigzag raster over a wavy surface.
+static void bench_segments (uint32_t blocks, float *center, float extent)
+{
+    float target[N_AXIS], x, y = -extent, dir = 1.0f;
+    plan_line_data_t plan_data;
+
+    memset(&plan_data, 0, sizeof(plan_line_data_t));
+    memcpy(target, center, sizeof(target));
+    plan_data.feed_rate = 3000.0f;
+
+    while(stats.blocks < blocks) {
+        for(x = -extent; x <= extent && stats.blocks < blocks; x += 0.1f) {
+            target[X_AXIS] = center[X_AXIS] + x * dir;
+            target[Y_AXIS] = center[Y_AXIS] + y;
+            target[Z_AXIS] = center[Z_AXIS] + 2.0f * sinf(target[X_AXIS] / 5.0f) * cosf(target[Y_AXIS] / 7.0f);
+            mc_line(target, &plan_data);
+        }
+        dir = -dir;
+        if((y += 0.5f) > extent)
+            y = -extent;
+    }
+}
+
+// Full circles in the XY plane, segmented by mc_arc() according to the arc tolerance setting.
+static void bench_arcs (uint32_t blocks, float *center, float extent)
+{
+    float position[N_AXIS], target[N_AXIS], offset[N_AXIS] = {0}, radius = extent / 2.0f;
+    plane_t plane = { .axis_0 = X_AXIS, .axis_1 = Y_AXIS, .axis_linear = Z_AXIS };
+    plan_line_data_t plan_data;
+
+    memset(&plan_data, 0, sizeof(plan_line_data_t));
+    memcpy(target, center, sizeof(target));
+    plan_data.feed_rate = 3000.0f;
+
+    target[X_AXIS] += radius;
+    mc_line(target, &plan_data);
+    offset[X_AXIS] = -radius;
+
+    while(stats.blocks < blocks) {
+        memcpy(position, target, sizeof(position));
+        mc_arc(target, &plan_data, position, offset, radius, plane, true);
+    }
+}
+
+// Rapids between pseudo random positions.
+static void bench_rapids (uint32_t blocks, float *center, float extent)
+{
+    uint32_t seed = 1;
+    uint_fast8_t idx;
+    float target[N_AXIS];
+    plan_line_data_t plan_data;
+
+    memset(&plan_data, 0, sizeof(plan_line_data_t));
+    plan_data.condition.rapid_motion = On;
+
+    while(stats.blocks < blocks) {
+        for(idx = 0; idx < N_AXIS; idx++) {
+            seed = seed * 1103515245UL + 12345UL;
+            target[idx] = center[idx] + extent * ((float)((seed >> 8) & 0xFFFF) / 32768.0f - 1.0f);
+        }
+        mc_line(target, &plan_data);
+    }
+}
+
+// Feed override steps, alternating between two values, with a full planner buffer.
+static void bench_overrides (uint32_t count, float *center, float extent)
+{
+    char buf[120];
+    uint32_t idx;
+    uint64_t start, handler_ns = 0, handler_max_ns = 0, replan_ns = 0, replan_max_ns = 0, ns;
+
+    bench_segments(plan_get_block_buffer_size() - 1, center, extent);
+
+    for(idx = 0; idx < count; idx++) {
+        start = get_ns();
+        plan_feed_override(idx & 1 ? DEFAULT_FEED_OVERRIDE : DEFAULT_FEED_OVERRIDE + FEED_OVERRIDE_COARSE_INCREMENT, sys.override.rapid_rate);
+        ns = get_ns() - start;
+        handler_ns += ns;
+        if(ns > handler_max_ns)
+            handler_max_ns = ns;
+        start = get_ns();
+        plan_apply_overrides();
+        ns = get_ns() - start;
+        replan_ns += ns;
+        if(ns > replan_max_ns)
+            replan_max_ns = ns;
+    }
+
+    plan_feed_override(DEFAULT_FEED_OVERRIDE, sys.override.rapid_rate);
+
+    sprintf(buf, "[PB:Overrides|Count:%lu|Max:%.1f|Avg:%.2f|ReplanMax:%.1f|ReplanAvg:%.2f]" ASCII_EOL, (unsigned long)count,
+             (double)handler_max_ns / 1000.0, (double)handler_ns / count / 1000.0,
+              (double)replan_max_ns / 1000.0, (double)replan_ns / count / 1000.0);
+    hal.stream.write(buf);
+}
+
+#if defined(LASER_RASTER) || defined(MOTION_FRAMES)
+
+// Executes a g-code line, adds the time spent to elapsed_ns.
+static status_code_t block_execute (char *line, uint64_t *elapsed_ns)
+{
+    status_code_t status;
+    uint64_t start = get_ns();
+
+    status = gc_execute_block(line, NULL);
+    *elapsed_ns += get_ns() - start;
+
+    return status;
+}
+
+#endif
+
+#ifdef LASER_RASTER
+
+static void base64_encode (const uint8_t *data, uint_fast16_t length, char *s)
+{
+    static const char *digits = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    uint32_t value;
+    uint_fast16_t idx;
+
+    for(idx = 0; idx < length; idx += 3) {
+        value = (uint32_t)data[idx] << 16;
+        if(idx + 1 < length)
+            value |= (uint32_t)data[idx + 1] << 8;
+        if(idx + 2 < length)
+            value |= data[idx + 2];
+        *s++ = digits[(value >> 18) & 0x3F];
+        *s++ = digits[(value >> 12) & 0x3F];
+        *s++ = idx + 1 < length ? digits[(value >> 6) & 0x3F] : '=';
+        *s++ = idx + 2 < length ? digits[value & 0x3F] : '=';
+    }
+    *s = '\0';
+}
+
+// Engraves rows of a synthetic grayscale image back and forth with G91 incremental moves, either with
+// one G1 S- motion per pixel or with one G1 motion per row carrying the pixels as a raster.
+static status_code_t bench_raster (uint32_t pixels, bool raster)
+{
+    char line[LINE_BUFFER_SIZE], data[((RASTER_WIDTH + 2) / 3) * 4 + 1], buf[160];
+    uint8_t power[RASTER_WIDTH];
+    uint_fast16_t col, width;
+    uint32_t done = 0, row = 0, bytes = 0;
+    uint64_t elapsed_ns = 0;
+    float dir = 1.0f;
+    status_code_t status = Status_OK;
+
+    while(done < pixels && status == Status_OK) {
+
+        width = pixels - done > RASTER_WIDTH ? RASTER_WIDTH : pixels - done;
+
+        for(col = 0; col < width; col++)
+            power[col] = (uint8_t)(127.5f + 127.5f * sinf((float)col * 0.2f) * cosf((float)row * 0.05f));
+
+        if(raster) {
+            sprintf(line, "G1X%.1f", dir * RASTER_PITCH * width);
+            base64_encode(power, width, data);
+            bytes += strlen(line) + strlen(data) + 10; // (RASTER,) and EOL
+            gc_set_raster_data(data);
+            status = block_execute(line, &elapsed_ns);
+        } else for(col = 0; col < width && status == Status_OK; col++) {
+            sprintf(line, "G1X%.1fS%u", dir * RASTER_PITCH, (uint32_t)power[col] * 1000 / 255);
+            bytes += strlen(line) + 1;
+            status = block_execute(line, &elapsed_ns);
+        }
+
+        if(status == Status_OK) {
+            sprintf(line, "G1Y%.1fS0", row & 1 ? -RASTER_PITCH : RASTER_PITCH);
+            bytes += strlen(line) + 1;
+            status = block_execute(line, &elapsed_ns);
+        }
+
+        done += width;
+        dir = -dir;
+        row++;
+    }
+
+    if(status == Status_OK) {
+        sprintf(buf, "[PB:%s|Pixels:%lu|Blocks:%lu|Time:%.3f|Rate:%.0f|Bytes:%.2f|Link:%.0f]" ASCII_EOL,
+                 raster ? "Raster" : "G1Pixels", (unsigned long)done, (unsigned long)stats.blocks, (double)elapsed_ns / 1e9,
+                  done / ((double)elapsed_ns / 1e9), (double)bytes / done, LINK_BYTES_PER_SECOND * (double)done / bytes);
+        hal.stream.write(buf);
+    }
+
+    return status;
+}
+
+static status_code_t benchmark_raster (uint32_t pixels)
+{
+    char line[LINE_BUFFER_SIZE];
+    parser_state_t gc_saved;
+    settingflags_t flags = settings.flags;
+    uint_fast16_t state = sys.state;
+    status_code_t status;
+    sigset_t mask, saved;
+
+    if(!hal.driver_cap.variable_spindle)
+        return Status_GcodeUnsupportedCommand;
+
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGALRM);
+    sigprocmask(SIG_BLOCK, &mask, &saved);
+
+    memcpy(&gc_saved, &gc_state, sizeof(parser_state_t));
+    settings.flags.laser_mode = On;
+
+    status = gc_execute_block("G21G91G94M3S1000F6000", NULL); // Spindle on synchronizes, do it with an empty buffer.
+
+    execute_realtime = hal.execute_realtime;
+    hal.execute_realtime = bench_realtime;
+    sys.state = STATE_ALARM;    // Blocks cycle start and segment preparation, mc_line() still plans.
+
+    // Start at the left of a mid-travel area.
+    sprintf(line, "G53G0X%.3fY%.3f", settings.max_travel[X_AXIS] / 2.0f - RASTER_PITCH * RASTER_WIDTH / 2.0f,
+                                      settings.max_travel[Y_AXIS] / 2.0f);
+    if(status == Status_OK)
+        status = gc_execute_block(line, NULL);
+
+    if(status == Status_OK) {
+        bench_begin();
+        status = bench_raster(pixels, false);
+    }
+
+    if(status == Status_OK) {
+        bench_begin();
+        status = bench_raster(pixels, true);
+    }
+
+    plan_reset();
+    plan_sync_position();
+
+    sys.state = state;
+    hal.execute_realtime = execute_realtime;
+
+    // Nothing was executed, restore parser state and switch the spindle off again.
+    memcpy(&gc_state, &gc_saved, sizeof(parser_state_t));
+    settings.flags = flags;
+    hal.spindle_set_state((spindle_state_t){0}, 0.0f);
+
+    sigprocmask(SIG_SETMASK, &saved, NULL);
+
+    return status;
+}
+
+#endif
+
+#ifdef MOTION_FRAMES
+
+// Decodes and executes a motion frame as the protocol loop does, adds the time spent to elapsed_ns.
+static status_code_t frame_execute (char *line, uint64_t *elapsed_ns)
+{
+    motion_frame_t frame;
+    status_code_t status = Status_MotionFrameInvalid;
+    uint64_t start = get_ns();
+
+    if(motion_frame_decode(line, &frame))
+        status = gc_execute_frame(&frame);
+    *elapsed_ns += get_ns() - start;
+
+    return status;
+}
+
+// Short CAM segments as for $PB, either as G1 lines with three decimals or as frames. Targets are
+// absolute work coordinates, the first line or frame sets the feed rate.
+static status_code_t bench_frames (uint32_t lines, float *origin, float extent, bool frames)
+{
+    char line[LINE_BUFFER_SIZE], buf[160];
+    uint32_t done = 0, bytes = 0;
+    uint64_t elapsed_ns = 0;
+    float x, y = -extent, dir = 1.0f;
+    motion_frame_t frame = {0};
+    status_code_t status = Status_OK;
+
+    frame.type = MotionFrame_Linear;
+    frame.axes = X_AXIS_BIT|Y_AXIS_BIT|Z_AXIS_BIT;
+    frame.flags.feed_rate = On;
+    frame.feed_rate = 3000.0f;
+
+    while(done < lines && status == Status_OK) {
+        for(x = -extent; x <= extent && done < lines && status == Status_OK; x += 0.1f) {
+            frame.target[X_AXIS] = origin[X_AXIS] + x * dir;
+            frame.target[Y_AXIS] = origin[Y_AXIS] + y;
+            frame.target[Z_AXIS] = origin[Z_AXIS] + 2.0f * sinf(frame.target[X_AXIS] / 5.0f) * cosf(frame.target[Y_AXIS] / 7.0f);
+            if(frames) {
+                bytes += motion_frame_encode(&frame, line) + 1;
+                status = frame_execute(line, &elapsed_ns);
+            } else {
+                bytes += sprintf(line, done ? "G1X%.3fY%.3fZ%.3f" : "G1X%.3fY%.3fZ%.3fF3000", frame.target[X_AXIS],
+                                  frame.target[Y_AXIS], frame.target[Z_AXIS]) + 1;
+                status = block_execute(line, &elapsed_ns);
+            }
+            frame.flags.feed_rate = Off;
+            done++;
+        }
+        dir = -dir;
+        if((y += 0.5f) > extent)
+            y = -extent;
+    }
+
+    if(status == Status_OK) {
+        sprintf(buf, "[PB:%s|Lines:%lu|Blocks:%lu|Time:%.3f|Rate:%.0f|Bytes:%.2f|Link:%.0f]" ASCII_EOL,
+                 frames ? "Frames" : "G1Lines", (unsigned long)done, (unsigned long)stats.blocks, (double)elapsed_ns / 1e9,
+                  done / ((double)elapsed_ns / 1e9), (double)bytes / done, LINK_BYTES_PER_SECOND * (double)done / bytes);
+        hal.stream.write(buf);
+    }
+
+    return status;
+}
+
+static status_code_t benchmark_frames (uint32_t lines)
+{
+    uint_fast8_t idx = N_AXIS;
+    float origin[N_AXIS], extent = 25.0f;
+    parser_state_t gc_saved;
+    uint_fast16_t state = sys.state;
+    status_code_t status;
+    sigset_t mask, saved;
+
+    // Keep moves inside the machine envelope, centered at mid-travel, in work coordinates.
+    do {
+        idx--;
+        origin[idx] = settings.max_travel[idx] / 2.0f - gc_state.modal.coord_system.xyz[idx] - gc_state.g92_coord_offset[idx] - gc_state.tool_length_offset[idx];
+        if(-settings.max_travel[idx] / 4.0f < extent)
+            extent = -settings.max_travel[idx] / 4.0f;
+    } while(idx);
+
+    if(extent <= 0.0f)
+        return Status_InvalidStatement;
+
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGALRM);
+    sigprocmask(SIG_BLOCK, &mask, &saved);
+
+    memcpy(&gc_saved, &gc_state, sizeof(parser_state_t));
+
+    status = gc_execute_block("G21G90G94G17", NULL);
+
+    execute_realtime = hal.execute_realtime;
+    hal.execute_realtime = bench_realtime;
+    sys.state = STATE_ALARM;    // Blocks cycle start and segment preparation, mc_line() still plans.
+
+    if(status == Status_OK) {
+        bench_begin();
+        status = bench_frames(lines, origin, extent, false);
+    }
+
+    if(status == Status_OK) {
+        bench_begin();
+        status = bench_frames(lines, origin, extent, true);
+    }
+
+    plan_reset();
+    plan_sync_position();
+
+    sys.state = state;
+    hal.execute_realtime = execute_realtime;
+
+    // Nothing was executed, restore parser state.
+    memcpy(&gc_state, &gc_saved, sizeof(parser_state_t));
+
+    sigprocmask(SIG_SETMASK, &saved, NULL);
+
+    return status;
+}
+
+#endif
+
+static uint32_t sink_writes, sink_bytes;
+
+static void sink_write (const char *s)
+{
+    sink_writes++;
+    sink_bytes += strlen(s);
+}
+
+static void bench_status (const char *name, void (*report)(void), uint32_t reports)
+{
+    char buf[180];
+    uint32_t count = reports;
+    uint64_t start, elapsed_ns;
+    int32_t position[N_AXIS];
+    report_tracking_t report_tracking;
+    stream_write_ptr write_all = hal.stream.write_all;
+
+    memcpy(&report_tracking, &sys.report, sizeof(report_tracking_t));
+    memcpy(position, sys_position, sizeof(sys_position));
+
+    sink_writes = sink_bytes = 0;
+    hal.stream.write_all = sink_write;
+
+    // X and Y are moved between reports as in a diagonal feed motion.
+    start = get_ns();
+    while(count--) {
+        report();
+        sys_position[X_AXIS] += 3;
+        sys_position[Y_AXIS] += 2;
+    }
+    elapsed_ns = get_ns() - start;
+
+    hal.stream.write_all = write_all;
+
+    memcpy(sys_position, position, sizeof(sys_position));
+    memcpy(&sys.report, &report_tracking, sizeof(report_tracking_t));
+
+    sprintf(buf, "[PB:%s|Reports:%lu|Time:%.3f|Rate:%.0f|Cost:%.2f|Writes:%.2f|Bytes:%.1f|Link:%.0f]" ASCII_EOL,
+             name, (unsigned long)reports, (double)elapsed_ns / 1e9, reports / ((double)elapsed_ns / 1e9),
+              (double)elapsed_ns / 1000.0 / reports, (double)sink_writes / reports, (double)sink_bytes / reports,
+               LINK_BYTES_PER_SECOND * (double)reports / sink_bytes);
+    hal.stream.write(buf);
+}
+
+static status_code_t benchmark_status (uint32_t reports)
+{
+    bench_status("Status", report_realtime_status, reports);
+#ifdef STATUS_FRAMES
+    bench_status("StatusFrames", status_frame_report, reports);
+#endif
+
+    return Status_OK;
+}
+
+// CAM style lines, mostly axis words only, parsed and executed in check mode so that no motion is planned.
+static status_code_t benchmark_parser (uint32_t lines)
+{
+    static char line[PARSER_LINES][48];
+    char buf[120];
+    uint32_t idx, words = 0;
+    uint64_t start, elapsed_ns;
+    float center[N_AXIS], x, y, z, extent = 25.0f;
+    uint_fast16_t state = sys.state;
+    status_code_t status = Status_OK;
+    parser_state_t parser_state;
+
+    idx = N_AXIS;
+    do {
+        idx--;
+        center[idx] = settings.max_travel[idx] / 2.0f;
+        if(-settings.max_travel[idx] / 4.0f < extent)
+            extent = -settings.max_travel[idx] / 4.0f;
+    } while(idx);
+
+    if(extent <= 0.0f)
+        return Status_InvalidStatement;
+
+    for(idx = 0; idx < PARSER_LINES; idx++) {
+        x = center[X_AXIS] + extent * ((float)idx / PARSER_LINES - 0.5f);
+        y = center[Y_AXIS] + 2.0f * sinf(x / 5.0f);
+        z = center[Z_AXIS] + 2.0f * cosf(y / 7.0f);
+        switch(idx & 0x07) {
+            case 0:
+                sprintf(line[idx], "G1X%.3fY%.3fZ%.3fF3000", x, y, z);
+                break;
+            case 5:
+                sprintf(line[idx], "N%luX%.3fY%.3fZ%.3f", (unsigned long)idx * 10, x, y, z);
+                break;
+            case 6:
+                sprintf(line[idx], "G0Z%.3f", z);
+                break;
+            case 7:
+                sprintf(line[idx], "G1Z%.3fF600", z);
+                break;
+            default:
+                sprintf(line[idx], "X%.3fY%.3f", x, y);
+                break;
+        }
+    }
+
+    memcpy(&parser_state, &gc_state, sizeof(parser_state_t));
+    sys.state = STATE_CHECK_MODE;
+
+    start = get_ns();
+    for(idx = 0; idx < lines && status == Status_OK; idx++)
+        status = gc_execute_block(line[idx % PARSER_LINES], NULL);
+    elapsed_ns = get_ns() - start;
+
+    sys.state = state;
+    memcpy(&gc_state, &parser_state, sizeof(parser_state_t));
+
+    if(status == Status_OK) {
+        for(idx = 0; idx < lines; idx++) {
+            char *c = line[idx % PARSER_LINES];
+            while(*c) {
+                if(*c >= 'A' && *c <= 'Z')
+                    words++;
+                c++;
+            }
+        }
+        sprintf(buf, "[PB:Parser|Lines:%lu|Time:%.3f|Rate:%.0f|Words:%.2f|Cost:%.3f]" ASCII_EOL,
+                 (unsigned long)lines, (double)elapsed_ns / 1e9, lines / ((double)elapsed_ns / 1e9),
+                  (double)words / lines, (double)elapsed_ns / 1000.0 / lines);
+        hal.stream.write(buf);
+    }
+
+    return status;
+}
+
+static status_code_t benchmark_run (uint32_t blocks)
+{
+    uint_fast8_t idx = N_AXIS;
+    uint64_t start;
+    float center[N_AXIS], extent = 25.0f;
+    uint_fast16_t state = sys.state;
+    sigset_t mask, saved;
+
+    // Keep moves inside the machine envelope, centered at mid-travel.
+    do {
+        idx--;
+        center[idx] = settings.max_travel[idx] / 2.0f;
+        if(-settings.max_travel[idx] / 4.0f < extent)
+            extent = -settings.max_travel[idx] / 4.0f;
+    } while(idx);
+
+    if(extent <= 0.0f)
+        return Status_InvalidStatement;
+
+    // Keep the systick out of the measurements, it would also see the alarm state as a lockup in virtual clock mode.
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGALRM);
+    sigprocmask(SIG_BLOCK, &mask, &saved);
+
+    execute_realtime = hal.execute_realtime;
+    hal.execute_realtime = bench_realtime;
+    sys.state = STATE_ALARM;    // Blocks cycle start and segment preparation, mc_line() still plans.
+
+    bench_begin();
+    start = get_ns();
+    bench_segments(blocks, center, extent);
+    bench_report("Segments", get_ns() - start);
+
+    bench_begin();
+    start = get_ns();
+    bench_arcs(blocks, center, extent);
+    bench_report("Arcs", get_ns() - start);
+
+    bench_begin();
+    start = get_ns();
+    bench_rapids(blocks, center, extent);
+    bench_report("Rapids", get_ns() - start);
+
+    bench_begin();
+    bench_overrides(blocks, center, extent);
+
+    plan_reset();
+    plan_sync_position();
+
+    sys.state = state;
+    hal.execute_realtime = execute_realtime;
+
+    sigprocmask(SIG_SETMASK, &saved, NULL);
+
+    return Status_OK;
+}
+
+static status_code_t benchmark_parse (uint_fast16_t state, char *line, char *lcline)
+{
+    status_code_t retval = Status_Unhandled;
+
+#ifdef LASER_RASTER
+    if(line[1] == 'P' && line[2] == 'R') {
+
+        if(state != STATE_IDLE)
+            retval = Status_IdleError;
+
+        else switch(line[3]) {
+
+            case '\0':
+                retval = benchmark_raster(BENCHMARK_BLOCKS);
+                break;
+
+            case '=':
+                {
+                    float pixels;
+                    uint_fast8_t counter = 4;
+                    if(!read_float(line, &counter, &pixels) || pixels < 1.0f)
+                        retval = Status_BadNumberFormat;
+                    else
+                        retval = benchmark_raster((uint32_t)pixels);
+                }
+                break;
+
+            default:
+                retval = Status_InvalidStatement;
+                break;
+        }
+    } else
+#endif
+#ifdef MOTION_FRAMES
+    if(line[1] == 'P' && line[2] == 'F') {
+
+        if(state != STATE_IDLE)
+            retval = Status_IdleError;
+
+        else switch(line[3]) {
+
+            case '\0':
+                retval = benchmark_frames(BENCHMARK_BLOCKS);
+                break;
+
+            case '=':
+                {
+                    float lines;
+                    uint_fast8_t counter = 4;
+                    if(!read_float(line, &counter, &lines) || lines < 1.0f)
+                        retval = Status_BadNumberFormat;
+                    else
+                        retval = benchmark_frames((uint32_t)lines);
+                }
+                break;
+
+            default:
+                retval = Status_InvalidStatement;
+                break;
+        }
+    } else
+#endif
+    if(line[1] == 'P' && line[2] == 'G') {
+
+        if(state != STATE_IDLE)
+            retval = Status_IdleError;
+
+        else switch(line[3]) {
+
+            case '\0':
+                retval = benchmark_parser(BENCHMARK_BLOCKS);
+                break;
+
+            case '=':
+                {
+                    float lines;
+                    uint_fast8_t counter = 4;
+                    if(!read_float(line, &counter, &lines) || lines < 1.0f)
+                        retval = Status_BadNumberFormat;
+                    else
+                        retval = benchmark_parser((uint32_t)lines);
+                }
+                break;
+
+            default:
+                retval = Status_InvalidStatement;
+                break;
+        }
+    } else if(line[1] == 'P' && line[2] == 'S') {
+
+        switch(line[3]) {
+
+            case '\0':
+                retval = benchmark_status(BENCHMARK_REPORTS);
+                break;
+
+            case '=':
+                {
+                    float reports;
+                    uint_fast8_t counter = 4;
+                    if(!read_float(line, &counter, &reports) || reports < 1.0f)
+                        retval = Status_BadNumberFormat;
+                    else
+                        retval = benchmark_status((uint32_t)reports);
+                }
+                break;
+
+            default:
+                retval = Status_InvalidStatement;
+                break;
+        }
+    } else if(line[1] == 'P' && line[2] == 'B') {
+
+        if(state != STATE_IDLE)
+            retval = Status_IdleError;
+
+        else switch(line[3]) {
+
+            case '\0':
+                retval = benchmark_run(BENCHMARK_BLOCKS);
+                break;
+
+            case '=':
+                {
+                    float blocks;
+                    uint_fast8_t counter = 4;
+                    if(!read_float(line, &counter, &blocks) || blocks < 1.0f)
+                        retval = Status_BadNumberFormat;
+                    else
+                        retval = benchmark_run((uint32_t)blocks);
+                }
+                break;
+
+            default:
+                retval = Status_InvalidStatement;
+                break;
+        }
+    } else if(on_sys_command_execute)
+        retval = on_sys_command_execute(state, line, lcline);
+
+    return retval;
+}
+
+void benchmark_init (void)
+{
+    on_sys_command_execute = hal.driver_sys_command_execute;
+    hal.driver_sys_command_execute = benchmark_parse;
+}
@@ -0,0 +1,709 @@
+/*
+  driver.c - An embedded CNC Controller with rs274/ngc (g-code) support
+
+  Driver code for Linux hosts (simulator)
+
+  Part of Grbl
+
+  Copyright (c) 2019 Terje Io
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//
+// Hardware is simulated:
+//   "interrupts" are signal handlers running on the main thread, disabling interrupts is done by blocking the signals.
+//   A 1 ms systick (SIGALRM) drives the stepper timer, serial RX and delays.
+//   Step pulses are counted to keep track of the physical position of each axis.
+//   Limit switches trigger at the ends of travel, the machine is started at mid-travel.
+//   The probe triggers at a configurable machine Z position.
+//   Control inputs are "pressed" by sending signals to the process:
+//     SIGUSR1 - feed hold, SIGUSR2 - cycle start, SIGQUIT - reset, SIGHUP - toggle safety door.
+//
+// In virtual clock mode simulated time is advanced from the main loop instead, one systick per call
+// to the realtime hook, delay or empty input read. Runs are then deterministic and as fast as the host allows.
+// The systick is kept as a watchdog for loops that do not call any of these, e.g. the homing cycle and the
+// alarm lock loop. These are run in real time and are thus not deterministic.
+//
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <time.h>
+#include <sys/time.h>
+
+#include "driver.h"
+#include "serial.h"
+#include "eeprom.h"
+#include "trace.h"
+#include "benchmark.h"
+
+#define WATCHDOG_TICKS 2 // Number of systicks without progress before the watchdog advances virtual time
+
+typedef struct {
+    bool enabled;               // Timer is running
+    uint32_t cycles_per_tick;   // Reload value
+    uint32_t count;             // Cycles left until next interrupt
+} step_timer_t;
+
+#ifdef STEP_PATTERN_OUTPUT
+typedef struct {
+    stepper_t *stepper;
+    axes_signals_t *pattern;    // Step outputs, one per timer tick
+    uint_fast16_t ticks;        // Number of entries in pattern, 0 when not playing
+    uint_fast16_t idx;          // Next entry to output
+} step_pattern_t;
+#endif
+
+sim_options_t sim = {
+    .eeprom_file = "grbl.eeprom"
+};
+
+static bool IOInitDone = false, probe_invert = false, limits_irq_enabled = false;
+static volatile uint32_t ms_count = 0, elapsed_ticks = 0;
+static volatile uint64_t cycles = 0;
+static volatile sig_atomic_t progress = 0;
+static void (*delayCallback)(void) = 0;
+static step_timer_t step_timer = {0};
+#ifdef STEP_PATTERN_OUTPUT
+static step_pattern_t step_pattern = {0};
+#endif
+static sigset_t irq_mask;
+static struct timespec systick_last;
+static spindle_state_t spindle_state = {0};
+static coolant_state_t coolant_state = {0};
+static axes_signals_t dir_outbits = {0}, limit_signals = {0};
+static volatile control_signals_t control_signals = {0};
+static int32_t motor_position[N_AXIS];  // Physical position in steps, 0 is at the positive end of travel
+static int32_t travel_steps[N_AXIS];    // Length of travel in steps
+
+static void systick_isr (uint32_t ticks);
+
+inline static void disable_irq (sigset_t *saved)
+{
+    sigprocmask(SIG_BLOCK, &irq_mask, saved);
+}
+
+inline static void enable_irq (sigset_t *saved)
+{
+    sigprocmask(SIG_SETMASK, saved, NULL);
+}
+
+// Advances virtual time by one systick, called from the main loop.
+static void sim_advance (void)
+{
+    sigset_t saved;
+
+    disable_irq(&saved);
+    progress = true;
+    systick_isr(1);
+    enable_irq(&saved);
+}
+
+uint64_t sim_get_cycles (void)
+{
+    return cycles;
+}
+
+// Host time in nanoseconds for profiling, not simulated time.
+static uint32_t getCycleCount (void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec);
+}
+
+// Milliseconds since startup, simulated time in virtual clock mode.
+static uint32_t getElapsedTicks (void)
+{
+    return elapsed_ticks;
+}
+
+static void driver_delay_ms (uint32_t ms, void (*callback)(void))
+{
+    if((ms_count = ms) > 0) {
+        if(!(delayCallback = callback)) {
+            while(ms_count) {
+                if(sim.virtual_clock)
+                    sim_advance();
+            }
+        }
+    } else if(callback)
+        callback();
+}
+
+// Enable/disable stepper motors
+static void stepperEnable (axes_signals_t enable)
+{
+    // Nothing to do, motors are always enabled.
+}
+
+#ifdef STEP_PATTERN_OUTPUT
+
+static void stepperPulseStart (stepper_t *stepper);
+
+// Starts playing out a precomputed step pattern, emulates a DMA transfer to the step outputs paced by the stepper timer.
+static void stepperPatternStart (stepper_t *stepper)
+{
+    step_pattern.stepper = stepper;
+    step_pattern.pattern = stepper->exec_segment->pattern;
+    step_pattern.ticks = stepper->exec_segment->pattern_ticks;
+    step_pattern.idx = 0;
+}
+
+// Outputs the next pattern entry, calls the stepper interrupt handler when the pattern is completed.
+static void stepper_pattern_tick (void)
+{
+    step_pattern.stepper->step_outbits = step_pattern.pattern[step_pattern.idx++];
+    stepperPulseStart(step_pattern.stepper);
+    step_pattern.stepper->step_outbits.value = 0;
+
+    if(step_pattern.idx == step_pattern.ticks) {
+        step_pattern.ticks = 0;
+        hal.stepper_interrupt_callback();
+    }
+}
+
+#endif
+
+// Runs the stepper timer for the given number of cycles, calls the stepper interrupt handler on each expiry.
+// NOTE: the handler sets the reload value for the next period so it is picked up after the call.
+static void stepper_timer_run (uint32_t budget)
+{
+    while(step_timer.enabled && budget >= step_timer.count) {
+        budget -= step_timer.count;
+        cycles += step_timer.count;
+#ifdef STEP_PATTERN_OUTPUT
+        if(step_pattern.ticks)
+            stepper_pattern_tick();
+        else
+#endif
+        hal.stepper_interrupt_callback();
+        step_timer.count = step_timer.cycles_per_tick;
+    }
+
+    if(step_timer.enabled)
+        step_timer.count -= budget;
+
+    cycles += budget;
+}
+
+// Resets and enables stepper driver ISR timer and forces a stepper driver interrupt callback
+static void stepperWakeUp (void)
+{
+    sigset_t saved;
+
+    stepperEnable((axes_signals_t){AXES_BITMASK});
+
+    disable_irq(&saved);
+
+    step_timer.enabled = true;
+    step_timer.cycles_per_tick = 0x000FFFFF;
+
+    hal.stepper_interrupt_callback();   // start the show
+
+    step_timer.count = step_timer.cycles_per_tick;
+
+    enable_irq(&saved);
+}
+
+// Disables stepper driver interrupts
+static void stepperGoIdle (void)
+{
+    step_timer.enabled = false;
+#ifdef STEP_PATTERN_OUTPUT
+    step_pattern.ticks = 0;
+#endif
+}
+
+// Sets up stepper driver interrupt timeout, AMASS version
+static void stepperCyclesPerTick (uint32_t cycles_per_tick)
+{
+// Limit min steps/s to about 2 (hal.f_step_timer @ 20MHz)
+#ifdef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+    step_timer.cycles_per_tick = cycles_per_tick < (1UL << 20) ? cycles_per_tick : 0x000FFFFF;
+#else
+    step_timer.cycles_per_tick = cycles_per_tick < (1UL << 23) ? cycles_per_tick : 0x007FFFFF;
+#endif
+    if(step_timer.cycles_per_tick == 0)
+        step_timer.cycles_per_tick = 1;
+
+    trace_tick(cycles, step_timer.cycles_per_tick);
+}
+
+// Returns limit state as an axes_signals_t variable.
+// Each bitfield bit indicates an axis limit, where triggered is 1 and not triggered is 0.
+// NOTE: the switches are simulated as triggered signals, the invert setting is thus not applied.
+inline static axes_signals_t limitsGetState()
+{
+    return limit_signals;
+}
+
+// Updates simulated limit switches and fires the limit interrupt on a new trigger.
+static void limits_update (void)
+{
+    uint_fast8_t idx = N_AXIS;
+    axes_signals_t signals = {0};
+
+    do {
+        idx--;
+        if(travel_steps[idx] && (motor_position[idx] >= 0 || motor_position[idx] <= -travel_steps[idx]))
+            signals.value |= bit(idx);
+    } while(idx);
+
+    if(signals.value != limit_signals.value) {
+        bool triggered = (signals.value & ~limit_signals.value) != 0;
+        limit_signals = signals;
+        if(triggered && limits_irq_enabled)
+            hal.limit_interrupt_callback(limitsGetState());
+    }
+}
+
+// Set stepper pulse output pins
+// NOTE: step pulses are counted on the leading edge, direction is taken from the last direction output.
+inline static void stepperSetStepOutputs (axes_signals_t step_outbits)
+{
+    if(step_outbits.value) {
+
+        uint_fast8_t idx = N_AXIS;
+
+        do {
+            idx--;
+            if(step_outbits.value & bit(idx))
+                motor_position[idx] += (dir_outbits.value & bit(idx)) ? -1 : 1;
+        } while(idx);
+
+        limits_update();
+    }
+}
+
+// Set stepper direction output pins
+inline static void stepperSetDirOutputs (axes_signals_t outbits)
+{
+    dir_outbits = outbits;
+}
+
+// Sets stepper direction and pulse pins and starts a step pulse
+static void stepperPulseStart (stepper_t *stepper)
+{
+    if(stepper->new_block) {
+        stepper->new_block = false;
+        stepperSetDirOutputs(stepper->dir_outbits);
+    }
+
+    if(stepper->step_outbits.value) {
+        stepperSetStepOutputs(stepper->step_outbits);
+        trace_step(cycles, stepper->step_outbits, dir_outbits);
+    }
+}
+
+// Enable/disable limit pins interrupt
+static void limitsEnable (bool on, bool homing)
+{
+    limits_irq_enabled = on && settings.limits.flags.hard_enabled;
+}
+
+// Returns system state as a control_signals_t variable.
+// Each bitfield bit indicates a control signal, where triggered is 1 and not triggered is 0.
+static control_signals_t systemGetState (void)
+{
+    return control_signals;
+}
+
+// Sets up the probe pin invert mask to
+// appropriately set the pin logic according to setting for normal-high/normal-low operation
+// and the probing cycle modes for toward-workpiece/away-from-workpiece.
+static void probeConfigureInvertMask (bool is_probe_away)
+{
+  probe_invert = settings.flags.invert_probe_pin;
+
+  if (is_probe_away)
+      probe_invert = !probe_invert;
+}
+
+// Returns the probe pin state. Triggered = true.
+// The pin level is simulated from machine Z position, pin level follows the invert setting as a real probe would.
+bool probeGetState (void)
+{
+    bool triggered = sim.probe_enable && (float)sys_position[Z_AXIS] / settings.steps_per_mm[Z_AXIS] <= sim.probe_z;
+
+    return (triggered ^ settings.flags.invert_probe_pin) ^ probe_invert;
+}
+
+// Start or stop spindle
+static void spindleSetState (spindle_state_t state, float rpm)
+{
+    spindle_state.on = state.on;
+    spindle_state.ccw = state.on && state.ccw;
+    sys.spindle_rpm = state.on ? rpm : 0.0f;
+}
+
+// Sets spindle speed
+static void spindleUpdateRPM (float rpm)
+{
+    sys.spindle_rpm = spindle_state.on ? rpm : 0.0f;
+}
+
+// Returns spindle state in a spindle_state_t variable
+static spindle_state_t spindleGetState (void)
+{
+    spindle_state_t state = spindle_state;
+
+    state.at_speed = state.on;
+
+    return state;
+}
+
+// Start/stop coolant (and mist if enabled)
+static void coolantSetState (coolant_state_t mode)
+{
+    coolant_state.flood = mode.flood;
+    coolant_state.mist = mode.mist;
+}
+
+// Returns coolant state in a coolant_state_t variable
+static coolant_state_t coolantGetState (void)
+{
+    return coolant_state;
+}
+
+// Helper functions for setting/clearing/inverting individual bits atomically (uninterruptable)
+static void bitsSetAtomic (volatile uint_fast16_t *ptr, uint_fast16_t bits)
+{
+    sigset_t saved;
+
+    disable_irq(&saved);
+    *ptr |= bits;
+    enable_irq(&saved);
+}
+
+static uint_fast16_t bitsClearAtomic (volatile uint_fast16_t *ptr, uint_fast16_t bits)
+{
+    sigset_t saved;
+
+    disable_irq(&saved);
+    uint_fast16_t prev = *ptr;
+    *ptr &= ~bits;
+    enable_irq(&saved);
+    return prev;
+}
+
+static uint_fast16_t valueSetAtomic (volatile uint_fast16_t *ptr, uint_fast16_t value)
+{
+    sigset_t saved;
+
+    disable_irq(&saved);
+    uint_fast16_t prev = *ptr;
+    *ptr = value;
+    enable_irq(&saved);
+    return prev;
+}
+
+static void showMessage (const char *msg)
+{
+    hal.stream.write("[MSG:");
+    hal.stream.write(msg);
+    hal.stream.write("]\r\n");
+}
+
+// Advances simulated time in virtual clock mode and terminates the process when the
+// input stream is exhausted and all lines read and motion is completed.
+static void executeRealtime (uint_fast16_t state)
+{
+    if(sim.virtual_clock)
+        sim_advance();
+
+    if(serialEOF() && (state == STATE_IDLE || (state & (STATE_ALARM|STATE_ESTOP|STATE_CHECK_MODE))) && plan_get_current_block() == NULL && protocol_get_lines_queued() == 0)
+        exit(state == STATE_IDLE || state == STATE_CHECK_MODE ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+// Stream read, advances virtual time when there is no input to process.
+static int16_t streamGetC (void)
+{
+    int16_t c = serialGetC();
+
+    if(c == SERIAL_NO_DATA && sim.virtual_clock)
+        sim_advance();
+
+    return c;
+}
+
+static uint16_t streamReadSpan (char **data)
+{
+    uint16_t length = serialReadSpan(data);
+
+    if(length == 0 && sim.virtual_clock)
+        sim_advance();
+
+    return length;
+}
+
+// Configures perhipherals when settings are initialized or changed
+static void settings_changed (settings_t *settings)
+{
+    uint_fast8_t idx = N_AXIS;
+
+    do {
+        idx--;
+        travel_steps[idx] = (int32_t)(-settings->max_travel[idx] * settings->steps_per_mm[idx]);
+    } while(idx);
+
+    if(IOInitDone) {
+        stepperEnable(settings->steppers.deenergize);
+        limits_update();
+    }
+}
+
+static bool driver_setup (settings_t *settings)
+{
+    uint_fast8_t idx = N_AXIS;
+
+ // Set defaults
+
+    IOInitDone = settings->version == 15;
+
+    settings_changed(settings);
+
+    // Start at mid-travel, away from the limit switches
+    do {
+        idx--;
+        motor_position[idx] = -travel_steps[idx] / 2;
+    } while(idx);
+
+    limits_update();
+
+    hal.spindle_set_state((spindle_state_t){0}, 0.0f);
+    hal.coolant_set_state((coolant_state_t){0});
+    stepperSetDirOutputs((axes_signals_t){0});
+
+    return IOInitDone;
+}
+
+static void eeprom_sync (void)
+{
+    if(settings_dirty.is_dirty)
+        eeprom_emu_sync_physical();
+}
+
+// Interrupt handler for 1 ms interval timer
+static void systick_isr (uint32_t ticks)
+{
+    while(ticks--) {
+
+        stepper_timer_run(F_STEP_TIMER / SYSTICK_RATE);
+
+        elapsed_ticks++;
+
+        if(ms_count && !(--ms_count)) {
+            if(delayCallback) {
+                void (*callback)(void) = delayCallback;
+                delayCallback = NULL;
+                callback();
+            }
+        }
+    }
+}
+
+// SIGALRM handler. Catches up with wall clock time in realtime mode since signals do not queue,
+// acts as a watchdog in virtual clock mode.
+static void systick_handler (int signum)
+{
+    static uint32_t idle_ticks = 0;
+
+    if(sim.virtual_clock) {
+        if(progress) {
+            progress = false;
+            idle_ticks = 0;
+        } else if(++idle_ticks >= WATCHDOG_TICKS) {
+            serialPoll();
+            if((sys.state & (STATE_ALARM|STATE_ESTOP)) && serialClosed())
+                exit(EXIT_FAILURE); // Locked in alarm state with no more input to process
+            systick_isr(1);
+        }
+    } else {
+
+        struct timespec now;
+        int64_t elapsed;
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        elapsed = (int64_t)(now.tv_sec - systick_last.tv_sec) * SYSTICK_RATE + (now.tv_nsec - systick_last.tv_nsec) / (1000000000L / SYSTICK_RATE);
+
+        if(elapsed > 0) {
+            systick_last.tv_sec += elapsed / SYSTICK_RATE;
+            systick_last.tv_nsec += (elapsed % SYSTICK_RATE) * (1000000000L / SYSTICK_RATE);
+            if(systick_last.tv_nsec >= 1000000000L) {
+                systick_last.tv_sec++;
+                systick_last.tv_nsec -= 1000000000L;
+            }
+            serialPoll();
+            systick_isr(elapsed > 50 ? 50 : (uint32_t)elapsed); // Do not try to catch up after the process has been stopped
+        }
+    }
+}
+
+// Signal handler for simulated control inputs
+static void control_handler (int signum)
+{
+    control_signals_t signals = control_signals;
+
+    switch(signum) {
+
+        case SIGUSR1:
+            signals.feed_hold = On;
+            break;
+
+        case SIGUSR2:
+            signals.cycle_start = On;
+            break;
+
+        case SIGQUIT:
+            signals.reset = On;
+            break;
+
+        case SIGHUP:
+            control_signals.safety_door_ajar = !control_signals.safety_door_ajar;
+            signals.safety_door_ajar = control_signals.safety_door_ajar;
+            break;
+    }
+
+    hal.control_interrupt_callback(signals);
+}
+
+// Initialize HAL pointers, setup serial comms and enable EEPROM
+// NOTE: Grbl is not yet configured (from EEPROM data), driver_setup() will be called when done
+bool driver_init (void)
+{
+    struct sigaction sa = {0};
+    struct itimerval systick = {
+        .it_interval.tv_usec = 1000000 / SYSTICK_RATE,
+        .it_value.tv_usec = 1000000 / SYSTICK_RATE
+    };
+
+    sigemptyset(&irq_mask);
+    sigaddset(&irq_mask, SIGALRM);
+    sigaddset(&irq_mask, SIGUSR1);
+    sigaddset(&irq_mask, SIGUSR2);
+    sigaddset(&irq_mask, SIGQUIT);
+    sigaddset(&irq_mask, SIGHUP);
+
+    if(!serialInit(sim.pty_link, sim.virtual_clock)) {
+        perror("grblHAL: stream");
+        exit(EXIT_FAILURE); // No stream to report failure on
+    }
+
+    if(!eepromInit(sim.eeprom_file)) {
+        perror("grblHAL: eeprom");
+        exit(EXIT_FAILURE);
+    }
+
+    hal.info = "Linux";
+    hal.driver_setup = driver_setup;
+    hal.f_step_timer = F_STEP_TIMER;
+    hal.rx_buffer_size = RX_BUFFER_SIZE;
+    hal.delay_ms = driver_delay_ms;
+    hal.settings_changed = settings_changed;
+
+    hal.stepper_wake_up = stepperWakeUp;
+    hal.stepper_go_idle = stepperGoIdle;
+    hal.stepper_enable = stepperEnable;
+    hal.stepper_set_outputs = stepperSetStepOutputs;
+    hal.stepper_set_directions = stepperSetDirOutputs;
+    hal.stepper_cycles_per_tick = stepperCyclesPerTick;
+    hal.stepper_pulse_start = stepperPulseStart;
+
+    hal.limits_enable = limitsEnable;
+    hal.limits_get_state = limitsGetState;
+
+    hal.coolant_set_state = coolantSetState;
+    hal.coolant_get_state = coolantGetState;
+
+    hal.probe_get_state = probeGetState;
+    hal.probe_configure_invert_mask = probeConfigureInvertMask;
+
+    hal.spindle_set_state = spindleSetState;
+    hal.spindle_get_state = spindleGetState;
+    hal.spindle_update_rpm = spindleUpdateRPM;
+
+    hal.system_control_get_state = systemGetState;
+
+    hal.show_message = showMessage;
+    hal.execute_realtime = executeRealtime;
+
+    hal.stream.read = streamGetC;
+    hal.stream.read_span = streamReadSpan;
+    hal.stream.read_commit = serialReadCommit;
+    hal.stream.get_rx_buffer_available = serialRxFree;
+    hal.stream.reset_read_buffer = serialRxFlush;
+    hal.stream.cancel_read_buffer = serialRxCancel;
+    hal.stream.write = serialWriteS;
+    hal.stream.write_all = serialWriteS;
+
+    hal.eeprom.type = EEPROM_Physical;
+    hal.eeprom.size = GRBL_EEPROM_SIZE;
+    hal.eeprom.get_byte = eepromGetByte;
+    hal.eeprom.put_byte = eepromPutByte;
+    hal.eeprom.memcpy_to_with_checksum = eepromWriteBlockWithChecksum;
+    hal.eeprom.memcpy_from_with_checksum = eepromReadBlockWithChecksum;
+
+    hal.set_bits_atomic = bitsSetAtomic;
+    hal.clear_bits_atomic = bitsClearAtomic;
+    hal.set_value_atomic = valueSetAtomic;
+
+    hal.f_cycle_counter = 1000000000UL;
+    hal.get_cycle_count = getCycleCount;
+    hal.get_elapsed_ticks = getElapsedTicks;
+
+#ifdef STEP_PATTERN_OUTPUT
+    if(sim.step_pattern)
+        hal.stepper_pattern_start = stepperPatternStart;
+#endif
+
+  // driver capabilities, used for announcing and negotiating (with Grbl) driver functionality
+
+    hal.driver_cap.spindle_dir = On;
+    hal.driver_cap.variable_spindle = On;
+    hal.driver_cap.mist_control = On;
+    hal.driver_cap.safety_door = On;
+    hal.driver_cap.amass_level = 3;
+    hal.driver_cap.control_pull_up = On;
+    hal.driver_cap.limits_pull_up = On;
+    hal.driver_cap.probe_pull_up = On;
+
+    // Interrupts are signals, handlers do not nest and are masked when "interrupts are disabled".
+    sa.sa_mask = irq_mask;
+    sa.sa_flags = SA_RESTART;
+
+    sa.sa_handler = control_handler;
+    sigaction(SIGUSR1, &sa, NULL);
+    sigaction(SIGUSR2, &sa, NULL);
+    sigaction(SIGQUIT, &sa, NULL);
+    sigaction(SIGHUP, &sa, NULL);
+
+    sa.sa_handler = systick_handler;
+    sigaction(SIGALRM, &sa, NULL);
+
+    clock_gettime(CLOCK_MONOTONIC, &systick_last);
+    setitimer(ITIMER_REAL, &systick, NULL);
+
+    benchmark_init();
+
+    atexit(eeprom_sync);
+
+    // no need to move version check before init - compiler will fail any mismatch for existing entries
+    return hal.version == 4;
+}
@@ -0,0 +1,63 @@
+/*
+  driver.h - An embedded CNC Controller with rs274/ngc (g-code) support
+
+  Driver code for Linux hosts (simulator)
+
+  Part of Grbl
+
+  Copyright (c) 2019 Terje Io
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __DRIVER_H__
+#define __DRIVER_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "GRBL/grbl.h"
+
+// Configuration
+
+#define F_STEP_TIMER    20000000UL  // Simulated stepper timer clock, in Hz.
+#define SYSTICK_RATE    1000        // Simulated systick interrupt rate, in Hz. Drives the stepper timer and serial RX polling.
+
+// End configuration
+
+// Simulator run options, set from the command line before grbl_enter() is called.
+
+typedef struct {
+    bool virtual_clock;         // Advance simulated time from the main loop only, makes runs deterministic.
+    char *eeprom_file;          // File backing the simulated EEPROM.
+    char *pty_link;             // If set, open a pseudo terminal for the stream and symlink its slave side here.
+    float probe_z;              // Machine Z position (mm) where the simulated probe triggers.
+    bool probe_enable;          // Probe input is simulated, probe_z is valid.
+    char *trace_file;           // If set, record step and direction outputs to this file.
+    char *trace_golden;         // If set, compare recorded outputs to this trace on exit.
+#ifdef STEP_PATTERN_OUTPUT
+    bool step_pattern;          // Play out precomputed step patterns instead of an interrupt per step.
+#endif
+} sim_options_t;
+
+extern sim_options_t sim;
+
+// Simulated machine time, in stepper timer cycles since boot.
+uint64_t sim_get_cycles (void);
+
+// Driver initialization entry point
+
+bool driver_init (void);
+
+#endif // __DRIVER_H__
@@ -0,0 +1,75 @@
+/*
+  eeprom.c - file backed EEPROM for Linux hosts (simulator)
+
+  Part of Grbl
+
+  Copyright (c) 2019 Terje Io
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <unistd.h>
+#include <fcntl.h>
+
+#include "GRBL/grbl.h"
+
+#include "driver.h"
+#include "eeprom.h"
+
+// The whole EEPROM image is kept in memory, writes are passed through to the backing file.
+// A missing or short file reads as erased (0xFF) memory.
+
+static uint8_t eeprom[GRBL_EEPROM_SIZE];
+static int fd = -1;
+
+static void eeprom_flush (uint32_t addr, uint32_t size)
+{
+    if(fd >= 0 && pwrite(fd, &eeprom[addr], size, addr) != (ssize_t)size)
+        fd = -1; // Stop writing on errors, settings are still available until exit
+}
+
+bool eepromInit (const char *filename)
+{
+    memset(eeprom, 0xFF, sizeof(eeprom));
+
+    if((fd = open(filename, O_RDWR|O_CREAT, 0644)) >= 0)
+        pread(fd, eeprom, sizeof(eeprom), 0);
+
+    return fd >= 0;
+}
+
+uint8_t eepromGetByte (uint32_t addr)
+{
+    return eeprom[addr];
+}
+
+void eepromPutByte (uint32_t addr, uint8_t new_value)
+{
+    eeprom[addr] = new_value;
+    eeprom_flush(addr, 1);
+}
+
+void eepromWriteBlockWithChecksum (uint32_t destination, uint8_t *source, uint32_t size)
+{
+    memcpy(&eeprom[destination], source, size);
+    eeprom[destination + size] = calc_checksum(source, size);
+    eeprom_flush(destination, size + 1);
+}
+
+bool eepromReadBlockWithChecksum (uint8_t *destination, uint32_t source, uint32_t size)
+{
+    memcpy(destination, &eeprom[source], size);
+
+    return calc_checksum(destination, size) == eeprom[source + size];
+}
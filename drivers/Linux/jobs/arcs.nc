@@ -0,0 +1,24 @@
+(Full circles and arcs in all planes)
+$100=80
+$101=80
+$102=80
+$110=3000
+$111=3000
+$112=1500
+$120=200
+$121=200
+$122=100
+$11=0.01
+$12=0.002
+G21 G90 G17
+G0 X20 Y0 Z5
+G1 Z0 F400
+G2 X20 Y0 I-10 J0 F1200
+G3 X0 Y20 R20
+G2 X-20 Y0 I0 J-20 F600
+G18 G2 X-10 Z0 I5 K0
+G19 G3 Y10 Z0 J5 K0
+G17 G3 X20 Y0 I15 J-5 F1500
+G0 Z5
+G0 X0 Y0
+M2
@@ -0,0 +1,78 @@
+(G64 P- path blending of a star shaped polyline)
+$100=80
+$101=80
+$102=80
+$110=3000
+$111=3000
+$112=1500
+$120=200
+$121=200
+$122=100
+$11=0.01
+$12=0.002
+G21 G90 G64 P0.05
+G0 X0 Y0 Z0
+G1 F2400
+X30.000 Y20.000
+X32.716 Y22.703
+X29.135 Y24.067
+X30.517 Y27.641
+X26.691 Y27.431
+X26.500 Y31.258
+X23.090 Y29.511
+X21.359 Y32.929
+X18.955 Y29.945
+X15.983 Y32.364
+X15.000 Y28.660
+X11.301 Y29.661
+X11.910 Y25.878
+X8.124 Y25.288
+X10.219 Y22.079
+X7.000 Y20.000
+X10.219 Y17.921
+X8.124 Y14.712
+X11.910 Y14.122
+X11.301 Y10.339
+X15.000 Y11.340
+X15.983 Y7.636
+X18.955 Y10.055
+X21.359 Y7.071
+X23.090 Y10.489
+X26.500 Y8.742
+X26.691 Y12.569
+X30.517 Y12.359
+X29.135 Y15.933
+X32.716 Y17.297
+X30.000 Y20.000
+X32.716 Y22.703
+X29.135 Y24.067
+X30.517 Y27.641
+X26.691 Y27.431
+X26.500 Y31.258
+X23.090 Y29.511
+X21.359 Y32.929
+X18.955 Y29.945
+X15.983 Y32.364
+X15.000 Y28.660
+X11.301 Y29.661
+X11.910 Y25.878
+X8.124 Y25.288
+X10.219 Y22.079
+X7.000 Y20.000
+X10.219 Y17.921
+X8.124 Y14.712
+X11.910 Y14.122
+X11.301 Y10.339
+X15.000 Y11.340
+X15.983 Y7.636
+X18.955 Y10.055
+X21.359 Y7.071
+X23.090 Y10.489
+X26.500 Y8.742
+X26.691 Y12.569
+X30.517 Y12.359
+X29.135 Y15.933
+X32.716 Y17.297
+G61
+G1 X0 Y0
+M2
@@ -0,0 +1,64 @@
+#!/bin/sh
+#
+# deviation.sh - reports how much a build deviates from a reference build on the job corpus
+#
+# Intended for compile time options that alter planner math such as PLANNER_FIXED_POINT, where
+# traces are not expected to be identical. Each job is recorded with the reference build and
+# compared to a run of the other, the motion time difference and final positions are reported.
+#
+# Usage: deviation.sh reference_simulator simulator
+#
+# e.g. deviation.sh ./grblHAL_sim ./grblHAL_sim_fx
+#
+# Exit code is 1 if a final position or step count differs or a job fails.
+#
+
+if [ $# -ne 2 ]; then
+    echo "usage: $0 reference_simulator simulator"
+    exit 1
+fi
+
+dir=$(dirname "$0")
+reference=$1
+sim=$2
+
+tmp=$(mktemp -d) || exit 1
+trap 'rm -rf "$tmp"' EXIT
+
+failed=0
+
+printf "%-10s %12s %12s %12s %8s  %s\n" job reference time delta ppm steps
+
+for job in "$dir"/*.nc; do
+
+    name=$(basename "$job" .nc)
+
+    rm -f "$tmp/eeprom"
+    if ! "$reference" -v -e "$tmp/eeprom" -t "$tmp/ref.trc" < "$job" > /dev/null 2>&1; then
+        echo "$name: reference run failed"
+        failed=1
+        continue
+    fi
+
+    rm -f "$tmp/eeprom"
+    "$sim" -v -e "$tmp/eeprom" -c "$tmp/ref.trc" < "$job" > /dev/null 2> "$tmp/err"
+
+    # Line format: trace: time <run> s (golden <reference> s, <delta> s)
+    set -- $(grep '^trace: time' "$tmp/err" | tr -d '(),+')
+    if [ $# -lt 9 ]; then
+        echo "$name: run failed"
+        failed=1
+        continue
+    fi
+
+    if grep -q '^trace: . steps.*\*$\|truncated' "$tmp/err"; then
+        steps=differ
+        failed=1
+    else
+        steps=match
+    fi
+
+    printf "%-10s %12s %12s %12s %8.1f  %s\n" "$name" "$6" "$3" "$8" "$(echo "$8 $6" | awk '{ print ($2 > 0 ? $1 * 1000000 / $2 : 0) }')" "$steps"
+done
+
+exit $failed
@@ -0,0 +1,24 @@
+(Jerk limited S-curve acceleration)
+$100=80
+$101=80
+$102=80
+$110=3000
+$111=3000
+$112=1500
+$120=200
+$121=200
+$122=100
+$11=0.01
+$12=0.002
+$160=2000
+$161=2000
+$162=1000
+G21 G90
+G0 X30 Y0
+G0 X0 Y30
+G1 X20 Y20 F2000
+X25 Y20
+X25 Y25
+G1 X0 Y0 Z-2 F1200
+G0 Z0
+M2
@@ -0,0 +1,29 @@
+(Rapids, feeds and corners at different angles)
+$100=80
+$101=80
+$102=80
+$110=3000
+$111=3000
+$112=1500
+$120=200
+$121=200
+$122=100
+$11=0.01
+$12=0.002
+G21 G90 G94 G54
+G0 X10 Y10 Z5
+G1 Z0 F300
+G1 X40 F1500
+Y40
+X10
+Y10
+G1 X25 Y35 F2000
+X40 Y10
+X10 Y20 F800
+X40 Y22
+X10 Y24
+G0 Z5
+G0 X0 Y0
+G1 X5 Y1 Z-1 F500
+G0 Z5
+M2
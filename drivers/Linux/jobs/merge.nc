@@ -0,0 +1,317 @@
+(Nearly collinear short lines merged into single blocks)
+$100=80
+$101=80
+$102=80
+$110=3000
+$111=3000
+$112=1500
+$120=200
+$121=200
+$122=100
+$11=0.01
+$12=0.002
+$40=0.01
+G21 G90
+G0 X0 Y0 Z0
+G1 F2500
+X0.200 Y0.1000
+X0.400 Y0.2000
+X0.600 Y0.3030
+X0.800 Y0.4000
+X1.000 Y0.5000
+X1.200 Y0.6030
+X1.400 Y0.7000
+X1.600 Y0.8000
+X1.800 Y0.9030
+X2.000 Y1.0000
+X2.200 Y1.1000
+X2.400 Y1.2030
+X2.600 Y1.3000
+X2.800 Y1.4000
+X3.000 Y1.5030
+X3.200 Y1.6000
+X3.400 Y1.7000
+X3.600 Y1.8030
+X3.800 Y1.9000
+X4.000 Y2.0000
+X4.200 Y2.1030
+X4.400 Y2.2000
+X4.600 Y2.3000
+X4.800 Y2.4030
+X5.000 Y2.5000
+X5.200 Y2.6000
+X5.400 Y2.7030
+X5.600 Y2.8000
+X5.800 Y2.9000
+X6.000 Y3.0030
+X6.200 Y3.1000
+X6.400 Y3.2000
+X6.600 Y3.3030
+X6.800 Y3.4000
+X7.000 Y3.5000
+X7.200 Y3.6030
+X7.400 Y3.7000
+X7.600 Y3.8000
+X7.800 Y3.9030
+X8.000 Y4.0000
+X8.200 Y4.1000
+X8.400 Y4.2030
+X8.600 Y4.3000
+X8.800 Y4.4000
+X9.000 Y4.5030
+X9.200 Y4.6000
+X9.400 Y4.7000
+X9.600 Y4.8030
+X9.800 Y4.9000
+X10.000 Y5.0000
+X10.200 Y5.1030
+X10.400 Y5.2000
+X10.600 Y5.3000
+X10.800 Y5.4030
+X11.000 Y5.5000
+X11.200 Y5.6000
+X11.400 Y5.7030
+X11.600 Y5.8000
+X11.800 Y5.9000
+X12.000 Y6.0030
+X12.200 Y6.1000
+X12.400 Y6.2000
+X12.600 Y6.3030
+X12.800 Y6.4000
+X13.000 Y6.5000
+X13.200 Y6.6030
+X13.400 Y6.7000
+X13.600 Y6.8000
+X13.800 Y6.9030
+X14.000 Y7.0000
+X14.200 Y7.1000
+X14.400 Y7.2030
+X14.600 Y7.3000
+X14.800 Y7.4000
+X15.000 Y7.5030
+X15.200 Y7.6000
+X15.400 Y7.7000
+X15.600 Y7.8030
+X15.800 Y7.9000
+X16.000 Y8.0000
+X16.200 Y8.1030
+X16.400 Y8.2000
+X16.600 Y8.3000
+X16.800 Y8.4030
+X17.000 Y8.5000
+X17.200 Y8.6000
+X17.400 Y8.7030
+X17.600 Y8.8000
+X17.800 Y8.9000
+X18.000 Y9.0030
+X18.200 Y9.1000
+X18.400 Y9.2000
+X18.600 Y9.3030
+X18.800 Y9.4000
+X19.000 Y9.5000
+X19.200 Y9.6030
+X19.400 Y9.7000
+X19.600 Y9.8000
+X19.800 Y9.9030
+X20.000 Y10.0000
+X20.200 Y10.1000
+X20.400 Y10.2030
+X20.600 Y10.3000
+X20.800 Y10.4000
+X21.000 Y10.5030
+X21.200 Y10.6000
+X21.400 Y10.7000
+X21.600 Y10.8030
+X21.800 Y10.9000
+X22.000 Y11.0000
+X22.200 Y11.1030
+X22.400 Y11.2000
+X22.600 Y11.3000
+X22.800 Y11.4030
+X23.000 Y11.5000
+X23.200 Y11.6000
+X23.400 Y11.7030
+X23.600 Y11.8000
+X23.800 Y11.9000
+X24.000 Y12.0030
+X24.200 Y12.1000
+X24.400 Y12.2000
+X24.600 Y12.3030
+X24.800 Y12.4000
+X25.000 Y12.5000
+X25.200 Y12.6030
+X25.400 Y12.7000
+X25.600 Y12.8000
+X25.800 Y12.9030
+X26.000 Y13.0000
+X26.200 Y13.1000
+X26.400 Y13.2030
+X26.600 Y13.3000
+X26.800 Y13.4000
+X27.000 Y13.5030
+X27.200 Y13.6000
+X27.400 Y13.7000
+X27.600 Y13.8030
+X27.800 Y13.9000
+X28.000 Y14.0000
+X28.200 Y14.1030
+X28.400 Y14.2000
+X28.600 Y14.3000
+X28.800 Y14.4030
+X29.000 Y14.5000
+X29.200 Y14.6000
+X29.400 Y14.7030
+X29.600 Y14.8000
+X29.800 Y14.9000
+X30.000 Y15.0030
+X30.200 Y15.1000
+X30.400 Y15.2000
+X30.600 Y15.3030
+X30.800 Y15.4000
+X31.000 Y15.5000
+X31.200 Y15.6030
+X31.400 Y15.7000
+X31.600 Y15.8000
+X31.800 Y15.9030
+X32.000 Y16.0000
+X32.200 Y16.1000
+X32.400 Y16.2030
+X32.600 Y16.3000
+X32.800 Y16.4000
+X33.000 Y16.5030
+X33.200 Y16.6000
+X33.400 Y16.7000
+X33.600 Y16.8030
+X33.800 Y16.9000
+X34.000 Y17.0000
+X34.200 Y17.1030
+X34.400 Y17.2000
+X34.600 Y17.3000
+X34.800 Y17.4030
+X35.000 Y17.5000
+X35.200 Y17.6000
+X35.400 Y17.7030
+X35.600 Y17.8000
+X35.800 Y17.9000
+X36.000 Y18.0030
+X36.200 Y18.1000
+X36.400 Y18.2000
+X36.600 Y18.3030
+X36.800 Y18.4000
+X37.000 Y18.5000
+X37.200 Y18.6030
+X37.400 Y18.7000
+X37.600 Y18.8000
+X37.800 Y18.9030
+X38.000 Y19.0000
+X38.200 Y19.1000
+X38.400 Y19.2030
+X38.600 Y19.3000
+X38.800 Y19.4000
+X39.000 Y19.5030
+X39.200 Y19.6000
+X39.400 Y19.7000
+X39.600 Y19.8030
+X39.800 Y19.9000
+X40.000 Y20.0000
+X40.200 Y19.950
+X40.400 Y19.900
+X40.600 Y19.850
+X40.800 Y19.800
+X41.000 Y19.750
+X41.200 Y19.700
+X41.400 Y19.650
+X41.600 Y19.600
+X41.800 Y19.550
+X42.000 Y19.500
+X42.200 Y19.450
+X42.400 Y19.400
+X42.600 Y19.350
+X42.800 Y19.300
+X43.000 Y19.250
+X43.200 Y19.200
+X43.400 Y19.150
+X43.600 Y19.100
+X43.800 Y19.050
+X44.000 Y19.000
+X44.200 Y18.950
+X44.400 Y18.900
+X44.600 Y18.850
+X44.800 Y18.800
+X45.000 Y18.750
+X45.200 Y18.700
+X45.400 Y18.650
+X45.600 Y18.600
+X45.800 Y18.550
+X46.000 Y18.500
+X46.200 Y18.450
+X46.400 Y18.400
+X46.600 Y18.350
+X46.800 Y18.300
+X47.000 Y18.250
+X47.200 Y18.200
+X47.400 Y18.150
+X47.600 Y18.100
+X47.800 Y18.050
+X48.000 Y18.000
+X48.200 Y17.950
+X48.400 Y17.900
+X48.600 Y17.850
+X48.800 Y17.800
+X49.000 Y17.750
+X49.200 Y17.700
+X49.400 Y17.650
+X49.600 Y17.600
+X49.800 Y17.550
+X50.000 Y17.500
+X50.200 Y17.450
+X50.400 Y17.400
+X50.600 Y17.350
+X50.800 Y17.300
+X51.000 Y17.250
+X51.200 Y17.200
+X51.400 Y17.150
+X51.600 Y17.100
+X51.800 Y17.050
+X52.000 Y17.000
+X52.200 Y16.950
+X52.400 Y16.900
+X52.600 Y16.850
+X52.800 Y16.800
+X53.000 Y16.750
+X53.200 Y16.700
+X53.400 Y16.650
+X53.600 Y16.600
+X53.800 Y16.550
+X54.000 Y16.500
+X54.200 Y16.450
+X54.400 Y16.400
+X54.600 Y16.350
+X54.800 Y16.300
+X55.000 Y16.250
+X55.200 Y16.200
+X55.400 Y16.150
+X55.600 Y16.100
+X55.800 Y16.050
+X56.000 Y16.000
+X56.200 Y15.950
+X56.400 Y15.900
+X56.600 Y15.850
+X56.800 Y15.800
+X57.000 Y15.750
+X57.200 Y15.700
+X57.400 Y15.650
+X57.600 Y15.600
+X57.800 Y15.550
+X58.000 Y15.500
+X58.200 Y15.450
+X58.400 Y15.400
+X58.600 Y15.350
+X58.800 Y15.300
+X59.000 Y15.250
+X59.200 Y15.200
+X59.400 Y15.150
+X59.600 Y15.100
+X59.800 Y15.050
+X60.000 Y15.000
+M2
@@ -0,0 +1,56 @@
+#!/bin/sh
+#
+# parser_check.sh - differential check of the g-code parser against a reference build
+#
+# Streams a randomized corpus from doc/script/gcode_corpus.py to both builds, each with a new
+# settings file, and compares the responses line by line and the step traces. The corpus contains
+# erroneous lines and $G and $# reports so that error codes, the modal state and offsets are
+# compared too. Motion is executed rather than checked with $C, as $# is not available in check
+# mode and the traces show differences in computed targets. Settings are for a coarse resolution
+# and high rates to keep the traces small and the run time short.
+#
+# Usage: parser_check.sh reference_simulator simulator [lines [seed]]
+#
+# e.g. parser_check.sh ./grblHAL_sim_ref ./grblHAL_sim 10000
+#
+# Exit code is 1 if any response or the traces differ, the first differences are listed.
+#
+
+if [ $# -lt 2 ]; then
+    echo "usage: $0 reference_simulator simulator [lines [seed]]"
+    exit 1
+fi
+
+dir=$(dirname "$0")
+reference=$1
+sim=$2
+
+tmp=$(mktemp -d) || exit 1
+trap 'rm -rf "$tmp"' EXIT
+
+{
+    for axis in 0 1 2; do
+        echo "\$10$axis=10"
+        echo "\$11$axis=60000"
+        echo "\$12$axis=10000"
+    done
+    python3 "$dir/../../../doc/script/gcode_corpus.py" ${3:-10000} ${4:-1}
+} > "$tmp/corpus.nc" || exit 1
+
+"$reference" -v -e "$tmp/ref.eeprom" -t "$tmp/ref.trc" < "$tmp/corpus.nc" > "$tmp/ref.txt" 2>&1
+"$sim" -v -e "$tmp/sim.eeprom" -c "$tmp/ref.trc" < "$tmp/corpus.nc" > "$tmp/sim.txt" 2> "$tmp/trace.txt"
+status=$?
+
+lines=$(wc -l < "$tmp/corpus.nc")
+errors=$(grep -c '^error' "$tmp/sim.txt")
+
+if cmp -s "$tmp/ref.txt" "$tmp/sim.txt" && [ $status -eq 0 ]; then
+    echo "$lines lines, $errors errors, responses and step traces identical"
+    exit 0
+fi
+
+echo "$lines lines, responses or step traces differ:"
+diff "$tmp/ref.txt" "$tmp/sim.txt" | head -20
+grep '^trace:' "$tmp/trace.txt"
+
+exit 1
@@ -0,0 +1,61 @@
+#!/bin/sh
+#
+# run.sh - step trace regression suite for the Linux simulator
+#
+# Replays the jobs in this directory in virtual clock mode and compares the step and direction
+# outputs to the golden traces recorded with them. Each job is run with a new settings file,
+# settings used are set at the start of the job.
+#
+# Usage: run.sh [-r] [simulator [options]]
+#
+#   -r          record new golden traces, to be committed with the change that alters motion
+#   simulator   defaults to ./grblHAL_sim, options are passed on, e.g. run.sh ./grblHAL_sim -s
+#
+# Exit code is 1 if a trace differs or a job line fails.
+#
+
+dir=$(dirname "$0")
+record=0
+
+if [ "$1" = "-r" ]; then
+    record=1
+    shift
+fi
+
+sim=${1:-./grblHAL_sim}
+[ $# -gt 0 ] && shift
+
+tmp=$(mktemp -d) || exit 1
+trap 'rm -rf "$tmp"' EXIT
+
+failed=0
+
+for job in "$dir"/*.nc; do
+
+    name=$(basename "$job" .nc)
+    golden="$dir/$name.trc"
+
+    rm -f "$tmp/eeprom"
+
+    if [ $record -eq 1 ]; then
+        "$sim" -v -e "$tmp/eeprom" "$@" -t "$golden" < "$job" > "$tmp/log" 2> "$tmp/err"
+    else
+        "$sim" -v -e "$tmp/eeprom" "$@" -c "$golden" < "$job" > "$tmp/log" 2> "$tmp/err"
+    fi
+    status=$?
+
+    # Responses before the startup banner are from initializing the new settings file.
+    errors=$(sed '1,/^GrblHAL/d' "$tmp/log" | grep -c '^error')
+
+    if [ $status -ne 0 ] || [ "$errors" -ne 0 ]; then
+        echo "$name: FAILED, exit code $status, $errors line(s) failed"
+        grep '^trace:' "$tmp/err"
+        failed=1
+    elif [ $record -eq 1 ]; then
+        echo "$name: recorded"
+    else
+        echo "$name: ok, $(grep '^trace: time' "$tmp/err" | cut -d' ' -f3-4)"
+    fi
+done
+
+exit $failed
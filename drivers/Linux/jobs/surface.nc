@@ -0,0 +1,3630 @@
+(CAM style surfacing, 0.1 mm segments over a wavy surface)
+$100=80
+$101=80
+$102=80
+$110=3000
+$111=3000
+$112=1500
+$120=200
+$121=200
+$122=100
+$11=0.01
+$12=0.002
+G21 G90
+G0 X0 Y0 Z2
+G1 Z0 F500
+F3000
+X0.000 Y0.000 Z0.000
+X0.100 Y0.000 Z0.020
+X0.200 Y0.000 Z0.040
+X0.300 Y0.000 Z0.060
+X0.400 Y0.000 Z0.080
+X0.500 Y0.000 Z0.099
+X0.600 Y0.000 Z0.119
+X0.700 Y0.000 Z0.138
+X0.800 Y0.000 Z0.157
+X0.900 Y0.000 Z0.176
+X1.000 Y0.000 Z0.195
+X1.100 Y0.000 Z0.213
+X1.200 Y0.000 Z0.231
+X1.300 Y0.000 Z0.248
+X1.400 Y0.000 Z0.266
+X1.500 Y0.000 Z0.282
+X1.600 Y0.000 Z0.299
+X1.700 Y0.000 Z0.314
+X1.800 Y0.000 Z0.330
+X1.900 Y0.000 Z0.344
+X2.000 Y0.000 Z0.359
+X2.100 Y0.000 Z0.372
+X2.200 Y0.000 Z0.385
+X2.300 Y0.000 Z0.398
+X2.400 Y0.000 Z0.410
+X2.500 Y0.000 Z0.421
+X2.600 Y0.000 Z0.431
+X2.700 Y0.000 Z0.441
+X2.800 Y0.000 Z0.450
+X2.900 Y0.000 Z0.458
+X3.000 Y0.000 Z0.466
+X3.100 Y0.000 Z0.473
+X3.200 Y0.000 Z0.479
+X3.300 Y0.000 Z0.484
+X3.400 Y0.000 Z0.489
+X3.500 Y0.000 Z0.493
+X3.600 Y0.000 Z0.496
+X3.700 Y0.000 Z0.498
+X3.800 Y0.000 Z0.499
+X3.900 Y0.000 Z0.500
+X4.000 Y0.000 Z0.500
+X4.100 Y0.000 Z0.499
+X4.200 Y0.000 Z0.497
+X4.300 Y0.000 Z0.494
+X4.400 Y0.000 Z0.491
+X4.500 Y0.000 Z0.487
+X4.600 Y0.000 Z0.482
+X4.700 Y0.000 Z0.476
+X4.800 Y0.000 Z0.470
+X4.900 Y0.000 Z0.463
+X5.000 Y0.000 Z0.455
+X5.100 Y0.000 Z0.446
+X5.200 Y0.000 Z0.437
+X5.300 Y0.000 Z0.426
+X5.400 Y0.000 Z0.416
+X5.500 Y0.000 Z0.404
+X5.600 Y0.000 Z0.392
+X5.700 Y0.000 Z0.379
+X5.800 Y0.000 Z0.366
+X5.900 Y0.000 Z0.352
+X6.000 Y0.000 Z0.338
+X6.100 Y0.000 Z0.323
+X6.200 Y0.000 Z0.307
+X6.300 Y0.000 Z0.291
+X6.400 Y0.000 Z0.275
+X6.500 Y0.000 Z0.258
+X6.600 Y0.000 Z0.240
+X6.700 Y0.000 Z0.223
+X6.800 Y0.000 Z0.205
+X6.900 Y0.000 Z0.186
+X7.000 Y0.000 Z0.167
+X7.100 Y0.000 Z0.149
+X7.200 Y0.000 Z0.129
+X7.300 Y0.000 Z0.110
+X7.400 Y0.000 Z0.090
+X7.500 Y0.000 Z0.071
+X7.600 Y0.000 Z0.051
+X7.700 Y0.000 Z0.031
+X7.800 Y0.000 Z0.011
+X7.900 Y0.000 Z-0.009
+X8.000 Y0.000 Z-0.029
+X8.100 Y0.000 Z-0.049
+X8.200 Y0.000 Z-0.069
+X8.300 Y0.000 Z-0.089
+X8.400 Y0.000 Z-0.108
+X8.500 Y0.000 Z-0.128
+X8.600 Y0.000 Z-0.147
+X8.700 Y0.000 Z-0.166
+X8.800 Y0.000 Z-0.185
+X8.900 Y0.000 Z-0.203
+X9.000 Y0.000 Z-0.221
+X9.100 Y0.000 Z-0.239
+X9.200 Y0.000 Z-0.256
+X9.300 Y0.000 Z-0.273
+X9.400 Y0.000 Z-0.290
+X9.500 Y0.000 Z-0.306
+X9.600 Y0.000 Z-0.321
+X9.700 Y0.000 Z-0.337
+X9.800 Y0.000 Z-0.351
+X9.900 Y0.000 Z-0.365
+X10.000 Y0.000 Z-0.378
+X10.100 Y0.000 Z-0.391
+X10.200 Y0.000 Z-0.403
+X10.300 Y0.000 Z-0.415
+X10.400 Y0.000 Z-0.426
+X10.500 Y0.000 Z-0.436
+X10.600 Y0.000 Z-0.445
+X10.700 Y0.000 Z-0.454
+X10.800 Y0.000 Z-0.462
+X10.900 Y0.000 Z-0.469
+X11.000 Y0.000 Z-0.476
+X11.100 Y0.000 Z-0.482
+X11.200 Y0.000 Z-0.487
+X11.300 Y0.000 Z-0.491
+X11.400 Y0.000 Z-0.494
+X11.500 Y0.000 Z-0.497
+X11.600 Y0.000 Z-0.499
+X11.700 Y0.000 Z-0.500
+X11.800 Y0.000 Z-0.500
+X11.900 Y0.000 Z-0.499
+X12.000 Y0.000 Z-0.498
+X12.100 Y0.000 Z-0.496
+X12.200 Y0.000 Z-0.493
+X12.300 Y0.000 Z-0.489
+X12.400 Y0.000 Z-0.485
+X12.500 Y0.000 Z-0.479
+X12.600 Y0.000 Z-0.473
+X12.700 Y0.000 Z-0.467
+X12.800 Y0.000 Z-0.459
+X12.900 Y0.000 Z-0.451
+X13.000 Y0.000 Z-0.442
+X13.100 Y0.000 Z-0.432
+X13.200 Y0.000 Z-0.422
+X13.300 Y0.000 Z-0.411
+X13.400 Y0.000 Z-0.399
+X13.500 Y0.000 Z-0.386
+X13.600 Y0.000 Z-0.373
+X13.700 Y0.000 Z-0.360
+X13.800 Y0.000 Z-0.346
+X13.900 Y0.000 Z-0.331
+X14.000 Y0.000 Z-0.316
+X14.100 Y0.000 Z-0.300
+X14.200 Y0.000 Z-0.284
+X14.300 Y0.000 Z-0.267
+X14.400 Y0.000 Z-0.250
+X14.500 Y0.000 Z-0.232
+X14.600 Y0.000 Z-0.214
+X14.700 Y0.000 Z-0.196
+X14.800 Y0.000 Z-0.178
+X14.900 Y0.000 Z-0.159
+X15.000 Y0.000 Z-0.140
+X15.100 Y0.000 Z-0.120
+X15.200 Y0.000 Z-0.101
+X15.300 Y0.000 Z-0.081
+X15.400 Y0.000 Z-0.061
+X15.500 Y0.000 Z-0.042
+X15.600 Y0.000 Z-0.022
+X15.700 Y0.000 Z-0.002
+X15.800 Y0.000 Z0.018
+X15.900 Y0.000 Z0.038
+X16.000 Y0.000 Z0.058
+X16.100 Y0.000 Z0.078
+X16.200 Y0.000 Z0.098
+X16.300 Y0.000 Z0.117
+X16.400 Y0.000 Z0.137
+X16.500 Y0.000 Z0.156
+X16.600 Y0.000 Z0.175
+X16.700 Y0.000 Z0.193
+X16.800 Y0.000 Z0.212
+X16.900 Y0.000 Z0.229
+X17.000 Y0.000 Z0.247
+X17.100 Y0.000 Z0.264
+X17.200 Y0.000 Z0.281
+X17.300 Y0.000 Z0.297
+X17.400 Y0.000 Z0.313
+X17.500 Y0.000 Z0.328
+X17.600 Y0.000 Z0.343
+X17.700 Y0.000 Z0.358
+X17.800 Y0.000 Z0.371
+X17.900 Y0.000 Z0.384
+X18.000 Y0.000 Z0.397
+X18.100 Y0.000 Z0.409
+X18.200 Y0.000 Z0.420
+X18.300 Y0.000 Z0.430
+X18.400 Y0.000 Z0.440
+X18.500 Y0.000 Z0.449
+X18.600 Y0.000 Z0.458
+X18.700 Y0.000 Z0.465
+X18.800 Y0.000 Z0.472
+X18.900 Y0.000 Z0.479
+X19.000 Y0.000 Z0.484
+X19.100 Y0.000 Z0.489
+X19.200 Y0.000 Z0.492
+X19.300 Y0.000 Z0.496
+X19.400 Y0.000 Z0.498
+X19.500 Y0.000 Z0.499
+X19.600 Y0.000 Z0.500
+X19.700 Y0.000 Z0.500
+X19.800 Y0.000 Z0.499
+X19.900 Y0.000 Z0.497
+X20.000 Y0.000 Z0.495
+X20.100 Y0.000 Z0.491
+X20.200 Y0.000 Z0.487
+X20.300 Y0.000 Z0.482
+X20.400 Y0.000 Z0.477
+X20.500 Y0.000 Z0.470
+X20.600 Y0.000 Z0.463
+X20.700 Y0.000 Z0.455
+X20.800 Y0.000 Z0.447
+X20.900 Y0.000 Z0.437
+X21.000 Y0.000 Z0.427
+X21.100 Y0.000 Z0.417
+X21.200 Y0.000 Z0.405
+X21.300 Y0.000 Z0.393
+X21.400 Y0.000 Z0.380
+X21.500 Y0.000 Z0.367
+X21.600 Y0.000 Z0.353
+X21.700 Y0.000 Z0.339
+X21.800 Y0.000 Z0.324
+X21.900 Y0.000 Z0.308
+X22.000 Y0.000 Z0.292
+X22.100 Y0.000 Z0.276
+X22.200 Y0.000 Z0.259
+X22.300 Y0.000 Z0.242
+X22.400 Y0.000 Z0.224
+X22.500 Y0.000 Z0.206
+X22.600 Y0.000 Z0.188
+X22.700 Y0.000 Z0.169
+X22.800 Y0.000 Z0.150
+X22.900 Y0.000 Z0.131
+X23.000 Y0.000 Z0.111
+X23.100 Y0.000 Z0.092
+X23.200 Y0.000 Z0.072
+X23.300 Y0.000 Z0.052
+X23.400 Y0.000 Z0.032
+X23.500 Y0.000 Z0.012
+X23.600 Y0.000 Z-0.008
+X23.700 Y0.000 Z-0.028
+X23.800 Y0.000 Z-0.048
+X23.900 Y0.000 Z-0.067
+X24.000 Y0.000 Z-0.087
+X24.100 Y0.000 Z-0.107
+X24.200 Y0.000 Z-0.126
+X24.300 Y0.000 Z-0.145
+X24.400 Y0.000 Z-0.164
+X24.500 Y0.000 Z-0.183
+X24.600 Y0.000 Z-0.202
+X24.700 Y0.000 Z-0.220
+X24.800 Y0.000 Z-0.238
+X24.900 Y0.000 Z-0.255
+X25.000 Y0.000 Z-0.272
+X25.100 Y0.000 Z-0.289
+X25.200 Y0.000 Z-0.305
+X25.300 Y0.000 Z-0.320
+X25.400 Y0.000 Z-0.335
+X25.500 Y0.000 Z-0.350
+X25.600 Y0.000 Z-0.364
+X25.700 Y0.000 Z-0.377
+X25.800 Y0.000 Z-0.390
+X25.900 Y0.000 Z-0.402
+X26.000 Y0.000 Z-0.414
+X26.100 Y0.000 Z-0.425
+X26.200 Y0.000 Z-0.435
+X26.300 Y0.000 Z-0.445
+X26.400 Y0.000 Z-0.453
+X26.500 Y0.000 Z-0.461
+X26.600 Y0.000 Z-0.469
+X26.700 Y0.000 Z-0.475
+X26.800 Y0.000 Z-0.481
+X26.900 Y0.000 Z-0.486
+X27.000 Y0.000 Z-0.490
+X27.100 Y0.000 Z-0.494
+X27.200 Y0.000 Z-0.497
+X27.300 Y0.000 Z-0.499
+X27.400 Y0.000 Z-0.500
+X27.500 Y0.000 Z-0.500
+X27.600 Y0.000 Z-0.500
+X27.700 Y0.000 Z-0.498
+X27.800 Y0.000 Z-0.496
+X27.900 Y0.000 Z-0.493
+X28.000 Y0.000 Z-0.490
+X28.100 Y0.000 Z-0.485
+X28.200 Y0.000 Z-0.480
+X28.300 Y0.000 Z-0.474
+X28.400 Y0.000 Z-0.467
+X28.500 Y0.000 Z-0.460
+X28.600 Y0.000 Z-0.451
+X28.700 Y0.000 Z-0.442
+X28.800 Y0.000 Z-0.433
+X28.900 Y0.000 Z-0.422
+X29.000 Y0.000 Z-0.411
+X29.100 Y0.000 Z-0.400
+X29.200 Y0.000 Z-0.387
+X29.300 Y0.000 Z-0.374
+X29.400 Y0.000 Z-0.361
+X29.500 Y0.000 Z-0.347
+X29.600 Y0.000 Z-0.332
+X29.700 Y0.000 Z-0.317
+X29.800 Y0.000 Z-0.301
+X29.900 Y0.000 Z-0.285
+X30.000 Y0.000 Z-0.268
+X30.000 Y0.800 Z-0.261
+X29.900 Y0.800 Z-0.277
+X29.800 Y0.800 Z-0.293
+X29.700 Y0.800 Z-0.308
+X29.600 Y0.800 Z-0.323
+X29.500 Y0.800 Z-0.337
+X29.400 Y0.800 Z-0.351
+X29.300 Y0.800 Z-0.364
+X29.200 Y0.800 Z-0.376
+X29.100 Y0.800 Z-0.388
+X29.000 Y0.800 Z-0.400
+X28.900 Y0.800 Z-0.410
+X28.800 Y0.800 Z-0.420
+X28.700 Y0.800 Z-0.430
+X28.600 Y0.800 Z-0.438
+X28.500 Y0.800 Z-0.446
+X28.400 Y0.800 Z-0.454
+X28.300 Y0.800 Z-0.460
+X28.200 Y0.800 Z-0.466
+X28.100 Y0.800 Z-0.471
+X28.000 Y0.800 Z-0.476
+X27.900 Y0.800 Z-0.479
+X27.800 Y0.800 Z-0.482
+X27.700 Y0.800 Z-0.484
+X27.600 Y0.800 Z-0.485
+X27.500 Y0.800 Z-0.486
+X27.400 Y0.800 Z-0.485
+X27.300 Y0.800 Z-0.484
+X27.200 Y0.800 Z-0.482
+X27.100 Y0.800 Z-0.480
+X27.000 Y0.800 Z-0.476
+X26.900 Y0.800 Z-0.472
+X26.800 Y0.800 Z-0.467
+X26.700 Y0.800 Z-0.462
+X26.600 Y0.800 Z-0.455
+X26.500 Y0.800 Z-0.448
+X26.400 Y0.800 Z-0.440
+X26.300 Y0.800 Z-0.432
+X26.200 Y0.800 Z-0.423
+X26.100 Y0.800 Z-0.413
+X26.000 Y0.800 Z-0.402
+X25.900 Y0.800 Z-0.391
+X25.800 Y0.800 Z-0.379
+X25.700 Y0.800 Z-0.367
+X25.600 Y0.800 Z-0.354
+X25.500 Y0.800 Z-0.340
+X25.400 Y0.800 Z-0.326
+X25.300 Y0.800 Z-0.311
+X25.200 Y0.800 Z-0.296
+X25.100 Y0.800 Z-0.280
+X25.000 Y0.800 Z-0.264
+X24.900 Y0.800 Z-0.248
+X24.800 Y0.800 Z-0.231
+X24.700 Y0.800 Z-0.214
+X24.600 Y0.800 Z-0.196
+X24.500 Y0.800 Z-0.178
+X24.400 Y0.800 Z-0.160
+X24.300 Y0.800 Z-0.141
+X24.200 Y0.800 Z-0.123
+X24.100 Y0.800 Z-0.104
+X24.000 Y0.800 Z-0.085
+X23.900 Y0.800 Z-0.065
+X23.800 Y0.800 Z-0.046
+X23.700 Y0.800 Z-0.027
+X23.600 Y0.800 Z-0.007
+X23.500 Y0.800 Z0.012
+X23.400 Y0.800 Z0.031
+X23.300 Y0.800 Z0.051
+X23.200 Y0.800 Z0.070
+X23.100 Y0.800 Z0.089
+X23.000 Y0.800 Z0.108
+X22.900 Y0.800 Z0.127
+X22.800 Y0.800 Z0.146
+X22.700 Y0.800 Z0.164
+X22.600 Y0.800 Z0.182
+X22.500 Y0.800 Z0.200
+X22.400 Y0.800 Z0.218
+X22.300 Y0.800 Z0.235
+X22.200 Y0.800 Z0.252
+X22.100 Y0.800 Z0.268
+X22.000 Y0.800 Z0.284
+X21.900 Y0.800 Z0.300
+X21.800 Y0.800 Z0.315
+X21.700 Y0.800 Z0.329
+X21.600 Y0.800 Z0.343
+X21.500 Y0.800 Z0.357
+X21.400 Y0.800 Z0.370
+X21.300 Y0.800 Z0.382
+X21.200 Y0.800 Z0.394
+X21.100 Y0.800 Z0.405
+X21.000 Y0.800 Z0.415
+X20.900 Y0.800 Z0.425
+X20.800 Y0.800 Z0.434
+X20.700 Y0.800 Z0.442
+X20.600 Y0.800 Z0.450
+X20.500 Y0.800 Z0.457
+X20.400 Y0.800 Z0.463
+X20.300 Y0.800 Z0.469
+X20.200 Y0.800 Z0.473
+X20.100 Y0.800 Z0.477
+X20.000 Y0.800 Z0.481
+X19.900 Y0.800 Z0.483
+X19.800 Y0.800 Z0.485
+X19.700 Y0.800 Z0.486
+X19.600 Y0.800 Z0.486
+X19.500 Y0.800 Z0.485
+X19.400 Y0.800 Z0.484
+X19.300 Y0.800 Z0.481
+X19.200 Y0.800 Z0.478
+X19.100 Y0.800 Z0.475
+X19.000 Y0.800 Z0.470
+X18.900 Y0.800 Z0.465
+X18.800 Y0.800 Z0.459
+X18.700 Y0.800 Z0.452
+X18.600 Y0.800 Z0.445
+X18.500 Y0.800 Z0.436
+X18.400 Y0.800 Z0.428
+X18.300 Y0.800 Z0.418
+X18.200 Y0.800 Z0.408
+X18.100 Y0.800 Z0.397
+X18.000 Y0.800 Z0.385
+X17.900 Y0.800 Z0.373
+X17.800 Y0.800 Z0.361
+X17.700 Y0.800 Z0.347
+X17.600 Y0.800 Z0.333
+X17.500 Y0.800 Z0.319
+X17.400 Y0.800 Z0.304
+X17.300 Y0.800 Z0.289
+X17.200 Y0.800 Z0.273
+X17.100 Y0.800 Z0.257
+X17.000 Y0.800 Z0.240
+X16.900 Y0.800 Z0.223
+X16.800 Y0.800 Z0.205
+X16.700 Y0.800 Z0.188
+X16.600 Y0.800 Z0.170
+X16.500 Y0.800 Z0.151
+X16.400 Y0.800 Z0.133
+X16.300 Y0.800 Z0.114
+X16.200 Y0.800 Z0.095
+X16.100 Y0.800 Z0.076
+X16.000 Y0.800 Z0.057
+X15.900 Y0.800 Z0.037
+X15.800 Y0.800 Z0.018
+X15.700 Y0.800 Z-0.002
+X15.600 Y0.800 Z-0.021
+X15.500 Y0.800 Z-0.040
+X15.400 Y0.800 Z-0.060
+X15.300 Y0.800 Z-0.079
+X15.200 Y0.800 Z-0.098
+X15.100 Y0.800 Z-0.117
+X15.000 Y0.800 Z-0.136
+X14.900 Y0.800 Z-0.154
+X14.800 Y0.800 Z-0.173
+X14.700 Y0.800 Z-0.191
+X14.600 Y0.800 Z-0.208
+X14.500 Y0.800 Z-0.226
+X14.400 Y0.800 Z-0.243
+X14.300 Y0.800 Z-0.259
+X14.200 Y0.800 Z-0.276
+X14.100 Y0.800 Z-0.291
+X14.000 Y0.800 Z-0.307
+X13.900 Y0.800 Z-0.321
+X13.800 Y0.800 Z-0.336
+X13.700 Y0.800 Z-0.349
+X13.600 Y0.800 Z-0.363
+X13.500 Y0.800 Z-0.375
+X13.400 Y0.800 Z-0.387
+X13.300 Y0.800 Z-0.399
+X13.200 Y0.800 Z-0.410
+X13.100 Y0.800 Z-0.420
+X13.000 Y0.800 Z-0.429
+X12.900 Y0.800 Z-0.438
+X12.800 Y0.800 Z-0.446
+X12.700 Y0.800 Z-0.453
+X12.600 Y0.800 Z-0.460
+X12.500 Y0.800 Z-0.466
+X12.400 Y0.800 Z-0.471
+X12.300 Y0.800 Z-0.475
+X12.200 Y0.800 Z-0.479
+X12.100 Y0.800 Z-0.482
+X12.000 Y0.800 Z-0.484
+X11.900 Y0.800 Z-0.485
+X11.800 Y0.800 Z-0.486
+X11.700 Y0.800 Z-0.485
+X11.600 Y0.800 Z-0.484
+X11.500 Y0.800 Z-0.483
+X11.400 Y0.800 Z-0.480
+X11.300 Y0.800 Z-0.477
+X11.200 Y0.800 Z-0.473
+X11.100 Y0.800 Z-0.468
+X11.000 Y0.800 Z-0.462
+X10.900 Y0.800 Z-0.456
+X10.800 Y0.800 Z-0.449
+X10.700 Y0.800 Z-0.441
+X10.600 Y0.800 Z-0.432
+X10.500 Y0.800 Z-0.423
+X10.400 Y0.800 Z-0.413
+X10.300 Y0.800 Z-0.403
+X10.200 Y0.800 Z-0.392
+X10.100 Y0.800 Z-0.380
+X10.000 Y0.800 Z-0.368
+X9.900 Y0.800 Z-0.355
+X9.800 Y0.800 Z-0.341
+X9.700 Y0.800 Z-0.327
+X9.600 Y0.800 Z-0.312
+X9.500 Y0.800 Z-0.297
+X9.400 Y0.800 Z-0.282
+X9.300 Y0.800 Z-0.266
+X9.200 Y0.800 Z-0.249
+X9.100 Y0.800 Z-0.232
+X9.000 Y0.800 Z-0.215
+X8.900 Y0.800 Z-0.197
+X8.800 Y0.800 Z-0.179
+X8.700 Y0.800 Z-0.161
+X8.600 Y0.800 Z-0.143
+X8.500 Y0.800 Z-0.124
+X8.400 Y0.800 Z-0.105
+X8.300 Y0.800 Z-0.086
+X8.200 Y0.800 Z-0.067
+X8.100 Y0.800 Z-0.048
+X8.000 Y0.800 Z-0.028
+X7.900 Y0.800 Z-0.009
+X7.800 Y0.800 Z0.010
+X7.700 Y0.800 Z0.030
+X7.600 Y0.800 Z0.049
+X7.500 Y0.800 Z0.069
+X7.400 Y0.800 Z0.088
+X7.300 Y0.800 Z0.107
+X7.200 Y0.800 Z0.126
+X7.100 Y0.800 Z0.144
+X7.000 Y0.800 Z0.163
+X6.900 Y0.800 Z0.181
+X6.800 Y0.800 Z0.199
+X6.700 Y0.800 Z0.216
+X6.600 Y0.800 Z0.234
+X6.500 Y0.800 Z0.250
+X6.400 Y0.800 Z0.267
+X6.300 Y0.800 Z0.283
+X6.200 Y0.800 Z0.298
+X6.100 Y0.800 Z0.313
+X6.000 Y0.800 Z0.328
+X5.900 Y0.800 Z0.342
+X5.800 Y0.800 Z0.356
+X5.700 Y0.800 Z0.369
+X5.600 Y0.800 Z0.381
+X5.500 Y0.800 Z0.393
+X5.400 Y0.800 Z0.404
+X5.300 Y0.800 Z0.414
+X5.200 Y0.800 Z0.424
+X5.100 Y0.800 Z0.433
+X5.000 Y0.800 Z0.442
+X4.900 Y0.800 Z0.449
+X4.800 Y0.800 Z0.456
+X4.700 Y0.800 Z0.463
+X4.600 Y0.800 Z0.468
+X4.500 Y0.800 Z0.473
+X4.400 Y0.800 Z0.477
+X4.300 Y0.800 Z0.480
+X4.200 Y0.800 Z0.483
+X4.100 Y0.800 Z0.485
+X4.000 Y0.800 Z0.485
+X3.900 Y0.800 Z0.486
+X3.800 Y0.800 Z0.485
+X3.700 Y0.800 Z0.484
+X3.600 Y0.800 Z0.482
+X3.500 Y0.800 Z0.479
+X3.400 Y0.800 Z0.475
+X3.300 Y0.800 Z0.470
+X3.200 Y0.800 Z0.465
+X3.100 Y0.800 Z0.459
+X3.000 Y0.800 Z0.453
+X2.900 Y0.800 Z0.445
+X2.800 Y0.800 Z0.437
+X2.700 Y0.800 Z0.428
+X2.600 Y0.800 Z0.419
+X2.500 Y0.800 Z0.409
+X2.400 Y0.800 Z0.398
+X2.300 Y0.800 Z0.386
+X2.200 Y0.800 Z0.374
+X2.100 Y0.800 Z0.362
+X2.000 Y0.800 Z0.348
+X1.900 Y0.800 Z0.335
+X1.800 Y0.800 Z0.320
+X1.700 Y0.800 Z0.305
+X1.600 Y0.800 Z0.290
+X1.500 Y0.800 Z0.274
+X1.400 Y0.800 Z0.258
+X1.300 Y0.800 Z0.241
+X1.200 Y0.800 Z0.224
+X1.100 Y0.800 Z0.207
+X1.000 Y0.800 Z0.189
+X0.900 Y0.800 Z0.171
+X0.800 Y0.800 Z0.153
+X0.700 Y0.800 Z0.134
+X0.600 Y0.800 Z0.115
+X0.500 Y0.800 Z0.096
+X0.400 Y0.800 Z0.077
+X0.300 Y0.800 Z0.058
+X0.200 Y0.800 Z0.039
+X0.100 Y0.800 Z0.019
+X0.000 Y0.800 Z0.000
+X0.000 Y1.600 Z0.000
+X0.100 Y1.600 Z0.018
+X0.200 Y1.600 Z0.035
+X0.300 Y1.600 Z0.053
+X0.400 Y1.600 Z0.071
+X0.500 Y1.600 Z0.088
+X0.600 Y1.600 Z0.105
+X0.700 Y1.600 Z0.123
+X0.800 Y1.600 Z0.140
+X0.900 Y1.600 Z0.156
+X1.000 Y1.600 Z0.173
+X1.100 Y1.600 Z0.189
+X1.200 Y1.600 Z0.205
+X1.300 Y1.600 Z0.220
+X1.400 Y1.600 Z0.236
+X1.500 Y1.600 Z0.250
+X1.600 Y1.600 Z0.265
+X1.700 Y1.600 Z0.279
+X1.800 Y1.600 Z0.292
+X1.900 Y1.600 Z0.306
+X2.000 Y1.600 Z0.318
+X2.100 Y1.600 Z0.330
+X2.200 Y1.600 Z0.342
+X2.300 Y1.600 Z0.353
+X2.400 Y1.600 Z0.363
+X2.500 Y1.600 Z0.373
+X2.600 Y1.600 Z0.382
+X2.700 Y1.600 Z0.391
+X2.800 Y1.600 Z0.399
+X2.900 Y1.600 Z0.407
+X3.000 Y1.600 Z0.413
+X3.100 Y1.600 Z0.419
+X3.200 Y1.600 Z0.425
+X3.300 Y1.600 Z0.430
+X3.400 Y1.600 Z0.434
+X3.500 Y1.600 Z0.437
+X3.600 Y1.600 Z0.440
+X3.700 Y1.600 Z0.442
+X3.800 Y1.600 Z0.443
+X3.900 Y1.600 Z0.443
+X4.000 Y1.600 Z0.443
+X4.100 Y1.600 Z0.442
+X4.200 Y1.600 Z0.441
+X4.300 Y1.600 Z0.439
+X4.400 Y1.600 Z0.436
+X4.500 Y1.600 Z0.432
+X4.600 Y1.600 Z0.428
+X4.700 Y1.600 Z0.422
+X4.800 Y1.600 Z0.417
+X4.900 Y1.600 Z0.410
+X5.000 Y1.600 Z0.403
+X5.100 Y1.600 Z0.396
+X5.200 Y1.600 Z0.387
+X5.300 Y1.600 Z0.378
+X5.400 Y1.600 Z0.369
+X5.500 Y1.600 Z0.359
+X5.600 Y1.600 Z0.348
+X5.700 Y1.600 Z0.337
+X5.800 Y1.600 Z0.325
+X5.900 Y1.600 Z0.312
+X6.000 Y1.600 Z0.300
+X6.100 Y1.600 Z0.286
+X6.200 Y1.600 Z0.272
+X6.300 Y1.600 Z0.258
+X6.400 Y1.600 Z0.244
+X6.500 Y1.600 Z0.229
+X6.600 Y1.600 Z0.213
+X6.700 Y1.600 Z0.198
+X6.800 Y1.600 Z0.181
+X6.900 Y1.600 Z0.165
+X7.000 Y1.600 Z0.149
+X7.100 Y1.600 Z0.132
+X7.200 Y1.600 Z0.115
+X7.300 Y1.600 Z0.097
+X7.400 Y1.600 Z0.080
+X7.500 Y1.600 Z0.063
+X7.600 Y1.600 Z0.045
+X7.700 Y1.600 Z0.027
+X7.800 Y1.600 Z0.010
+X7.900 Y1.600 Z-0.008
+X8.000 Y1.600 Z-0.026
+X8.100 Y1.600 Z-0.044
+X8.200 Y1.600 Z-0.061
+X8.300 Y1.600 Z-0.079
+X8.400 Y1.600 Z-0.096
+X8.500 Y1.600 Z-0.113
+X8.600 Y1.600 Z-0.130
+X8.700 Y1.600 Z-0.147
+X8.800 Y1.600 Z-0.164
+X8.900 Y1.600 Z-0.180
+X9.000 Y1.600 Z-0.196
+X9.100 Y1.600 Z-0.212
+X9.200 Y1.600 Z-0.227
+X9.300 Y1.600 Z-0.242
+X9.400 Y1.600 Z-0.257
+X9.500 Y1.600 Z-0.271
+X9.600 Y1.600 Z-0.285
+X9.700 Y1.600 Z-0.299
+X9.800 Y1.600 Z-0.311
+X9.900 Y1.600 Z-0.324
+X10.000 Y1.600 Z-0.336
+X10.100 Y1.600 Z-0.347
+X10.200 Y1.600 Z-0.358
+X10.300 Y1.600 Z-0.368
+X10.400 Y1.600 Z-0.378
+X10.500 Y1.600 Z-0.387
+X10.600 Y1.600 Z-0.395
+X10.700 Y1.600 Z-0.403
+X10.800 Y1.600 Z-0.410
+X10.900 Y1.600 Z-0.416
+X11.000 Y1.600 Z-0.422
+X11.100 Y1.600 Z-0.427
+X11.200 Y1.600 Z-0.432
+X11.300 Y1.600 Z-0.435
+X11.400 Y1.600 Z-0.438
+X11.500 Y1.600 Z-0.441
+X11.600 Y1.600 Z-0.442
+X11.700 Y1.600 Z-0.443
+X11.800 Y1.600 Z-0.443
+X11.900 Y1.600 Z-0.443
+X12.000 Y1.600 Z-0.442
+X12.100 Y1.600 Z-0.440
+X12.200 Y1.600 Z-0.437
+X12.300 Y1.600 Z-0.434
+X12.400 Y1.600 Z-0.430
+X12.500 Y1.600 Z-0.425
+X12.600 Y1.600 Z-0.420
+X12.700 Y1.600 Z-0.414
+X12.800 Y1.600 Z-0.407
+X12.900 Y1.600 Z-0.400
+X13.000 Y1.600 Z-0.392
+X13.100 Y1.600 Z-0.383
+X13.200 Y1.600 Z-0.374
+X13.300 Y1.600 Z-0.364
+X13.400 Y1.600 Z-0.354
+X13.500 Y1.600 Z-0.343
+X13.600 Y1.600 Z-0.331
+X13.700 Y1.600 Z-0.319
+X13.800 Y1.600 Z-0.307
+X13.900 Y1.600 Z-0.293
+X14.000 Y1.600 Z-0.280
+X14.100 Y1.600 Z-0.266
+X14.200 Y1.600 Z-0.252
+X14.300 Y1.600 Z-0.237
+X14.400 Y1.600 Z-0.222
+X14.500 Y1.600 Z-0.206
+X14.600 Y1.600 Z-0.190
+X14.700 Y1.600 Z-0.174
+X14.800 Y1.600 Z-0.158
+X14.900 Y1.600 Z-0.141
+X15.000 Y1.600 Z-0.124
+X15.100 Y1.600 Z-0.107
+X15.200 Y1.600 Z-0.089
+X15.300 Y1.600 Z-0.072
+X15.400 Y1.600 Z-0.054
+X15.500 Y1.600 Z-0.037
+X15.600 Y1.600 Z-0.019
+X15.700 Y1.600 Z-0.001
+X15.800 Y1.600 Z0.016
+X15.900 Y1.600 Z0.034
+X16.000 Y1.600 Z0.052
+X16.100 Y1.600 Z0.069
+X16.200 Y1.600 Z0.087
+X16.300 Y1.600 Z0.104
+X16.400 Y1.600 Z0.121
+X16.500 Y1.600 Z0.138
+X16.600 Y1.600 Z0.155
+X16.700 Y1.600 Z0.171
+X16.800 Y1.600 Z0.188
+X16.900 Y1.600 Z0.204
+X17.000 Y1.600 Z0.219
+X17.100 Y1.600 Z0.234
+X17.200 Y1.600 Z0.249
+X17.300 Y1.600 Z0.264
+X17.400 Y1.600 Z0.278
+X17.500 Y1.600 Z0.291
+X17.600 Y1.600 Z0.305
+X17.700 Y1.600 Z0.317
+X17.800 Y1.600 Z0.329
+X17.900 Y1.600 Z0.341
+X18.000 Y1.600 Z0.352
+X18.100 Y1.600 Z0.362
+X18.200 Y1.600 Z0.372
+X18.300 Y1.600 Z0.382
+X18.400 Y1.600 Z0.390
+X18.500 Y1.600 Z0.399
+X18.600 Y1.600 Z0.406
+X18.700 Y1.600 Z0.413
+X18.800 Y1.600 Z0.419
+X18.900 Y1.600 Z0.424
+X19.000 Y1.600 Z0.429
+X19.100 Y1.600 Z0.433
+X19.200 Y1.600 Z0.437
+X19.300 Y1.600 Z0.440
+X19.400 Y1.600 Z0.442
+X19.500 Y1.600 Z0.443
+X19.600 Y1.600 Z0.443
+X19.700 Y1.600 Z0.443
+X19.800 Y1.600 Z0.443
+X19.900 Y1.600 Z0.441
+X20.000 Y1.600 Z0.439
+X20.100 Y1.600 Z0.436
+X20.200 Y1.600 Z0.432
+X20.300 Y1.600 Z0.428
+X20.400 Y1.600 Z0.423
+X20.500 Y1.600 Z0.417
+X20.600 Y1.600 Z0.411
+X20.700 Y1.600 Z0.404
+X20.800 Y1.600 Z0.396
+X20.900 Y1.600 Z0.388
+X21.000 Y1.600 Z0.379
+X21.100 Y1.600 Z0.369
+X21.200 Y1.600 Z0.359
+X21.300 Y1.600 Z0.349
+X21.400 Y1.600 Z0.337
+X21.500 Y1.600 Z0.326
+X21.600 Y1.600 Z0.313
+X21.700 Y1.600 Z0.301
+X21.800 Y1.600 Z0.287
+X21.900 Y1.600 Z0.274
+X22.000 Y1.600 Z0.259
+X22.100 Y1.600 Z0.245
+X22.200 Y1.600 Z0.230
+X22.300 Y1.600 Z0.214
+X22.400 Y1.600 Z0.199
+X22.500 Y1.600 Z0.183
+X22.600 Y1.600 Z0.166
+X22.700 Y1.600 Z0.150
+X22.800 Y1.600 Z0.133
+X22.900 Y1.600 Z0.116
+X23.000 Y1.600 Z0.099
+X23.100 Y1.600 Z0.081
+X23.200 Y1.600 Z0.064
+X23.300 Y1.600 Z0.046
+X23.400 Y1.600 Z0.029
+X23.500 Y1.600 Z0.011
+X23.600 Y1.600 Z-0.007
+X23.700 Y1.600 Z-0.024
+X23.800 Y1.600 Z-0.042
+X23.900 Y1.600 Z-0.060
+X24.000 Y1.600 Z-0.077
+X24.100 Y1.600 Z-0.095
+X24.200 Y1.600 Z-0.112
+X24.300 Y1.600 Z-0.129
+X24.400 Y1.600 Z-0.146
+X24.500 Y1.600 Z-0.163
+X24.600 Y1.600 Z-0.179
+X24.700 Y1.600 Z-0.195
+X24.800 Y1.600 Z-0.211
+X24.900 Y1.600 Z-0.226
+X25.000 Y1.600 Z-0.241
+X25.100 Y1.600 Z-0.256
+X25.200 Y1.600 Z-0.270
+X25.300 Y1.600 Z-0.284
+X25.400 Y1.600 Z-0.297
+X25.500 Y1.600 Z-0.310
+X25.600 Y1.600 Z-0.323
+X25.700 Y1.600 Z-0.335
+X25.800 Y1.600 Z-0.346
+X25.900 Y1.600 Z-0.357
+X26.000 Y1.600 Z-0.367
+X26.100 Y1.600 Z-0.377
+X26.200 Y1.600 Z-0.386
+X26.300 Y1.600 Z-0.394
+X26.400 Y1.600 Z-0.402
+X26.500 Y1.600 Z-0.409
+X26.600 Y1.600 Z-0.416
+X26.700 Y1.600 Z-0.422
+X26.800 Y1.600 Z-0.427
+X26.900 Y1.600 Z-0.431
+X27.000 Y1.600 Z-0.435
+X27.100 Y1.600 Z-0.438
+X27.200 Y1.600 Z-0.441
+X27.300 Y1.600 Z-0.442
+X27.400 Y1.600 Z-0.443
+X27.500 Y1.600 Z-0.443
+X27.600 Y1.600 Z-0.443
+X27.700 Y1.600 Z-0.442
+X27.800 Y1.600 Z-0.440
+X27.900 Y1.600 Z-0.438
+X28.000 Y1.600 Z-0.434
+X28.100 Y1.600 Z-0.430
+X28.200 Y1.600 Z-0.426
+X28.300 Y1.600 Z-0.420
+X28.400 Y1.600 Z-0.414
+X28.500 Y1.600 Z-0.408
+X28.600 Y1.600 Z-0.400
+X28.700 Y1.600 Z-0.392
+X28.800 Y1.600 Z-0.384
+X28.900 Y1.600 Z-0.375
+X29.000 Y1.600 Z-0.365
+X29.100 Y1.600 Z-0.355
+X29.200 Y1.600 Z-0.344
+X29.300 Y1.600 Z-0.332
+X29.400 Y1.600 Z-0.320
+X29.500 Y1.600 Z-0.308
+X29.600 Y1.600 Z-0.295
+X29.700 Y1.600 Z-0.281
+X29.800 Y1.600 Z-0.267
+X29.900 Y1.600 Z-0.253
+X30.000 Y1.600 Z-0.238
+X30.000 Y2.400 Z-0.202
+X29.900 Y2.400 Z-0.214
+X29.800 Y2.400 Z-0.226
+X29.700 Y2.400 Z-0.238
+X29.600 Y2.400 Z-0.250
+X29.500 Y2.400 Z-0.261
+X29.400 Y2.400 Z-0.271
+X29.300 Y2.400 Z-0.282
+X29.200 Y2.400 Z-0.291
+X29.100 Y2.400 Z-0.301
+X29.000 Y2.400 Z-0.309
+X28.900 Y2.400 Z-0.318
+X28.800 Y2.400 Z-0.325
+X28.700 Y2.400 Z-0.333
+X28.600 Y2.400 Z-0.339
+X28.500 Y2.400 Z-0.346
+X28.400 Y2.400 Z-0.351
+X28.300 Y2.400 Z-0.356
+X28.200 Y2.400 Z-0.361
+X28.100 Y2.400 Z-0.365
+X28.000 Y2.400 Z-0.368
+X27.900 Y2.400 Z-0.371
+X27.800 Y2.400 Z-0.373
+X27.700 Y2.400 Z-0.375
+X27.600 Y2.400 Z-0.376
+X27.500 Y2.400 Z-0.376
+X27.400 Y2.400 Z-0.376
+X27.300 Y2.400 Z-0.375
+X27.200 Y2.400 Z-0.373
+X27.100 Y2.400 Z-0.371
+X27.000 Y2.400 Z-0.369
+X26.900 Y2.400 Z-0.366
+X26.800 Y2.400 Z-0.362
+X26.700 Y2.400 Z-0.357
+X26.600 Y2.400 Z-0.352
+X26.500 Y2.400 Z-0.347
+X26.400 Y2.400 Z-0.341
+X26.300 Y2.400 Z-0.334
+X26.200 Y2.400 Z-0.327
+X26.100 Y2.400 Z-0.319
+X26.000 Y2.400 Z-0.311
+X25.900 Y2.400 Z-0.303
+X25.800 Y2.400 Z-0.293
+X25.700 Y2.400 Z-0.284
+X25.600 Y2.400 Z-0.274
+X25.500 Y2.400 Z-0.263
+X25.400 Y2.400 Z-0.252
+X25.300 Y2.400 Z-0.241
+X25.200 Y2.400 Z-0.229
+X25.100 Y2.400 Z-0.217
+X25.000 Y2.400 Z-0.204
+X24.900 Y2.400 Z-0.192
+X24.800 Y2.400 Z-0.179
+X24.700 Y2.400 Z-0.165
+X24.600 Y2.400 Z-0.152
+X24.500 Y2.400 Z-0.138
+X24.400 Y2.400 Z-0.124
+X24.300 Y2.400 Z-0.109
+X24.200 Y2.400 Z-0.095
+X24.100 Y2.400 Z-0.080
+X24.000 Y2.400 Z-0.066
+X23.900 Y2.400 Z-0.051
+X23.800 Y2.400 Z-0.036
+X23.700 Y2.400 Z-0.021
+X23.600 Y2.400 Z-0.006
+X23.500 Y2.400 Z0.009
+X23.400 Y2.400 Z0.024
+X23.300 Y2.400 Z0.039
+X23.200 Y2.400 Z0.054
+X23.100 Y2.400 Z0.069
+X23.000 Y2.400 Z0.084
+X22.900 Y2.400 Z0.098
+X22.800 Y2.400 Z0.113
+X22.700 Y2.400 Z0.127
+X22.600 Y2.400 Z0.141
+X22.500 Y2.400 Z0.155
+X22.400 Y2.400 Z0.168
+X22.300 Y2.400 Z0.182
+X22.200 Y2.400 Z0.195
+X22.100 Y2.400 Z0.208
+X22.000 Y2.400 Z0.220
+X21.900 Y2.400 Z0.232
+X21.800 Y2.400 Z0.244
+X21.700 Y2.400 Z0.255
+X21.600 Y2.400 Z0.266
+X21.500 Y2.400 Z0.276
+X21.400 Y2.400 Z0.286
+X21.300 Y2.400 Z0.296
+X21.200 Y2.400 Z0.305
+X21.100 Y2.400 Z0.313
+X21.000 Y2.400 Z0.321
+X20.900 Y2.400 Z0.329
+X20.800 Y2.400 Z0.336
+X20.700 Y2.400 Z0.342
+X20.600 Y2.400 Z0.348
+X20.500 Y2.400 Z0.354
+X20.400 Y2.400 Z0.358
+X20.300 Y2.400 Z0.363
+X20.200 Y2.400 Z0.366
+X20.100 Y2.400 Z0.369
+X20.000 Y2.400 Z0.372
+X19.900 Y2.400 Z0.374
+X19.800 Y2.400 Z0.375
+X19.700 Y2.400 Z0.376
+X19.600 Y2.400 Z0.376
+X19.500 Y2.400 Z0.375
+X19.400 Y2.400 Z0.374
+X19.300 Y2.400 Z0.373
+X19.200 Y2.400 Z0.370
+X19.100 Y2.400 Z0.367
+X19.000 Y2.400 Z0.364
+X18.900 Y2.400 Z0.360
+X18.800 Y2.400 Z0.355
+X18.700 Y2.400 Z0.350
+X18.600 Y2.400 Z0.344
+X18.500 Y2.400 Z0.338
+X18.400 Y2.400 Z0.331
+X18.300 Y2.400 Z0.324
+X18.200 Y2.400 Z0.316
+X18.100 Y2.400 Z0.307
+X18.000 Y2.400 Z0.298
+X17.900 Y2.400 Z0.289
+X17.800 Y2.400 Z0.279
+X17.700 Y2.400 Z0.269
+X17.600 Y2.400 Z0.258
+X17.500 Y2.400 Z0.247
+X17.400 Y2.400 Z0.235
+X17.300 Y2.400 Z0.224
+X17.200 Y2.400 Z0.211
+X17.100 Y2.400 Z0.199
+X17.000 Y2.400 Z0.186
+X16.900 Y2.400 Z0.173
+X16.800 Y2.400 Z0.159
+X16.700 Y2.400 Z0.145
+X16.600 Y2.400 Z0.131
+X16.500 Y2.400 Z0.117
+X16.400 Y2.400 Z0.103
+X16.300 Y2.400 Z0.088
+X16.200 Y2.400 Z0.074
+X16.100 Y2.400 Z0.059
+X16.000 Y2.400 Z0.044
+X15.900 Y2.400 Z0.029
+X15.800 Y2.400 Z0.014
+X15.700 Y2.400 Z-0.001
+X15.600 Y2.400 Z-0.016
+X15.500 Y2.400 Z-0.031
+X15.400 Y2.400 Z-0.046
+X15.300 Y2.400 Z-0.061
+X15.200 Y2.400 Z-0.076
+X15.100 Y2.400 Z-0.091
+X15.000 Y2.400 Z-0.105
+X14.900 Y2.400 Z-0.119
+X14.800 Y2.400 Z-0.134
+X14.700 Y2.400 Z-0.147
+X14.600 Y2.400 Z-0.161
+X14.500 Y2.400 Z-0.175
+X14.400 Y2.400 Z-0.188
+X14.300 Y2.400 Z-0.201
+X14.200 Y2.400 Z-0.213
+X14.100 Y2.400 Z-0.225
+X14.000 Y2.400 Z-0.237
+X13.900 Y2.400 Z-0.249
+X13.800 Y2.400 Z-0.260
+X13.700 Y2.400 Z-0.270
+X13.600 Y2.400 Z-0.281
+X13.500 Y2.400 Z-0.290
+X13.400 Y2.400 Z-0.300
+X13.300 Y2.400 Z-0.309
+X13.200 Y2.400 Z-0.317
+X13.100 Y2.400 Z-0.325
+X13.000 Y2.400 Z-0.332
+X12.900 Y2.400 Z-0.339
+X12.800 Y2.400 Z-0.345
+X12.700 Y2.400 Z-0.351
+X12.600 Y2.400 Z-0.356
+X12.500 Y2.400 Z-0.360
+X12.400 Y2.400 Z-0.364
+X12.300 Y2.400 Z-0.368
+X12.200 Y2.400 Z-0.371
+X12.100 Y2.400 Z-0.373
+X12.000 Y2.400 Z-0.374
+X11.900 Y2.400 Z-0.375
+X11.800 Y2.400 Z-0.376
+X11.700 Y2.400 Z-0.376
+X11.600 Y2.400 Z-0.375
+X11.500 Y2.400 Z-0.374
+X11.400 Y2.400 Z-0.372
+X11.300 Y2.400 Z-0.369
+X11.200 Y2.400 Z-0.366
+X11.100 Y2.400 Z-0.362
+X11.000 Y2.400 Z-0.358
+X10.900 Y2.400 Z-0.353
+X10.800 Y2.400 Z-0.347
+X10.700 Y2.400 Z-0.341
+X10.600 Y2.400 Z-0.335
+X10.500 Y2.400 Z-0.328
+X10.400 Y2.400 Z-0.320
+X10.300 Y2.400 Z-0.312
+X10.200 Y2.400 Z-0.303
+X10.100 Y2.400 Z-0.294
+X10.000 Y2.400 Z-0.284
+X9.900 Y2.400 Z-0.274
+X9.800 Y2.400 Z-0.264
+X9.700 Y2.400 Z-0.253
+X9.600 Y2.400 Z-0.242
+X9.500 Y2.400 Z-0.230
+X9.400 Y2.400 Z-0.218
+X9.300 Y2.400 Z-0.206
+X9.200 Y2.400 Z-0.193
+X9.100 Y2.400 Z-0.180
+X9.000 Y2.400 Z-0.166
+X8.900 Y2.400 Z-0.153
+X8.800 Y2.400 Z-0.139
+X8.700 Y2.400 Z-0.125
+X8.600 Y2.400 Z-0.111
+X8.500 Y2.400 Z-0.096
+X8.400 Y2.400 Z-0.081
+X8.300 Y2.400 Z-0.067
+X8.200 Y2.400 Z-0.052
+X8.100 Y2.400 Z-0.037
+X8.000 Y2.400 Z-0.022
+X7.900 Y2.400 Z-0.007
+X7.800 Y2.400 Z0.008
+X7.700 Y2.400 Z0.023
+X7.600 Y2.400 Z0.038
+X7.500 Y2.400 Z0.053
+X7.400 Y2.400 Z0.068
+X7.300 Y2.400 Z0.083
+X7.200 Y2.400 Z0.097
+X7.100 Y2.400 Z0.112
+X7.000 Y2.400 Z0.126
+X6.900 Y2.400 Z0.140
+X6.800 Y2.400 Z0.154
+X6.700 Y2.400 Z0.167
+X6.600 Y2.400 Z0.181
+X6.500 Y2.400 Z0.194
+X6.400 Y2.400 Z0.207
+X6.300 Y2.400 Z0.219
+X6.200 Y2.400 Z0.231
+X6.100 Y2.400 Z0.243
+X6.000 Y2.400 Z0.254
+X5.900 Y2.400 Z0.265
+X5.800 Y2.400 Z0.275
+X5.700 Y2.400 Z0.285
+X5.600 Y2.400 Z0.295
+X5.500 Y2.400 Z0.304
+X5.400 Y2.400 Z0.313
+X5.300 Y2.400 Z0.321
+X5.200 Y2.400 Z0.328
+X5.100 Y2.400 Z0.335
+X5.000 Y2.400 Z0.342
+X4.900 Y2.400 Z0.348
+X4.800 Y2.400 Z0.353
+X4.700 Y2.400 Z0.358
+X4.600 Y2.400 Z0.362
+X4.500 Y2.400 Z0.366
+X4.400 Y2.400 Z0.369
+X4.300 Y2.400 Z0.372
+X4.200 Y2.400 Z0.374
+X4.100 Y2.400 Z0.375
+X4.000 Y2.400 Z0.376
+X3.900 Y2.400 Z0.376
+X3.800 Y2.400 Z0.375
+X3.700 Y2.400 Z0.374
+X3.600 Y2.400 Z0.373
+X3.500 Y2.400 Z0.370
+X3.400 Y2.400 Z0.368
+X3.300 Y2.400 Z0.364
+X3.200 Y2.400 Z0.360
+X3.100 Y2.400 Z0.356
+X3.000 Y2.400 Z0.350
+X2.900 Y2.400 Z0.345
+X2.800 Y2.400 Z0.338
+X2.700 Y2.400 Z0.332
+X2.600 Y2.400 Z0.324
+X2.500 Y2.400 Z0.316
+X2.400 Y2.400 Z0.308
+X2.300 Y2.400 Z0.299
+X2.200 Y2.400 Z0.290
+X2.100 Y2.400 Z0.280
+X2.000 Y2.400 Z0.270
+X1.900 Y2.400 Z0.259
+X1.800 Y2.400 Z0.248
+X1.700 Y2.400 Z0.236
+X1.600 Y2.400 Z0.224
+X1.500 Y2.400 Z0.212
+X1.400 Y2.400 Z0.200
+X1.300 Y2.400 Z0.187
+X1.200 Y2.400 Z0.174
+X1.100 Y2.400 Z0.160
+X1.000 Y2.400 Z0.146
+X0.900 Y2.400 Z0.132
+X0.800 Y2.400 Z0.118
+X0.700 Y2.400 Z0.104
+X0.600 Y2.400 Z0.089
+X0.500 Y2.400 Z0.075
+X0.400 Y2.400 Z0.060
+X0.300 Y2.400 Z0.045
+X0.200 Y2.400 Z0.030
+X0.100 Y2.400 Z0.015
+X0.000 Y2.400 Z0.000
+X0.000 Y3.200 Z0.000
+X0.100 Y3.200 Z0.011
+X0.200 Y3.200 Z0.023
+X0.300 Y3.200 Z0.034
+X0.400 Y3.200 Z0.046
+X0.500 Y3.200 Z0.057
+X0.600 Y3.200 Z0.068
+X0.700 Y3.200 Z0.079
+X0.800 Y3.200 Z0.090
+X0.900 Y3.200 Z0.101
+X1.000 Y3.200 Z0.112
+X1.100 Y3.200 Z0.122
+X1.200 Y3.200 Z0.132
+X1.300 Y3.200 Z0.142
+X1.400 Y3.200 Z0.152
+X1.500 Y3.200 Z0.162
+X1.600 Y3.200 Z0.171
+X1.700 Y3.200 Z0.180
+X1.800 Y3.200 Z0.189
+X1.900 Y3.200 Z0.198
+X2.000 Y3.200 Z0.206
+X2.100 Y3.200 Z0.214
+X2.200 Y3.200 Z0.221
+X2.300 Y3.200 Z0.228
+X2.400 Y3.200 Z0.235
+X2.500 Y3.200 Z0.241
+X2.600 Y3.200 Z0.247
+X2.700 Y3.200 Z0.253
+X2.800 Y3.200 Z0.258
+X2.900 Y3.200 Z0.263
+X3.000 Y3.200 Z0.267
+X3.100 Y3.200 Z0.271
+X3.200 Y3.200 Z0.275
+X3.300 Y3.200 Z0.278
+X3.400 Y3.200 Z0.280
+X3.500 Y3.200 Z0.283
+X3.600 Y3.200 Z0.284
+X3.700 Y3.200 Z0.286
+X3.800 Y3.200 Z0.286
+X3.900 Y3.200 Z0.287
+X4.000 Y3.200 Z0.287
+X4.100 Y3.200 Z0.286
+X4.200 Y3.200 Z0.285
+X4.300 Y3.200 Z0.284
+X4.400 Y3.200 Z0.282
+X4.500 Y3.200 Z0.279
+X4.600 Y3.200 Z0.276
+X4.700 Y3.200 Z0.273
+X4.800 Y3.200 Z0.269
+X4.900 Y3.200 Z0.265
+X5.000 Y3.200 Z0.261
+X5.100 Y3.200 Z0.256
+X5.200 Y3.200 Z0.250
+X5.300 Y3.200 Z0.245
+X5.400 Y3.200 Z0.238
+X5.500 Y3.200 Z0.232
+X5.600 Y3.200 Z0.225
+X5.700 Y3.200 Z0.218
+X5.800 Y3.200 Z0.210
+X5.900 Y3.200 Z0.202
+X6.000 Y3.200 Z0.194
+X6.100 Y3.200 Z0.185
+X6.200 Y3.200 Z0.176
+X6.300 Y3.200 Z0.167
+X6.400 Y3.200 Z0.158
+X6.500 Y3.200 Z0.148
+X6.600 Y3.200 Z0.138
+X6.700 Y3.200 Z0.128
+X6.800 Y3.200 Z0.117
+X6.900 Y3.200 Z0.107
+X7.000 Y3.200 Z0.096
+X7.100 Y3.200 Z0.085
+X7.200 Y3.200 Z0.074
+X7.300 Y3.200 Z0.063
+X7.400 Y3.200 Z0.052
+X7.500 Y3.200 Z0.040
+X7.600 Y3.200 Z0.029
+X7.700 Y3.200 Z0.018
+X7.800 Y3.200 Z0.006
+X7.900 Y3.200 Z-0.005
+X8.000 Y3.200 Z-0.017
+X8.100 Y3.200 Z-0.028
+X8.200 Y3.200 Z-0.040
+X8.300 Y3.200 Z-0.051
+X8.400 Y3.200 Z-0.062
+X8.500 Y3.200 Z-0.073
+X8.600 Y3.200 Z-0.084
+X8.700 Y3.200 Z-0.095
+X8.800 Y3.200 Z-0.106
+X8.900 Y3.200 Z-0.117
+X9.000 Y3.200 Z-0.127
+X9.100 Y3.200 Z-0.137
+X9.200 Y3.200 Z-0.147
+X9.300 Y3.200 Z-0.157
+X9.400 Y3.200 Z-0.166
+X9.500 Y3.200 Z-0.175
+X9.600 Y3.200 Z-0.184
+X9.700 Y3.200 Z-0.193
+X9.800 Y3.200 Z-0.201
+X9.900 Y3.200 Z-0.209
+X10.000 Y3.200 Z-0.217
+X10.100 Y3.200 Z-0.224
+X10.200 Y3.200 Z-0.231
+X10.300 Y3.200 Z-0.238
+X10.400 Y3.200 Z-0.244
+X10.500 Y3.200 Z-0.250
+X10.600 Y3.200 Z-0.255
+X10.700 Y3.200 Z-0.260
+X10.800 Y3.200 Z-0.265
+X10.900 Y3.200 Z-0.269
+X11.000 Y3.200 Z-0.273
+X11.100 Y3.200 Z-0.276
+X11.200 Y3.200 Z-0.279
+X11.300 Y3.200 Z-0.281
+X11.400 Y3.200 Z-0.283
+X11.500 Y3.200 Z-0.285
+X11.600 Y3.200 Z-0.286
+X11.700 Y3.200 Z-0.287
+X11.800 Y3.200 Z-0.287
+X11.900 Y3.200 Z-0.286
+X12.000 Y3.200 Z-0.286
+X12.100 Y3.200 Z-0.284
+X12.200 Y3.200 Z-0.283
+X12.300 Y3.200 Z-0.281
+X12.400 Y3.200 Z-0.278
+X12.500 Y3.200 Z-0.275
+X12.600 Y3.200 Z-0.272
+X12.700 Y3.200 Z-0.268
+X12.800 Y3.200 Z-0.263
+X12.900 Y3.200 Z-0.259
+X13.000 Y3.200 Z-0.253
+X13.100 Y3.200 Z-0.248
+X13.200 Y3.200 Z-0.242
+X13.300 Y3.200 Z-0.235
+X13.400 Y3.200 Z-0.229
+X13.500 Y3.200 Z-0.222
+X13.600 Y3.200 Z-0.214
+X13.700 Y3.200 Z-0.206
+X13.800 Y3.200 Z-0.198
+X13.900 Y3.200 Z-0.190
+X14.000 Y3.200 Z-0.181
+X14.100 Y3.200 Z-0.172
+X14.200 Y3.200 Z-0.163
+X14.300 Y3.200 Z-0.153
+X14.400 Y3.200 Z-0.143
+X14.500 Y3.200 Z-0.133
+X14.600 Y3.200 Z-0.123
+X14.700 Y3.200 Z-0.113
+X14.800 Y3.200 Z-0.102
+X14.900 Y3.200 Z-0.091
+X15.000 Y3.200 Z-0.080
+X15.100 Y3.200 Z-0.069
+X15.200 Y3.200 Z-0.058
+X15.300 Y3.200 Z-0.047
+X15.400 Y3.200 Z-0.035
+X15.500 Y3.200 Z-0.024
+X15.600 Y3.200 Z-0.012
+X15.700 Y3.200 Z-0.001
+X15.800 Y3.200 Z0.011
+X15.900 Y3.200 Z0.022
+X16.000 Y3.200 Z0.033
+X16.100 Y3.200 Z0.045
+X16.200 Y3.200 Z0.056
+X16.300 Y3.200 Z0.067
+X16.400 Y3.200 Z0.078
+X16.500 Y3.200 Z0.089
+X16.600 Y3.200 Z0.100
+X16.700 Y3.200 Z0.111
+X16.800 Y3.200 Z0.121
+X16.900 Y3.200 Z0.132
+X17.000 Y3.200 Z0.142
+X17.100 Y3.200 Z0.152
+X17.200 Y3.200 Z0.161
+X17.300 Y3.200 Z0.171
+X17.400 Y3.200 Z0.180
+X17.500 Y3.200 Z0.188
+X17.600 Y3.200 Z0.197
+X17.700 Y3.200 Z0.205
+X17.800 Y3.200 Z0.213
+X17.900 Y3.200 Z0.220
+X18.000 Y3.200 Z0.228
+X18.100 Y3.200 Z0.234
+X18.200 Y3.200 Z0.241
+X18.300 Y3.200 Z0.247
+X18.400 Y3.200 Z0.252
+X18.500 Y3.200 Z0.258
+X18.600 Y3.200 Z0.263
+X18.700 Y3.200 Z0.267
+X18.800 Y3.200 Z0.271
+X18.900 Y3.200 Z0.274
+X19.000 Y3.200 Z0.278
+X19.100 Y3.200 Z0.280
+X19.200 Y3.200 Z0.282
+X19.300 Y3.200 Z0.284
+X19.400 Y3.200 Z0.285
+X19.500 Y3.200 Z0.286
+X19.600 Y3.200 Z0.287
+X19.700 Y3.200 Z0.287
+X19.800 Y3.200 Z0.286
+X19.900 Y3.200 Z0.285
+X20.000 Y3.200 Z0.284
+X20.100 Y3.200 Z0.282
+X20.200 Y3.200 Z0.279
+X20.300 Y3.200 Z0.277
+X20.400 Y3.200 Z0.273
+X20.500 Y3.200 Z0.270
+X20.600 Y3.200 Z0.266
+X20.700 Y3.200 Z0.261
+X20.800 Y3.200 Z0.256
+X20.900 Y3.200 Z0.251
+X21.000 Y3.200 Z0.245
+X21.100 Y3.200 Z0.239
+X21.200 Y3.200 Z0.232
+X21.300 Y3.200 Z0.225
+X21.400 Y3.200 Z0.218
+X21.500 Y3.200 Z0.211
+X21.600 Y3.200 Z0.203
+X21.700 Y3.200 Z0.194
+X21.800 Y3.200 Z0.186
+X21.900 Y3.200 Z0.177
+X22.000 Y3.200 Z0.168
+X22.100 Y3.200 Z0.158
+X22.200 Y3.200 Z0.149
+X22.300 Y3.200 Z0.139
+X22.400 Y3.200 Z0.129
+X22.500 Y3.200 Z0.118
+X22.600 Y3.200 Z0.108
+X22.700 Y3.200 Z0.097
+X22.800 Y3.200 Z0.086
+X22.900 Y3.200 Z0.075
+X23.000 Y3.200 Z0.064
+X23.100 Y3.200 Z0.053
+X23.200 Y3.200 Z0.041
+X23.300 Y3.200 Z0.030
+X23.400 Y3.200 Z0.019
+X23.500 Y3.200 Z0.007
+X23.600 Y3.200 Z-0.004
+X23.700 Y3.200 Z-0.016
+X23.800 Y3.200 Z-0.027
+X23.900 Y3.200 Z-0.039
+X24.000 Y3.200 Z-0.050
+X24.100 Y3.200 Z-0.061
+X24.200 Y3.200 Z-0.072
+X24.300 Y3.200 Z-0.083
+X24.400 Y3.200 Z-0.094
+X24.500 Y3.200 Z-0.105
+X24.600 Y3.200 Z-0.116
+X24.700 Y3.200 Z-0.126
+X24.800 Y3.200 Z-0.136
+X24.900 Y3.200 Z-0.146
+X25.000 Y3.200 Z-0.156
+X25.100 Y3.200 Z-0.166
+X25.200 Y3.200 Z-0.175
+X25.300 Y3.200 Z-0.184
+X25.400 Y3.200 Z-0.192
+X25.500 Y3.200 Z-0.201
+X25.600 Y3.200 Z-0.209
+X25.700 Y3.200 Z-0.216
+X25.800 Y3.200 Z-0.224
+X25.900 Y3.200 Z-0.231
+X26.000 Y3.200 Z-0.237
+X26.100 Y3.200 Z-0.244
+X26.200 Y3.200 Z-0.249
+X26.300 Y3.200 Z-0.255
+X26.400 Y3.200 Z-0.260
+X26.500 Y3.200 Z-0.265
+X26.600 Y3.200 Z-0.269
+X26.700 Y3.200 Z-0.273
+X26.800 Y3.200 Z-0.276
+X26.900 Y3.200 Z-0.279
+X27.000 Y3.200 Z-0.281
+X27.100 Y3.200 Z-0.283
+X27.200 Y3.200 Z-0.285
+X27.300 Y3.200 Z-0.286
+X27.400 Y3.200 Z-0.287
+X27.500 Y3.200 Z-0.287
+X27.600 Y3.200 Z-0.286
+X27.700 Y3.200 Z-0.286
+X27.800 Y3.200 Z-0.285
+X27.900 Y3.200 Z-0.283
+X28.000 Y3.200 Z-0.281
+X28.100 Y3.200 Z-0.278
+X28.200 Y3.200 Z-0.275
+X28.300 Y3.200 Z-0.272
+X28.400 Y3.200 Z-0.268
+X28.500 Y3.200 Z-0.264
+X28.600 Y3.200 Z-0.259
+X28.700 Y3.200 Z-0.254
+X28.800 Y3.200 Z-0.248
+X28.900 Y3.200 Z-0.242
+X29.000 Y3.200 Z-0.236
+X29.100 Y3.200 Z-0.229
+X29.200 Y3.200 Z-0.222
+X29.300 Y3.200 Z-0.215
+X29.400 Y3.200 Z-0.207
+X29.500 Y3.200 Z-0.199
+X29.600 Y3.200 Z-0.190
+X29.700 Y3.200 Z-0.182
+X29.800 Y3.200 Z-0.173
+X29.900 Y3.200 Z-0.163
+X30.000 Y3.200 Z-0.154
+X30.000 Y4.000 Z-0.097
+X29.900 Y4.000 Z-0.103
+X29.800 Y4.000 Z-0.109
+X29.700 Y4.000 Z-0.115
+X29.600 Y4.000 Z-0.120
+X29.500 Y4.000 Z-0.126
+X29.400 Y4.000 Z-0.131
+X29.300 Y4.000 Z-0.136
+X29.200 Y4.000 Z-0.140
+X29.100 Y4.000 Z-0.145
+X29.000 Y4.000 Z-0.149
+X28.900 Y4.000 Z-0.153
+X28.800 Y4.000 Z-0.157
+X28.700 Y4.000 Z-0.160
+X28.600 Y4.000 Z-0.164
+X28.500 Y4.000 Z-0.167
+X28.400 Y4.000 Z-0.169
+X28.300 Y4.000 Z-0.172
+X28.200 Y4.000 Z-0.174
+X28.100 Y4.000 Z-0.176
+X28.000 Y4.000 Z-0.177
+X27.900 Y4.000 Z-0.179
+X27.800 Y4.000 Z-0.180
+X27.700 Y4.000 Z-0.181
+X27.600 Y4.000 Z-0.181
+X27.500 Y4.000 Z-0.181
+X27.400 Y4.000 Z-0.181
+X27.300 Y4.000 Z-0.181
+X27.200 Y4.000 Z-0.180
+X27.100 Y4.000 Z-0.179
+X27.000 Y4.000 Z-0.178
+X26.900 Y4.000 Z-0.176
+X26.800 Y4.000 Z-0.174
+X26.700 Y4.000 Z-0.172
+X26.600 Y4.000 Z-0.170
+X26.500 Y4.000 Z-0.167
+X26.400 Y4.000 Z-0.164
+X26.300 Y4.000 Z-0.161
+X26.200 Y4.000 Z-0.158
+X26.100 Y4.000 Z-0.154
+X26.000 Y4.000 Z-0.150
+X25.900 Y4.000 Z-0.146
+X25.800 Y4.000 Z-0.141
+X25.700 Y4.000 Z-0.137
+X25.600 Y4.000 Z-0.132
+X25.500 Y4.000 Z-0.127
+X25.400 Y4.000 Z-0.122
+X25.300 Y4.000 Z-0.116
+X25.200 Y4.000 Z-0.110
+X25.100 Y4.000 Z-0.105
+X25.000 Y4.000 Z-0.099
+X24.900 Y4.000 Z-0.092
+X24.800 Y4.000 Z-0.086
+X24.700 Y4.000 Z-0.080
+X24.600 Y4.000 Z-0.073
+X24.500 Y4.000 Z-0.066
+X24.400 Y4.000 Z-0.060
+X24.300 Y4.000 Z-0.053
+X24.200 Y4.000 Z-0.046
+X24.100 Y4.000 Z-0.039
+X24.000 Y4.000 Z-0.032
+X23.900 Y4.000 Z-0.024
+X23.800 Y4.000 Z-0.017
+X23.700 Y4.000 Z-0.010
+X23.600 Y4.000 Z-0.003
+X23.500 Y4.000 Z0.004
+X23.400 Y4.000 Z0.012
+X23.300 Y4.000 Z0.019
+X23.200 Y4.000 Z0.026
+X23.100 Y4.000 Z0.033
+X23.000 Y4.000 Z0.040
+X22.900 Y4.000 Z0.047
+X22.800 Y4.000 Z0.054
+X22.700 Y4.000 Z0.061
+X22.600 Y4.000 Z0.068
+X22.500 Y4.000 Z0.075
+X22.400 Y4.000 Z0.081
+X22.300 Y4.000 Z0.088
+X22.200 Y4.000 Z0.094
+X22.100 Y4.000 Z0.100
+X22.000 Y4.000 Z0.106
+X21.900 Y4.000 Z0.112
+X21.800 Y4.000 Z0.117
+X21.700 Y4.000 Z0.123
+X21.600 Y4.000 Z0.128
+X21.500 Y4.000 Z0.133
+X21.400 Y4.000 Z0.138
+X21.300 Y4.000 Z0.142
+X21.200 Y4.000 Z0.147
+X21.100 Y4.000 Z0.151
+X21.000 Y4.000 Z0.155
+X20.900 Y4.000 Z0.158
+X20.800 Y4.000 Z0.162
+X20.700 Y4.000 Z0.165
+X20.600 Y4.000 Z0.168
+X20.500 Y4.000 Z0.170
+X20.400 Y4.000 Z0.173
+X20.300 Y4.000 Z0.175
+X20.200 Y4.000 Z0.177
+X20.100 Y4.000 Z0.178
+X20.000 Y4.000 Z0.179
+X19.900 Y4.000 Z0.180
+X19.800 Y4.000 Z0.181
+X19.700 Y4.000 Z0.181
+X19.600 Y4.000 Z0.181
+X19.500 Y4.000 Z0.181
+X19.400 Y4.000 Z0.180
+X19.300 Y4.000 Z0.180
+X19.200 Y4.000 Z0.178
+X19.100 Y4.000 Z0.177
+X19.000 Y4.000 Z0.175
+X18.900 Y4.000 Z0.173
+X18.800 Y4.000 Z0.171
+X18.700 Y4.000 Z0.169
+X18.600 Y4.000 Z0.166
+X18.500 Y4.000 Z0.163
+X18.400 Y4.000 Z0.160
+X18.300 Y4.000 Z0.156
+X18.200 Y4.000 Z0.152
+X18.100 Y4.000 Z0.148
+X18.000 Y4.000 Z0.144
+X17.900 Y4.000 Z0.139
+X17.800 Y4.000 Z0.135
+X17.700 Y4.000 Z0.130
+X17.600 Y4.000 Z0.124
+X17.500 Y4.000 Z0.119
+X17.400 Y4.000 Z0.113
+X17.300 Y4.000 Z0.108
+X17.200 Y4.000 Z0.102
+X17.100 Y4.000 Z0.096
+X17.000 Y4.000 Z0.090
+X16.900 Y4.000 Z0.083
+X16.800 Y4.000 Z0.077
+X16.700 Y4.000 Z0.070
+X16.600 Y4.000 Z0.063
+X16.500 Y4.000 Z0.056
+X16.400 Y4.000 Z0.050
+X16.300 Y4.000 Z0.043
+X16.200 Y4.000 Z0.035
+X16.100 Y4.000 Z0.028
+X16.000 Y4.000 Z0.021
+X15.900 Y4.000 Z0.014
+X15.800 Y4.000 Z0.007
+X15.700 Y4.000 Z-0.001
+X15.600 Y4.000 Z-0.008
+X15.500 Y4.000 Z-0.015
+X15.400 Y4.000 Z-0.022
+X15.300 Y4.000 Z-0.029
+X15.200 Y4.000 Z-0.037
+X15.100 Y4.000 Z-0.044
+X15.000 Y4.000 Z-0.051
+X14.900 Y4.000 Z-0.058
+X14.800 Y4.000 Z-0.064
+X14.700 Y4.000 Z-0.071
+X14.600 Y4.000 Z-0.078
+X14.500 Y4.000 Z-0.084
+X14.400 Y4.000 Z-0.091
+X14.300 Y4.000 Z-0.097
+X14.200 Y4.000 Z-0.103
+X14.100 Y4.000 Z-0.109
+X14.000 Y4.000 Z-0.114
+X13.900 Y4.000 Z-0.120
+X13.800 Y4.000 Z-0.125
+X13.700 Y4.000 Z-0.130
+X13.600 Y4.000 Z-0.135
+X13.500 Y4.000 Z-0.140
+X13.400 Y4.000 Z-0.144
+X13.300 Y4.000 Z-0.149
+X13.200 Y4.000 Z-0.153
+X13.100 Y4.000 Z-0.157
+X13.000 Y4.000 Z-0.160
+X12.900 Y4.000 Z-0.163
+X12.800 Y4.000 Z-0.166
+X12.700 Y4.000 Z-0.169
+X12.600 Y4.000 Z-0.172
+X12.500 Y4.000 Z-0.174
+X12.400 Y4.000 Z-0.176
+X12.300 Y4.000 Z-0.177
+X12.200 Y4.000 Z-0.179
+X12.100 Y4.000 Z-0.180
+X12.000 Y4.000 Z-0.180
+X11.900 Y4.000 Z-0.181
+X11.800 Y4.000 Z-0.181
+X11.700 Y4.000 Z-0.181
+X11.600 Y4.000 Z-0.181
+X11.500 Y4.000 Z-0.180
+X11.400 Y4.000 Z-0.179
+X11.300 Y4.000 Z-0.178
+X11.200 Y4.000 Z-0.176
+X11.100 Y4.000 Z-0.174
+X11.000 Y4.000 Z-0.172
+X10.900 Y4.000 Z-0.170
+X10.800 Y4.000 Z-0.167
+X10.700 Y4.000 Z-0.165
+X10.600 Y4.000 Z-0.161
+X10.500 Y4.000 Z-0.158
+X10.400 Y4.000 Z-0.154
+X10.300 Y4.000 Z-0.150
+X10.200 Y4.000 Z-0.146
+X10.100 Y4.000 Z-0.142
+X10.000 Y4.000 Z-0.137
+X9.900 Y4.000 Z-0.132
+X9.800 Y4.000 Z-0.127
+X9.700 Y4.000 Z-0.122
+X9.600 Y4.000 Z-0.116
+X9.500 Y4.000 Z-0.111
+X9.400 Y4.000 Z-0.105
+X9.300 Y4.000 Z-0.099
+X9.200 Y4.000 Z-0.093
+X9.100 Y4.000 Z-0.087
+X9.000 Y4.000 Z-0.080
+X8.900 Y4.000 Z-0.074
+X8.800 Y4.000 Z-0.067
+X8.700 Y4.000 Z-0.060
+X8.600 Y4.000 Z-0.053
+X8.500 Y4.000 Z-0.046
+X8.400 Y4.000 Z-0.039
+X8.300 Y4.000 Z-0.032
+X8.200 Y4.000 Z-0.025
+X8.100 Y4.000 Z-0.018
+X8.000 Y4.000 Z-0.011
+X7.900 Y4.000 Z-0.003
+X7.800 Y4.000 Z0.004
+X7.700 Y4.000 Z0.011
+X7.600 Y4.000 Z0.018
+X7.500 Y4.000 Z0.026
+X7.400 Y4.000 Z0.033
+X7.300 Y4.000 Z0.040
+X7.200 Y4.000 Z0.047
+X7.100 Y4.000 Z0.054
+X7.000 Y4.000 Z0.061
+X6.900 Y4.000 Z0.067
+X6.800 Y4.000 Z0.074
+X6.700 Y4.000 Z0.081
+X6.600 Y4.000 Z0.087
+X6.500 Y4.000 Z0.093
+X6.400 Y4.000 Z0.100
+X6.300 Y4.000 Z0.106
+X6.200 Y4.000 Z0.111
+X6.100 Y4.000 Z0.117
+X6.000 Y4.000 Z0.122
+X5.900 Y4.000 Z0.128
+X5.800 Y4.000 Z0.133
+X5.700 Y4.000 Z0.137
+X5.600 Y4.000 Z0.142
+X5.500 Y4.000 Z0.146
+X5.400 Y4.000 Z0.151
+X5.300 Y4.000 Z0.155
+X5.200 Y4.000 Z0.158
+X5.100 Y4.000 Z0.162
+X5.000 Y4.000 Z0.165
+X4.900 Y4.000 Z0.168
+X4.800 Y4.000 Z0.170
+X4.700 Y4.000 Z0.173
+X4.600 Y4.000 Z0.175
+X4.500 Y4.000 Z0.176
+X4.400 Y4.000 Z0.178
+X4.300 Y4.000 Z0.179
+X4.200 Y4.000 Z0.180
+X4.100 Y4.000 Z0.181
+X4.000 Y4.000 Z0.181
+X3.900 Y4.000 Z0.181
+X3.800 Y4.000 Z0.181
+X3.700 Y4.000 Z0.180
+X3.600 Y4.000 Z0.180
+X3.500 Y4.000 Z0.179
+X3.400 Y4.000 Z0.177
+X3.300 Y4.000 Z0.176
+X3.200 Y4.000 Z0.174
+X3.100 Y4.000 Z0.171
+X3.000 Y4.000 Z0.169
+X2.900 Y4.000 Z0.166
+X2.800 Y4.000 Z0.163
+X2.700 Y4.000 Z0.160
+X2.600 Y4.000 Z0.156
+X2.500 Y4.000 Z0.152
+X2.400 Y4.000 Z0.148
+X2.300 Y4.000 Z0.144
+X2.200 Y4.000 Z0.140
+X2.100 Y4.000 Z0.135
+X2.000 Y4.000 Z0.130
+X1.900 Y4.000 Z0.125
+X1.800 Y4.000 Z0.119
+X1.700 Y4.000 Z0.114
+X1.600 Y4.000 Z0.108
+X1.500 Y4.000 Z0.102
+X1.400 Y4.000 Z0.096
+X1.300 Y4.000 Z0.090
+X1.200 Y4.000 Z0.084
+X1.100 Y4.000 Z0.077
+X1.000 Y4.000 Z0.071
+X0.900 Y4.000 Z0.064
+X0.800 Y4.000 Z0.057
+X0.700 Y4.000 Z0.050
+X0.600 Y4.000 Z0.043
+X0.500 Y4.000 Z0.036
+X0.400 Y4.000 Z0.029
+X0.300 Y4.000 Z0.022
+X0.200 Y4.000 Z0.014
+X0.100 Y4.000 Z0.007
+X0.000 Y4.000 Z0.000
+X0.000 Y4.800 Z0.000
+X0.100 Y4.800 Z0.003
+X0.200 Y4.800 Z0.005
+X0.300 Y4.800 Z0.008
+X0.400 Y4.800 Z0.010
+X0.500 Y4.800 Z0.013
+X0.600 Y4.800 Z0.016
+X0.700 Y4.800 Z0.018
+X0.800 Y4.800 Z0.021
+X0.900 Y4.800 Z0.023
+X1.000 Y4.800 Z0.025
+X1.100 Y4.800 Z0.028
+X1.200 Y4.800 Z0.030
+X1.300 Y4.800 Z0.032
+X1.400 Y4.800 Z0.035
+X1.500 Y4.800 Z0.037
+X1.600 Y4.800 Z0.039
+X1.700 Y4.800 Z0.041
+X1.800 Y4.800 Z0.043
+X1.900 Y4.800 Z0.045
+X2.000 Y4.800 Z0.047
+X2.100 Y4.800 Z0.049
+X2.200 Y4.800 Z0.050
+X2.300 Y4.800 Z0.052
+X2.400 Y4.800 Z0.053
+X2.500 Y4.800 Z0.055
+X2.600 Y4.800 Z0.056
+X2.700 Y4.800 Z0.058
+X2.800 Y4.800 Z0.059
+X2.900 Y4.800 Z0.060
+X3.000 Y4.800 Z0.061
+X3.100 Y4.800 Z0.062
+X3.200 Y4.800 Z0.062
+X3.300 Y4.800 Z0.063
+X3.400 Y4.800 Z0.064
+X3.500 Y4.800 Z0.064
+X3.600 Y4.800 Z0.065
+X3.700 Y4.800 Z0.065
+X3.800 Y4.800 Z0.065
+X3.900 Y4.800 Z0.065
+X4.000 Y4.800 Z0.065
+X4.100 Y4.800 Z0.065
+X4.200 Y4.800 Z0.065
+X4.300 Y4.800 Z0.064
+X4.400 Y4.800 Z0.064
+X4.500 Y4.800 Z0.064
+X4.600 Y4.800 Z0.063
+X4.700 Y4.800 Z0.062
+X4.800 Y4.800 Z0.061
+X4.900 Y4.800 Z0.060
+X5.000 Y4.800 Z0.059
+X5.100 Y4.800 Z0.058
+X5.200 Y4.800 Z0.057
+X5.300 Y4.800 Z0.056
+X5.400 Y4.800 Z0.054
+X5.500 Y4.800 Z0.053
+X5.600 Y4.800 Z0.051
+X5.700 Y4.800 Z0.049
+X5.800 Y4.800 Z0.048
+X5.900 Y4.800 Z0.046
+X6.000 Y4.800 Z0.044
+X6.100 Y4.800 Z0.042
+X6.200 Y4.800 Z0.040
+X6.300 Y4.800 Z0.038
+X6.400 Y4.800 Z0.036
+X6.500 Y4.800 Z0.034
+X6.600 Y4.800 Z0.031
+X6.700 Y4.800 Z0.029
+X6.800 Y4.800 Z0.027
+X6.900 Y4.800 Z0.024
+X7.000 Y4.800 Z0.022
+X7.100 Y4.800 Z0.019
+X7.200 Y4.800 Z0.017
+X7.300 Y4.800 Z0.014
+X7.400 Y4.800 Z0.012
+X7.500 Y4.800 Z0.009
+X7.600 Y4.800 Z0.007
+X7.700 Y4.800 Z0.004
+X7.800 Y4.800 Z0.001
+X7.900 Y4.800 Z-0.001
+X8.000 Y4.800 Z-0.004
+X8.100 Y4.800 Z-0.006
+X8.200 Y4.800 Z-0.009
+X8.300 Y4.800 Z-0.012
+X8.400 Y4.800 Z-0.014
+X8.500 Y4.800 Z-0.017
+X8.600 Y4.800 Z-0.019
+X8.700 Y4.800 Z-0.022
+X8.800 Y4.800 Z-0.024
+X8.900 Y4.800 Z-0.026
+X9.000 Y4.800 Z-0.029
+X9.100 Y4.800 Z-0.031
+X9.200 Y4.800 Z-0.033
+X9.300 Y4.800 Z-0.036
+X9.400 Y4.800 Z-0.038
+X9.500 Y4.800 Z-0.040
+X9.600 Y4.800 Z-0.042
+X9.700 Y4.800 Z-0.044
+X9.800 Y4.800 Z-0.046
+X9.900 Y4.800 Z-0.048
+X10.000 Y4.800 Z-0.049
+X10.100 Y4.800 Z-0.051
+X10.200 Y4.800 Z-0.053
+X10.300 Y4.800 Z-0.054
+X10.400 Y4.800 Z-0.056
+X10.500 Y4.800 Z-0.057
+X10.600 Y4.800 Z-0.058
+X10.700 Y4.800 Z-0.059
+X10.800 Y4.800 Z-0.060
+X10.900 Y4.800 Z-0.061
+X11.000 Y4.800 Z-0.062
+X11.100 Y4.800 Z-0.063
+X11.200 Y4.800 Z-0.063
+X11.300 Y4.800 Z-0.064
+X11.400 Y4.800 Z-0.064
+X11.500 Y4.800 Z-0.065
+X11.600 Y4.800 Z-0.065
+X11.700 Y4.800 Z-0.065
+X11.800 Y4.800 Z-0.065
+X11.900 Y4.800 Z-0.065
+X12.000 Y4.800 Z-0.065
+X12.100 Y4.800 Z-0.065
+X12.200 Y4.800 Z-0.064
+X12.300 Y4.800 Z-0.064
+X12.400 Y4.800 Z-0.063
+X12.500 Y4.800 Z-0.063
+X12.600 Y4.800 Z-0.062
+X12.700 Y4.800 Z-0.061
+X12.800 Y4.800 Z-0.060
+X12.900 Y4.800 Z-0.059
+X13.000 Y4.800 Z-0.058
+X13.100 Y4.800 Z-0.056
+X13.200 Y4.800 Z-0.055
+X13.300 Y4.800 Z-0.054
+X13.400 Y4.800 Z-0.052
+X13.500 Y4.800 Z-0.050
+X13.600 Y4.800 Z-0.049
+X13.700 Y4.800 Z-0.047
+X13.800 Y4.800 Z-0.045
+X13.900 Y4.800 Z-0.043
+X14.000 Y4.800 Z-0.041
+X14.100 Y4.800 Z-0.039
+X14.200 Y4.800 Z-0.037
+X14.300 Y4.800 Z-0.035
+X14.400 Y4.800 Z-0.033
+X14.500 Y4.800 Z-0.030
+X14.600 Y4.800 Z-0.028
+X14.700 Y4.800 Z-0.026
+X14.800 Y4.800 Z-0.023
+X14.900 Y4.800 Z-0.021
+X15.000 Y4.800 Z-0.018
+X15.100 Y4.800 Z-0.016
+X15.200 Y4.800 Z-0.013
+X15.300 Y4.800 Z-0.011
+X15.400 Y4.800 Z-0.008
+X15.500 Y4.800 Z-0.005
+X15.600 Y4.800 Z-0.003
+X15.700 Y4.800 Z-0.000
+X15.800 Y4.800 Z0.002
+X15.900 Y4.800 Z0.005
+X16.000 Y4.800 Z0.008
+X16.100 Y4.800 Z0.010
+X16.200 Y4.800 Z0.013
+X16.300 Y4.800 Z0.015
+X16.400 Y4.800 Z0.018
+X16.500 Y4.800 Z0.020
+X16.600 Y4.800 Z0.023
+X16.700 Y4.800 Z0.025
+X16.800 Y4.800 Z0.028
+X16.900 Y4.800 Z0.030
+X17.000 Y4.800 Z0.032
+X17.100 Y4.800 Z0.034
+X17.200 Y4.800 Z0.037
+X17.300 Y4.800 Z0.039
+X17.400 Y4.800 Z0.041
+X17.500 Y4.800 Z0.043
+X17.600 Y4.800 Z0.045
+X17.700 Y4.800 Z0.047
+X17.800 Y4.800 Z0.048
+X17.900 Y4.800 Z0.050
+X18.000 Y4.800 Z0.052
+X18.100 Y4.800 Z0.053
+X18.200 Y4.800 Z0.055
+X18.300 Y4.800 Z0.056
+X18.400 Y4.800 Z0.057
+X18.500 Y4.800 Z0.059
+X18.600 Y4.800 Z0.060
+X18.700 Y4.800 Z0.061
+X18.800 Y4.800 Z0.062
+X18.900 Y4.800 Z0.062
+X19.000 Y4.800 Z0.063
+X19.100 Y4.800 Z0.064
+X19.200 Y4.800 Z0.064
+X19.300 Y4.800 Z0.065
+X19.400 Y4.800 Z0.065
+X19.500 Y4.800 Z0.065
+X19.600 Y4.800 Z0.065
+X19.700 Y4.800 Z0.065
+X19.800 Y4.800 Z0.065
+X19.900 Y4.800 Z0.065
+X20.000 Y4.800 Z0.065
+X20.100 Y4.800 Z0.064
+X20.200 Y4.800 Z0.064
+X20.300 Y4.800 Z0.063
+X20.400 Y4.800 Z0.062
+X20.500 Y4.800 Z0.061
+X20.600 Y4.800 Z0.060
+X20.700 Y4.800 Z0.059
+X20.800 Y4.800 Z0.058
+X20.900 Y4.800 Z0.057
+X21.000 Y4.800 Z0.056
+X21.100 Y4.800 Z0.054
+X21.200 Y4.800 Z0.053
+X21.300 Y4.800 Z0.051
+X21.400 Y4.800 Z0.050
+X21.500 Y4.800 Z0.048
+X21.600 Y4.800 Z0.046
+X21.700 Y4.800 Z0.044
+X21.800 Y4.800 Z0.042
+X21.900 Y4.800 Z0.040
+X22.000 Y4.800 Z0.038
+X22.100 Y4.800 Z0.036
+X22.200 Y4.800 Z0.034
+X22.300 Y4.800 Z0.032
+X22.400 Y4.800 Z0.029
+X22.500 Y4.800 Z0.027
+X22.600 Y4.800 Z0.024
+X22.700 Y4.800 Z0.022
+X22.800 Y4.800 Z0.020
+X22.900 Y4.800 Z0.017
+X23.000 Y4.800 Z0.015
+X23.100 Y4.800 Z0.012
+X23.200 Y4.800 Z0.009
+X23.300 Y4.800 Z0.007
+X23.400 Y4.800 Z0.004
+X23.500 Y4.800 Z0.002
+X23.600 Y4.800 Z-0.001
+X23.700 Y4.800 Z-0.004
+X23.800 Y4.800 Z-0.006
+X23.900 Y4.800 Z-0.009
+X24.000 Y4.800 Z-0.011
+X24.100 Y4.800 Z-0.014
+X24.200 Y4.800 Z-0.016
+X24.300 Y4.800 Z-0.019
+X24.400 Y4.800 Z-0.021
+X24.500 Y4.800 Z-0.024
+X24.600 Y4.800 Z-0.026
+X24.700 Y4.800 Z-0.029
+X24.800 Y4.800 Z-0.031
+X24.900 Y4.800 Z-0.033
+X25.000 Y4.800 Z-0.035
+X25.100 Y4.800 Z-0.038
+X25.200 Y4.800 Z-0.040
+X25.300 Y4.800 Z-0.042
+X25.400 Y4.800 Z-0.044
+X25.500 Y4.800 Z-0.046
+X25.600 Y4.800 Z-0.047
+X25.700 Y4.800 Z-0.049
+X25.800 Y4.800 Z-0.051
+X25.900 Y4.800 Z-0.052
+X26.000 Y4.800 Z-0.054
+X26.100 Y4.800 Z-0.055
+X26.200 Y4.800 Z-0.057
+X26.300 Y4.800 Z-0.058
+X26.400 Y4.800 Z-0.059
+X26.500 Y4.800 Z-0.060
+X26.600 Y4.800 Z-0.061
+X26.700 Y4.800 Z-0.062
+X26.800 Y4.800 Z-0.063
+X26.900 Y4.800 Z-0.063
+X27.000 Y4.800 Z-0.064
+X27.100 Y4.800 Z-0.064
+X27.200 Y4.800 Z-0.065
+X27.300 Y4.800 Z-0.065
+X27.400 Y4.800 Z-0.065
+X27.500 Y4.800 Z-0.065
+X27.600 Y4.800 Z-0.065
+X27.700 Y4.800 Z-0.065
+X27.800 Y4.800 Z-0.065
+X27.900 Y4.800 Z-0.064
+X28.000 Y4.800 Z-0.064
+X28.100 Y4.800 Z-0.063
+X28.200 Y4.800 Z-0.063
+X28.300 Y4.800 Z-0.062
+X28.400 Y4.800 Z-0.061
+X28.500 Y4.800 Z-0.060
+X28.600 Y4.800 Z-0.059
+X28.700 Y4.800 Z-0.058
+X28.800 Y4.800 Z-0.056
+X28.900 Y4.800 Z-0.055
+X29.000 Y4.800 Z-0.054
+X29.100 Y4.800 Z-0.052
+X29.200 Y4.800 Z-0.051
+X29.300 Y4.800 Z-0.049
+X29.400 Y4.800 Z-0.047
+X29.500 Y4.800 Z-0.045
+X29.600 Y4.800 Z-0.043
+X29.700 Y4.800 Z-0.041
+X29.800 Y4.800 Z-0.039
+X29.900 Y4.800 Z-0.037
+X30.000 Y4.800 Z-0.035
+X30.000 Y5.600 Z0.029
+X29.900 Y5.600 Z0.031
+X29.800 Y5.600 Z0.033
+X29.700 Y5.600 Z0.035
+X29.600 Y5.600 Z0.036
+X29.500 Y5.600 Z0.038
+X29.400 Y5.600 Z0.039
+X29.300 Y5.600 Z0.041
+X29.200 Y5.600 Z0.042
+X29.100 Y5.600 Z0.044
+X29.000 Y5.600 Z0.045
+X28.900 Y5.600 Z0.046
+X28.800 Y5.600 Z0.047
+X28.700 Y5.600 Z0.048
+X28.600 Y5.600 Z0.049
+X28.500 Y5.600 Z0.050
+X28.400 Y5.600 Z0.051
+X28.300 Y5.600 Z0.052
+X28.200 Y5.600 Z0.052
+X28.100 Y5.600 Z0.053
+X28.000 Y5.600 Z0.053
+X27.900 Y5.600 Z0.054
+X27.800 Y5.600 Z0.054
+X27.700 Y5.600 Z0.054
+X27.600 Y5.600 Z0.054
+X27.500 Y5.600 Z0.054
+X27.400 Y5.600 Z0.054
+X27.300 Y5.600 Z0.054
+X27.200 Y5.600 Z0.054
+X27.100 Y5.600 Z0.054
+X27.000 Y5.600 Z0.053
+X26.900 Y5.600 Z0.053
+X26.800 Y5.600 Z0.052
+X26.700 Y5.600 Z0.052
+X26.600 Y5.600 Z0.051
+X26.500 Y5.600 Z0.050
+X26.400 Y5.600 Z0.049
+X26.300 Y5.600 Z0.048
+X26.200 Y5.600 Z0.047
+X26.100 Y5.600 Z0.046
+X26.000 Y5.600 Z0.045
+X25.900 Y5.600 Z0.044
+X25.800 Y5.600 Z0.043
+X25.700 Y5.600 Z0.041
+X25.600 Y5.600 Z0.040
+X25.500 Y5.600 Z0.038
+X25.400 Y5.600 Z0.037
+X25.300 Y5.600 Z0.035
+X25.200 Y5.600 Z0.033
+X25.100 Y5.600 Z0.031
+X25.000 Y5.600 Z0.030
+X24.900 Y5.600 Z0.028
+X24.800 Y5.600 Z0.026
+X24.700 Y5.600 Z0.024
+X24.600 Y5.600 Z0.022
+X24.500 Y5.600 Z0.020
+X24.400 Y5.600 Z0.018
+X24.300 Y5.600 Z0.016
+X24.200 Y5.600 Z0.014
+X24.100 Y5.600 Z0.012
+X24.000 Y5.600 Z0.009
+X23.900 Y5.600 Z0.007
+X23.800 Y5.600 Z0.005
+X23.700 Y5.600 Z0.003
+X23.600 Y5.600 Z0.001
+X23.500 Y5.600 Z-0.001
+X23.400 Y5.600 Z-0.004
+X23.300 Y5.600 Z-0.006
+X23.200 Y5.600 Z-0.008
+X23.100 Y5.600 Z-0.010
+X23.000 Y5.600 Z-0.012
+X22.900 Y5.600 Z-0.014
+X22.800 Y5.600 Z-0.016
+X22.700 Y5.600 Z-0.018
+X22.600 Y5.600 Z-0.020
+X22.500 Y5.600 Z-0.022
+X22.400 Y5.600 Z-0.024
+X22.300 Y5.600 Z-0.026
+X22.200 Y5.600 Z-0.028
+X22.100 Y5.600 Z-0.030
+X22.000 Y5.600 Z-0.032
+X21.900 Y5.600 Z-0.034
+X21.800 Y5.600 Z-0.035
+X21.700 Y5.600 Z-0.037
+X21.600 Y5.600 Z-0.039
+X21.500 Y5.600 Z-0.040
+X21.400 Y5.600 Z-0.041
+X21.300 Y5.600 Z-0.043
+X21.200 Y5.600 Z-0.044
+X21.100 Y5.600 Z-0.045
+X21.000 Y5.600 Z-0.047
+X20.900 Y5.600 Z-0.048
+X20.800 Y5.600 Z-0.049
+X20.700 Y5.600 Z-0.050
+X20.600 Y5.600 Z-0.050
+X20.500 Y5.600 Z-0.051
+X20.400 Y5.600 Z-0.052
+X20.300 Y5.600 Z-0.053
+X20.200 Y5.600 Z-0.053
+X20.100 Y5.600 Z-0.054
+X20.000 Y5.600 Z-0.054
+X19.900 Y5.600 Z-0.054
+X19.800 Y5.600 Z-0.054
+X19.700 Y5.600 Z-0.054
+X19.600 Y5.600 Z-0.054
+X19.500 Y5.600 Z-0.054
+X19.400 Y5.600 Z-0.054
+X19.300 Y5.600 Z-0.054
+X19.200 Y5.600 Z-0.054
+X19.100 Y5.600 Z-0.053
+X19.000 Y5.600 Z-0.053
+X18.900 Y5.600 Z-0.052
+X18.800 Y5.600 Z-0.051
+X18.700 Y5.600 Z-0.051
+X18.600 Y5.600 Z-0.050
+X18.500 Y5.600 Z-0.049
+X18.400 Y5.600 Z-0.048
+X18.300 Y5.600 Z-0.047
+X18.200 Y5.600 Z-0.046
+X18.100 Y5.600 Z-0.045
+X18.000 Y5.600 Z-0.043
+X17.900 Y5.600 Z-0.042
+X17.800 Y5.600 Z-0.040
+X17.700 Y5.600 Z-0.039
+X17.600 Y5.600 Z-0.037
+X17.500 Y5.600 Z-0.036
+X17.400 Y5.600 Z-0.034
+X17.300 Y5.600 Z-0.032
+X17.200 Y5.600 Z-0.031
+X17.100 Y5.600 Z-0.029
+X17.000 Y5.600 Z-0.027
+X16.900 Y5.600 Z-0.025
+X16.800 Y5.600 Z-0.023
+X16.700 Y5.600 Z-0.021
+X16.600 Y5.600 Z-0.019
+X16.500 Y5.600 Z-0.017
+X16.400 Y5.600 Z-0.015
+X16.300 Y5.600 Z-0.013
+X16.200 Y5.600 Z-0.011
+X16.100 Y5.600 Z-0.009
+X16.000 Y5.600 Z-0.006
+X15.900 Y5.600 Z-0.004
+X15.800 Y5.600 Z-0.002
+X15.700 Y5.600 Z0.000
+X15.600 Y5.600 Z0.002
+X15.500 Y5.600 Z0.005
+X15.400 Y5.600 Z0.007
+X15.300 Y5.600 Z0.009
+X15.200 Y5.600 Z0.011
+X15.100 Y5.600 Z0.013
+X15.000 Y5.600 Z0.015
+X14.900 Y5.600 Z0.017
+X14.800 Y5.600 Z0.019
+X14.700 Y5.600 Z0.021
+X14.600 Y5.600 Z0.023
+X14.500 Y5.600 Z0.025
+X14.400 Y5.600 Z0.027
+X14.300 Y5.600 Z0.029
+X14.200 Y5.600 Z0.031
+X14.100 Y5.600 Z0.033
+X14.000 Y5.600 Z0.034
+X13.900 Y5.600 Z0.036
+X13.800 Y5.600 Z0.038
+X13.700 Y5.600 Z0.039
+X13.600 Y5.600 Z0.041
+X13.500 Y5.600 Z0.042
+X13.400 Y5.600 Z0.043
+X13.300 Y5.600 Z0.045
+X13.200 Y5.600 Z0.046
+X13.100 Y5.600 Z0.047
+X13.000 Y5.600 Z0.048
+X12.900 Y5.600 Z0.049
+X12.800 Y5.600 Z0.050
+X12.700 Y5.600 Z0.051
+X12.600 Y5.600 Z0.052
+X12.500 Y5.600 Z0.052
+X12.400 Y5.600 Z0.053
+X12.300 Y5.600 Z0.053
+X12.200 Y5.600 Z0.054
+X12.100 Y5.600 Z0.054
+X12.000 Y5.600 Z0.054
+X11.900 Y5.600 Z0.054
+X11.800 Y5.600 Z0.054
+X11.700 Y5.600 Z0.054
+X11.600 Y5.600 Z0.054
+X11.500 Y5.600 Z0.054
+X11.400 Y5.600 Z0.054
+X11.300 Y5.600 Z0.053
+X11.200 Y5.600 Z0.053
+X11.100 Y5.600 Z0.052
+X11.000 Y5.600 Z0.052
+X10.900 Y5.600 Z0.051
+X10.800 Y5.600 Z0.050
+X10.700 Y5.600 Z0.049
+X10.600 Y5.600 Z0.049
+X10.500 Y5.600 Z0.047
+X10.400 Y5.600 Z0.046
+X10.300 Y5.600 Z0.045
+X10.200 Y5.600 Z0.044
+X10.100 Y5.600 Z0.043
+X10.000 Y5.600 Z0.041
+X9.900 Y5.600 Z0.040
+X9.800 Y5.600 Z0.038
+X9.700 Y5.600 Z0.037
+X9.600 Y5.600 Z0.035
+X9.500 Y5.600 Z0.033
+X9.400 Y5.600 Z0.032
+X9.300 Y5.600 Z0.030
+X9.200 Y5.600 Z0.028
+X9.100 Y5.600 Z0.026
+X9.000 Y5.600 Z0.024
+X8.900 Y5.600 Z0.022
+X8.800 Y5.600 Z0.020
+X8.700 Y5.600 Z0.018
+X8.600 Y5.600 Z0.016
+X8.500 Y5.600 Z0.014
+X8.400 Y5.600 Z0.012
+X8.300 Y5.600 Z0.010
+X8.200 Y5.600 Z0.008
+X8.100 Y5.600 Z0.005
+X8.000 Y5.600 Z0.003
+X7.900 Y5.600 Z0.001
+X7.800 Y5.600 Z-0.001
+X7.700 Y5.600 Z-0.003
+X7.600 Y5.600 Z-0.006
+X7.500 Y5.600 Z-0.008
+X7.400 Y5.600 Z-0.010
+X7.300 Y5.600 Z-0.012
+X7.200 Y5.600 Z-0.014
+X7.100 Y5.600 Z-0.016
+X7.000 Y5.600 Z-0.018
+X6.900 Y5.600 Z-0.020
+X6.800 Y5.600 Z-0.022
+X6.700 Y5.600 Z-0.024
+X6.600 Y5.600 Z-0.026
+X6.500 Y5.600 Z-0.028
+X6.400 Y5.600 Z-0.030
+X6.300 Y5.600 Z-0.032
+X6.200 Y5.600 Z-0.033
+X6.100 Y5.600 Z-0.035
+X6.000 Y5.600 Z-0.037
+X5.900 Y5.600 Z-0.038
+X5.800 Y5.600 Z-0.040
+X5.700 Y5.600 Z-0.041
+X5.600 Y5.600 Z-0.043
+X5.500 Y5.600 Z-0.044
+X5.400 Y5.600 Z-0.045
+X5.300 Y5.600 Z-0.046
+X5.200 Y5.600 Z-0.048
+X5.100 Y5.600 Z-0.049
+X5.000 Y5.600 Z-0.050
+X4.900 Y5.600 Z-0.050
+X4.800 Y5.600 Z-0.051
+X4.700 Y5.600 Z-0.052
+X4.600 Y5.600 Z-0.053
+X4.500 Y5.600 Z-0.053
+X4.400 Y5.600 Z-0.054
+X4.300 Y5.600 Z-0.054
+X4.200 Y5.600 Z-0.054
+X4.100 Y5.600 Z-0.054
+X4.000 Y5.600 Z-0.054
+X3.900 Y5.600 Z-0.054
+X3.800 Y5.600 Z-0.054
+X3.700 Y5.600 Z-0.054
+X3.600 Y5.600 Z-0.054
+X3.500 Y5.600 Z-0.054
+X3.400 Y5.600 Z-0.053
+X3.300 Y5.600 Z-0.053
+X3.200 Y5.600 Z-0.052
+X3.100 Y5.600 Z-0.052
+X3.000 Y5.600 Z-0.051
+X2.900 Y5.600 Z-0.050
+X2.800 Y5.600 Z-0.049
+X2.700 Y5.600 Z-0.048
+X2.600 Y5.600 Z-0.047
+X2.500 Y5.600 Z-0.046
+X2.400 Y5.600 Z-0.045
+X2.300 Y5.600 Z-0.043
+X2.200 Y5.600 Z-0.042
+X2.100 Y5.600 Z-0.041
+X2.000 Y5.600 Z-0.039
+X1.900 Y5.600 Z-0.038
+X1.800 Y5.600 Z-0.036
+X1.700 Y5.600 Z-0.034
+X1.600 Y5.600 Z-0.033
+X1.500 Y5.600 Z-0.031
+X1.400 Y5.600 Z-0.029
+X1.300 Y5.600 Z-0.027
+X1.200 Y5.600 Z-0.025
+X1.100 Y5.600 Z-0.023
+X1.000 Y5.600 Z-0.021
+X0.900 Y5.600 Z-0.019
+X0.800 Y5.600 Z-0.017
+X0.700 Y5.600 Z-0.015
+X0.600 Y5.600 Z-0.013
+X0.500 Y5.600 Z-0.011
+X0.400 Y5.600 Z-0.009
+X0.300 Y5.600 Z-0.007
+X0.200 Y5.600 Z-0.004
+X0.100 Y5.600 Z-0.002
+X0.000 Y5.600 Z-0.000
+X0.000 Y6.400 Z-0.000
+X0.100 Y6.400 Z-0.007
+X0.200 Y6.400 Z-0.014
+X0.300 Y6.400 Z-0.020
+X0.400 Y6.400 Z-0.027
+X0.500 Y6.400 Z-0.034
+X0.600 Y6.400 Z-0.041
+X0.700 Y6.400 Z-0.047
+X0.800 Y6.400 Z-0.054
+X0.900 Y6.400 Z-0.060
+X1.000 Y6.400 Z-0.067
+X1.100 Y6.400 Z-0.073
+X1.200 Y6.400 Z-0.079
+X1.300 Y6.400 Z-0.085
+X1.400 Y6.400 Z-0.091
+X1.500 Y6.400 Z-0.097
+X1.600 Y6.400 Z-0.102
+X1.700 Y6.400 Z-0.108
+X1.800 Y6.400 Z-0.113
+X1.900 Y6.400 Z-0.118
+X2.000 Y6.400 Z-0.123
+X2.100 Y6.400 Z-0.127
+X2.200 Y6.400 Z-0.132
+X2.300 Y6.400 Z-0.136
+X2.400 Y6.400 Z-0.140
+X2.500 Y6.400 Z-0.144
+X2.600 Y6.400 Z-0.148
+X2.700 Y6.400 Z-0.151
+X2.800 Y6.400 Z-0.154
+X2.900 Y6.400 Z-0.157
+X3.000 Y6.400 Z-0.159
+X3.100 Y6.400 Z-0.162
+X3.200 Y6.400 Z-0.164
+X3.300 Y6.400 Z-0.166
+X3.400 Y6.400 Z-0.167
+X3.500 Y6.400 Z-0.169
+X3.600 Y6.400 Z-0.170
+X3.700 Y6.400 Z-0.170
+X3.800 Y6.400 Z-0.171
+X3.900 Y6.400 Z-0.171
+X4.000 Y6.400 Z-0.171
+X4.100 Y6.400 Z-0.171
+X4.200 Y6.400 Z-0.170
+X4.300 Y6.400 Z-0.169
+X4.400 Y6.400 Z-0.168
+X4.500 Y6.400 Z-0.167
+X4.600 Y6.400 Z-0.165
+X4.700 Y6.400 Z-0.163
+X4.800 Y6.400 Z-0.161
+X4.900 Y6.400 Z-0.158
+X5.000 Y6.400 Z-0.156
+X5.100 Y6.400 Z-0.153
+X5.200 Y6.400 Z-0.149
+X5.300 Y6.400 Z-0.146
+X5.400 Y6.400 Z-0.142
+X5.500 Y6.400 Z-0.138
+X5.600 Y6.400 Z-0.134
+X5.700 Y6.400 Z-0.130
+X5.800 Y6.400 Z-0.125
+X5.900 Y6.400 Z-0.121
+X6.000 Y6.400 Z-0.116
+X6.100 Y6.400 Z-0.110
+X6.200 Y6.400 Z-0.105
+X6.300 Y6.400 Z-0.100
+X6.400 Y6.400 Z-0.094
+X6.500 Y6.400 Z-0.088
+X6.600 Y6.400 Z-0.082
+X6.700 Y6.400 Z-0.076
+X6.800 Y6.400 Z-0.070
+X6.900 Y6.400 Z-0.064
+X7.000 Y6.400 Z-0.057
+X7.100 Y6.400 Z-0.051
+X7.200 Y6.400 Z-0.044
+X7.300 Y6.400 Z-0.038
+X7.400 Y6.400 Z-0.031
+X7.500 Y6.400 Z-0.024
+X7.600 Y6.400 Z-0.017
+X7.700 Y6.400 Z-0.011
+X7.800 Y6.400 Z-0.004
+X7.900 Y6.400 Z0.003
+X8.000 Y6.400 Z0.010
+X8.100 Y6.400 Z0.017
+X8.200 Y6.400 Z0.024
+X8.300 Y6.400 Z0.030
+X8.400 Y6.400 Z0.037
+X8.500 Y6.400 Z0.044
+X8.600 Y6.400 Z0.050
+X8.700 Y6.400 Z0.057
+X8.800 Y6.400 Z0.063
+X8.900 Y6.400 Z0.070
+X9.000 Y6.400 Z0.076
+X9.100 Y6.400 Z0.082
+X9.200 Y6.400 Z0.088
+X9.300 Y6.400 Z0.094
+X9.400 Y6.400 Z0.099
+X9.500 Y6.400 Z0.105
+X9.600 Y6.400 Z0.110
+X9.700 Y6.400 Z0.115
+X9.800 Y6.400 Z0.120
+X9.900 Y6.400 Z0.125
+X10.000 Y6.400 Z0.129
+X10.100 Y6.400 Z0.134
+X10.200 Y6.400 Z0.138
+X10.300 Y6.400 Z0.142
+X10.400 Y6.400 Z0.146
+X10.500 Y6.400 Z0.149
+X10.600 Y6.400 Z0.152
+X10.700 Y6.400 Z0.155
+X10.800 Y6.400 Z0.158
+X10.900 Y6.400 Z0.161
+X11.000 Y6.400 Z0.163
+X11.100 Y6.400 Z0.165
+X11.200 Y6.400 Z0.166
+X11.300 Y6.400 Z0.168
+X11.400 Y6.400 Z0.169
+X11.500 Y6.400 Z0.170
+X11.600 Y6.400 Z0.171
+X11.700 Y6.400 Z0.171
+X11.800 Y6.400 Z0.171
+X11.900 Y6.400 Z0.171
+X12.000 Y6.400 Z0.170
+X12.100 Y6.400 Z0.170
+X12.200 Y6.400 Z0.169
+X12.300 Y6.400 Z0.167
+X12.400 Y6.400 Z0.166
+X12.500 Y6.400 Z0.164
+X12.600 Y6.400 Z0.162
+X12.700 Y6.400 Z0.160
+X12.800 Y6.400 Z0.157
+X12.900 Y6.400 Z0.154
+X13.000 Y6.400 Z0.151
+X13.100 Y6.400 Z0.148
+X13.200 Y6.400 Z0.144
+X13.300 Y6.400 Z0.140
+X13.400 Y6.400 Z0.136
+X13.500 Y6.400 Z0.132
+X13.600 Y6.400 Z0.128
+X13.700 Y6.400 Z0.123
+X13.800 Y6.400 Z0.118
+X13.900 Y6.400 Z0.113
+X14.000 Y6.400 Z0.108
+X14.100 Y6.400 Z0.103
+X14.200 Y6.400 Z0.097
+X14.300 Y6.400 Z0.091
+X14.400 Y6.400 Z0.085
+X14.500 Y6.400 Z0.079
+X14.600 Y6.400 Z0.073
+X14.700 Y6.400 Z0.067
+X14.800 Y6.400 Z0.061
+X14.900 Y6.400 Z0.054
+X15.000 Y6.400 Z0.048
+X15.100 Y6.400 Z0.041
+X15.200 Y6.400 Z0.035
+X15.300 Y6.400 Z0.028
+X15.400 Y6.400 Z0.021
+X15.500 Y6.400 Z0.014
+X15.600 Y6.400 Z0.007
+X15.700 Y6.400 Z0.001
+X15.800 Y6.400 Z-0.006
+X15.900 Y6.400 Z-0.013
+X16.000 Y6.400 Z-0.020
+X16.100 Y6.400 Z-0.027
+X16.200 Y6.400 Z-0.033
+X16.300 Y6.400 Z-0.040
+X16.400 Y6.400 Z-0.047
+X16.500 Y6.400 Z-0.053
+X16.600 Y6.400 Z-0.060
+X16.700 Y6.400 Z-0.066
+X16.800 Y6.400 Z-0.072
+X16.900 Y6.400 Z-0.079
+X17.000 Y6.400 Z-0.085
+X17.100 Y6.400 Z-0.090
+X17.200 Y6.400 Z-0.096
+X17.300 Y6.400 Z-0.102
+X17.400 Y6.400 Z-0.107
+X17.500 Y6.400 Z-0.112
+X17.600 Y6.400 Z-0.117
+X17.700 Y6.400 Z-0.122
+X17.800 Y6.400 Z-0.127
+X17.900 Y6.400 Z-0.132
+X18.000 Y6.400 Z-0.136
+X18.100 Y6.400 Z-0.140
+X18.200 Y6.400 Z-0.144
+X18.300 Y6.400 Z-0.147
+X18.400 Y6.400 Z-0.151
+X18.500 Y6.400 Z-0.154
+X18.600 Y6.400 Z-0.157
+X18.700 Y6.400 Z-0.159
+X18.800 Y6.400 Z-0.162
+X18.900 Y6.400 Z-0.164
+X19.000 Y6.400 Z-0.166
+X19.100 Y6.400 Z-0.167
+X19.200 Y6.400 Z-0.168
+X19.300 Y6.400 Z-0.170
+X19.400 Y6.400 Z-0.170
+X19.500 Y6.400 Z-0.171
+X19.600 Y6.400 Z-0.171
+X19.700 Y6.400 Z-0.171
+X19.800 Y6.400 Z-0.171
+X19.900 Y6.400 Z-0.170
+X20.000 Y6.400 Z-0.169
+X20.100 Y6.400 Z-0.168
+X20.200 Y6.400 Z-0.167
+X20.300 Y6.400 Z-0.165
+X20.400 Y6.400 Z-0.163
+X20.500 Y6.400 Z-0.161
+X20.600 Y6.400 Z-0.158
+X20.700 Y6.400 Z-0.156
+X20.800 Y6.400 Z-0.153
+X20.900 Y6.400 Z-0.150
+X21.000 Y6.400 Z-0.146
+X21.100 Y6.400 Z-0.143
+X21.200 Y6.400 Z-0.139
+X21.300 Y6.400 Z-0.135
+X21.400 Y6.400 Z-0.130
+X21.500 Y6.400 Z-0.126
+X21.600 Y6.400 Z-0.121
+X21.700 Y6.400 Z-0.116
+X21.800 Y6.400 Z-0.111
+X21.900 Y6.400 Z-0.106
+X22.000 Y6.400 Z-0.100
+X22.100 Y6.400 Z-0.094
+X22.200 Y6.400 Z-0.089
+X22.300 Y6.400 Z-0.083
+X22.400 Y6.400 Z-0.077
+X22.500 Y6.400 Z-0.071
+X22.600 Y6.400 Z-0.064
+X22.700 Y6.400 Z-0.058
+X22.800 Y6.400 Z-0.051
+X22.900 Y6.400 Z-0.045
+X23.000 Y6.400 Z-0.038
+X23.100 Y6.400 Z-0.031
+X23.200 Y6.400 Z-0.025
+X23.300 Y6.400 Z-0.018
+X23.400 Y6.400 Z-0.011
+X23.500 Y6.400 Z-0.004
+X23.600 Y6.400 Z0.003
+X23.700 Y6.400 Z0.009
+X23.800 Y6.400 Z0.016
+X23.900 Y6.400 Z0.023
+X24.000 Y6.400 Z0.030
+X24.100 Y6.400 Z0.037
+X24.200 Y6.400 Z0.043
+X24.300 Y6.400 Z0.050
+X24.400 Y6.400 Z0.056
+X24.500 Y6.400 Z0.063
+X24.600 Y6.400 Z0.069
+X24.700 Y6.400 Z0.075
+X24.800 Y6.400 Z0.081
+X24.900 Y6.400 Z0.087
+X25.000 Y6.400 Z0.093
+X25.100 Y6.400 Z0.099
+X25.200 Y6.400 Z0.104
+X25.300 Y6.400 Z0.110
+X25.400 Y6.400 Z0.115
+X25.500 Y6.400 Z0.120
+X25.600 Y6.400 Z0.125
+X25.700 Y6.400 Z0.129
+X25.800 Y6.400 Z0.133
+X25.900 Y6.400 Z0.138
+X26.000 Y6.400 Z0.142
+X26.100 Y6.400 Z0.145
+X26.200 Y6.400 Z0.149
+X26.300 Y6.400 Z0.152
+X26.400 Y6.400 Z0.155
+X26.500 Y6.400 Z0.158
+X26.600 Y6.400 Z0.160
+X26.700 Y6.400 Z0.163
+X26.800 Y6.400 Z0.165
+X26.900 Y6.400 Z0.166
+X27.000 Y6.400 Z0.168
+X27.100 Y6.400 Z0.169
+X27.200 Y6.400 Z0.170
+X27.300 Y6.400 Z0.171
+X27.400 Y6.400 Z0.171
+X27.500 Y6.400 Z0.171
+X27.600 Y6.400 Z0.171
+X27.700 Y6.400 Z0.170
+X27.800 Y6.400 Z0.170
+X27.900 Y6.400 Z0.169
+X28.000 Y6.400 Z0.168
+X28.100 Y6.400 Z0.166
+X28.200 Y6.400 Z0.164
+X28.300 Y6.400 Z0.162
+X28.400 Y6.400 Z0.160
+X28.500 Y6.400 Z0.157
+X28.600 Y6.400 Z0.154
+X28.700 Y6.400 Z0.151
+X28.800 Y6.400 Z0.148
+X28.900 Y6.400 Z0.145
+X29.000 Y6.400 Z0.141
+X29.100 Y6.400 Z0.137
+X29.200 Y6.400 Z0.133
+X29.300 Y6.400 Z0.128
+X29.400 Y6.400 Z0.123
+X29.500 Y6.400 Z0.119
+X29.600 Y6.400 Z0.114
+X29.700 Y6.400 Z0.108
+X29.800 Y6.400 Z0.103
+X29.900 Y6.400 Z0.097
+X30.000 Y6.400 Z0.092
+X30.000 Y7.200 Z0.149
+X29.900 Y7.200 Z0.158
+X29.800 Y7.200 Z0.167
+X29.700 Y7.200 Z0.176
+X29.600 Y7.200 Z0.185
+X29.500 Y7.200 Z0.193
+X29.400 Y7.200 Z0.201
+X29.300 Y7.200 Z0.208
+X29.200 Y7.200 Z0.215
+X29.100 Y7.200 Z0.222
+X29.000 Y7.200 Z0.229
+X28.900 Y7.200 Z0.235
+X28.800 Y7.200 Z0.241
+X28.700 Y7.200 Z0.246
+X28.600 Y7.200 Z0.251
+X28.500 Y7.200 Z0.255
+X28.400 Y7.200 Z0.260
+X28.300 Y7.200 Z0.263
+X28.200 Y7.200 Z0.267
+X28.100 Y7.200 Z0.270
+X28.000 Y7.200 Z0.272
+X27.900 Y7.200 Z0.274
+X27.800 Y7.200 Z0.276
+X27.700 Y7.200 Z0.277
+X27.600 Y7.200 Z0.278
+X27.500 Y7.200 Z0.278
+X27.400 Y7.200 Z0.278
+X27.300 Y7.200 Z0.277
+X27.200 Y7.200 Z0.276
+X27.100 Y7.200 Z0.274
+X27.000 Y7.200 Z0.273
+X26.900 Y7.200 Z0.270
+X26.800 Y7.200 Z0.267
+X26.700 Y7.200 Z0.264
+X26.600 Y7.200 Z0.260
+X26.500 Y7.200 Z0.256
+X26.400 Y7.200 Z0.252
+X26.300 Y7.200 Z0.247
+X26.200 Y7.200 Z0.242
+X26.100 Y7.200 Z0.236
+X26.000 Y7.200 Z0.230
+X25.900 Y7.200 Z0.224
+X25.800 Y7.200 Z0.217
+X25.700 Y7.200 Z0.210
+X25.600 Y7.200 Z0.202
+X25.500 Y7.200 Z0.194
+X25.400 Y7.200 Z0.186
+X25.300 Y7.200 Z0.178
+X25.200 Y7.200 Z0.169
+X25.100 Y7.200 Z0.160
+X25.000 Y7.200 Z0.151
+X24.900 Y7.200 Z0.142
+X24.800 Y7.200 Z0.132
+X24.700 Y7.200 Z0.122
+X24.600 Y7.200 Z0.112
+X24.500 Y7.200 Z0.102
+X24.400 Y7.200 Z0.091
+X24.300 Y7.200 Z0.081
+X24.200 Y7.200 Z0.070
+X24.100 Y7.200 Z0.059
+X24.000 Y7.200 Z0.048
+X23.900 Y7.200 Z0.037
+X23.800 Y7.200 Z0.026
+X23.700 Y7.200 Z0.015
+X23.600 Y7.200 Z0.004
+X23.500 Y7.200 Z-0.007
+X23.400 Y7.200 Z-0.018
+X23.300 Y7.200 Z-0.029
+X23.200 Y7.200 Z-0.040
+X23.100 Y7.200 Z-0.051
+X23.000 Y7.200 Z-0.062
+X22.900 Y7.200 Z-0.073
+X22.800 Y7.200 Z-0.083
+X22.700 Y7.200 Z-0.094
+X22.600 Y7.200 Z-0.104
+X22.500 Y7.200 Z-0.115
+X22.400 Y7.200 Z-0.125
+X22.300 Y7.200 Z-0.134
+X22.200 Y7.200 Z-0.144
+X22.100 Y7.200 Z-0.153
+X22.000 Y7.200 Z-0.163
+X21.900 Y7.200 Z-0.171
+X21.800 Y7.200 Z-0.180
+X21.700 Y7.200 Z-0.188
+X21.600 Y7.200 Z-0.196
+X21.500 Y7.200 Z-0.204
+X21.400 Y7.200 Z-0.211
+X21.300 Y7.200 Z-0.218
+X21.200 Y7.200 Z-0.225
+X21.100 Y7.200 Z-0.231
+X21.000 Y7.200 Z-0.237
+X20.900 Y7.200 Z-0.243
+X20.800 Y7.200 Z-0.248
+X20.700 Y7.200 Z-0.253
+X20.600 Y7.200 Z-0.257
+X20.500 Y7.200 Z-0.261
+X20.400 Y7.200 Z-0.265
+X20.300 Y7.200 Z-0.268
+X20.200 Y7.200 Z-0.271
+X20.100 Y7.200 Z-0.273
+X20.000 Y7.200 Z-0.275
+X19.900 Y7.200 Z-0.276
+X19.800 Y7.200 Z-0.277
+X19.700 Y7.200 Z-0.278
+X19.600 Y7.200 Z-0.278
+X19.500 Y7.200 Z-0.277
+X19.400 Y7.200 Z-0.277
+X19.300 Y7.200 Z-0.275
+X19.200 Y7.200 Z-0.274
+X19.100 Y7.200 Z-0.272
+X19.000 Y7.200 Z-0.269
+X18.900 Y7.200 Z-0.266
+X18.800 Y7.200 Z-0.262
+X18.700 Y7.200 Z-0.259
+X18.600 Y7.200 Z-0.254
+X18.500 Y7.200 Z-0.250
+X18.400 Y7.200 Z-0.245
+X18.300 Y7.200 Z-0.239
+X18.200 Y7.200 Z-0.233
+X18.100 Y7.200 Z-0.227
+X18.000 Y7.200 Z-0.221
+X17.900 Y7.200 Z-0.214
+X17.800 Y7.200 Z-0.206
+X17.700 Y7.200 Z-0.199
+X17.600 Y7.200 Z-0.191
+X17.500 Y7.200 Z-0.183
+X17.400 Y7.200 Z-0.174
+X17.300 Y7.200 Z-0.165
+X17.200 Y7.200 Z-0.156
+X17.100 Y7.200 Z-0.147
+X17.000 Y7.200 Z-0.137
+X16.900 Y7.200 Z-0.128
+X16.800 Y7.200 Z-0.118
+X16.700 Y7.200 Z-0.107
+X16.600 Y7.200 Z-0.097
+X16.500 Y7.200 Z-0.087
+X16.400 Y7.200 Z-0.076
+X16.300 Y7.200 Z-0.065
+X16.200 Y7.200 Z-0.054
+X16.100 Y7.200 Z-0.043
+X16.000 Y7.200 Z-0.032
+X15.900 Y7.200 Z-0.021
+X15.800 Y7.200 Z-0.010
+X15.700 Y7.200 Z0.001
+X15.600 Y7.200 Z0.012
+X15.500 Y7.200 Z0.023
+X15.400 Y7.200 Z0.034
+X15.300 Y7.200 Z0.045
+X15.200 Y7.200 Z0.056
+X15.100 Y7.200 Z0.067
+X15.000 Y7.200 Z0.078
+X14.900 Y7.200 Z0.088
+X14.800 Y7.200 Z0.099
+X14.700 Y7.200 Z0.109
+X14.600 Y7.200 Z0.119
+X14.500 Y7.200 Z0.129
+X14.400 Y7.200 Z0.139
+X14.300 Y7.200 Z0.148
+X14.200 Y7.200 Z0.158
+X14.100 Y7.200 Z0.167
+X14.000 Y7.200 Z0.175
+X13.900 Y7.200 Z0.184
+X13.800 Y7.200 Z0.192
+X13.700 Y7.200 Z0.200
+X13.600 Y7.200 Z0.207
+X13.500 Y7.200 Z0.215
+X13.400 Y7.200 Z0.222
+X13.300 Y7.200 Z0.228
+X13.200 Y7.200 Z0.234
+X13.100 Y7.200 Z0.240
+X13.000 Y7.200 Z0.245
+X12.900 Y7.200 Z0.250
+X12.800 Y7.200 Z0.255
+X12.700 Y7.200 Z0.259
+X12.600 Y7.200 Z0.263
+X12.500 Y7.200 Z0.266
+X12.400 Y7.200 Z0.269
+X12.300 Y7.200 Z0.272
+X12.200 Y7.200 Z0.274
+X12.100 Y7.200 Z0.276
+X12.000 Y7.200 Z0.277
+X11.900 Y7.200 Z0.278
+X11.800 Y7.200 Z0.278
+X11.700 Y7.200 Z0.278
+X11.600 Y7.200 Z0.277
+X11.500 Y7.200 Z0.276
+X11.400 Y7.200 Z0.275
+X11.300 Y7.200 Z0.273
+X11.200 Y7.200 Z0.270
+X11.100 Y7.200 Z0.268
+X11.000 Y7.200 Z0.264
+X10.900 Y7.200 Z0.261
+X10.800 Y7.200 Z0.257
+X10.700 Y7.200 Z0.252
+X10.600 Y7.200 Z0.247
+X10.500 Y7.200 Z0.242
+X10.400 Y7.200 Z0.237
+X10.300 Y7.200 Z0.231
+X10.200 Y7.200 Z0.224
+X10.100 Y7.200 Z0.217
+X10.000 Y7.200 Z0.210
+X9.900 Y7.200 Z0.203
+X9.800 Y7.200 Z0.195
+X9.700 Y7.200 Z0.187
+X9.600 Y7.200 Z0.179
+X9.500 Y7.200 Z0.170
+X9.400 Y7.200 Z0.161
+X9.300 Y7.200 Z0.152
+X9.200 Y7.200 Z0.142
+X9.100 Y7.200 Z0.133
+X9.000 Y7.200 Z0.123
+X8.900 Y7.200 Z0.113
+X8.800 Y7.200 Z0.103
+X8.700 Y7.200 Z0.092
+X8.600 Y7.200 Z0.082
+X8.500 Y7.200 Z0.071
+X8.400 Y7.200 Z0.060
+X8.300 Y7.200 Z0.049
+X8.200 Y7.200 Z0.038
+X8.100 Y7.200 Z0.027
+X8.000 Y7.200 Z0.016
+X7.900 Y7.200 Z0.005
+X7.800 Y7.200 Z-0.006
+X7.700 Y7.200 Z-0.017
+X7.600 Y7.200 Z-0.028
+X7.500 Y7.200 Z-0.039
+X7.400 Y7.200 Z-0.050
+X7.300 Y7.200 Z-0.061
+X7.200 Y7.200 Z-0.072
+X7.100 Y7.200 Z-0.083
+X7.000 Y7.200 Z-0.093
+X6.900 Y7.200 Z-0.103
+X6.800 Y7.200 Z-0.114
+X6.700 Y7.200 Z-0.124
+X6.600 Y7.200 Z-0.134
+X6.500 Y7.200 Z-0.143
+X6.400 Y7.200 Z-0.153
+X6.300 Y7.200 Z-0.162
+X6.200 Y7.200 Z-0.171
+X6.100 Y7.200 Z-0.179
+X6.000 Y7.200 Z-0.188
+X5.900 Y7.200 Z-0.196
+X5.800 Y7.200 Z-0.203
+X5.700 Y7.200 Z-0.211
+X5.600 Y7.200 Z-0.218
+X5.500 Y7.200 Z-0.225
+X5.400 Y7.200 Z-0.231
+X5.300 Y7.200 Z-0.237
+X5.200 Y7.200 Z-0.243
+X5.100 Y7.200 Z-0.248
+X5.000 Y7.200 Z-0.253
+X4.900 Y7.200 Z-0.257
+X4.800 Y7.200 Z-0.261
+X4.700 Y7.200 Z-0.265
+X4.600 Y7.200 Z-0.268
+X4.500 Y7.200 Z-0.271
+X4.400 Y7.200 Z-0.273
+X4.300 Y7.200 Z-0.275
+X4.200 Y7.200 Z-0.276
+X4.100 Y7.200 Z-0.277
+X4.000 Y7.200 Z-0.278
+X3.900 Y7.200 Z-0.278
+X3.800 Y7.200 Z-0.277
+X3.700 Y7.200 Z-0.277
+X3.600 Y7.200 Z-0.275
+X3.500 Y7.200 Z-0.274
+X3.400 Y7.200 Z-0.272
+X3.300 Y7.200 Z-0.269
+X3.200 Y7.200 Z-0.266
+X3.100 Y7.200 Z-0.263
+X3.000 Y7.200 Z-0.259
+X2.900 Y7.200 Z-0.255
+X2.800 Y7.200 Z-0.250
+X2.700 Y7.200 Z-0.245
+X2.600 Y7.200 Z-0.240
+X2.500 Y7.200 Z-0.234
+X2.400 Y7.200 Z-0.228
+X2.300 Y7.200 Z-0.221
+X2.200 Y7.200 Z-0.214
+X2.100 Y7.200 Z-0.207
+X2.000 Y7.200 Z-0.199
+X1.900 Y7.200 Z-0.191
+X1.800 Y7.200 Z-0.183
+X1.700 Y7.200 Z-0.175
+X1.600 Y7.200 Z-0.166
+X1.500 Y7.200 Z-0.157
+X1.400 Y7.200 Z-0.148
+X1.300 Y7.200 Z-0.138
+X1.200 Y7.200 Z-0.128
+X1.100 Y7.200 Z-0.118
+X1.000 Y7.200 Z-0.108
+X0.900 Y7.200 Z-0.098
+X0.800 Y7.200 Z-0.087
+X0.700 Y7.200 Z-0.077
+X0.600 Y7.200 Z-0.066
+X0.500 Y7.200 Z-0.055
+X0.400 Y7.200 Z-0.044
+X0.300 Y7.200 Z-0.033
+X0.200 Y7.200 Z-0.022
+X0.100 Y7.200 Z-0.011
+X0.000 Y7.200 Z-0.000
+X0.000 Y8.000 Z-0.000
+X0.100 Y8.000 Z-0.015
+X0.200 Y8.000 Z-0.029
+X0.300 Y8.000 Z-0.044
+X0.400 Y8.000 Z-0.059
+X0.500 Y8.000 Z-0.073
+X0.600 Y8.000 Z-0.088
+X0.700 Y8.000 Z-0.102
+X0.800 Y8.000 Z-0.116
+X0.900 Y8.000 Z-0.130
+X1.000 Y8.000 Z-0.144
+X1.100 Y8.000 Z-0.157
+X1.200 Y8.000 Z-0.170
+X1.300 Y8.000 Z-0.183
+X1.400 Y8.000 Z-0.196
+X1.500 Y8.000 Z-0.208
+X1.600 Y8.000 Z-0.220
+X1.700 Y8.000 Z-0.232
+X1.800 Y8.000 Z-0.243
+X1.900 Y8.000 Z-0.254
+X2.000 Y8.000 Z-0.264
+X2.100 Y8.000 Z-0.275
+X2.200 Y8.000 Z-0.284
+X2.300 Y8.000 Z-0.293
+X2.400 Y8.000 Z-0.302
+X2.500 Y8.000 Z-0.310
+X2.600 Y8.000 Z-0.318
+X2.700 Y8.000 Z-0.325
+X2.800 Y8.000 Z-0.332
+X2.900 Y8.000 Z-0.338
+X3.000 Y8.000 Z-0.344
+X3.100 Y8.000 Z-0.349
+X3.200 Y8.000 Z-0.353
+X3.300 Y8.000 Z-0.357
+X3.400 Y8.000 Z-0.361
+X3.500 Y8.000 Z-0.363
+X3.600 Y8.000 Z-0.366
+X3.700 Y8.000 Z-0.367
+X3.800 Y8.000 Z-0.368
+X3.900 Y8.000 Z-0.369
+X4.000 Y8.000 Z-0.369
+X4.100 Y8.000 Z-0.368
+X4.200 Y8.000 Z-0.367
+X4.300 Y8.000 Z-0.365
+X4.400 Y8.000 Z-0.362
+X4.500 Y8.000 Z-0.359
+X4.600 Y8.000 Z-0.355
+X4.700 Y8.000 Z-0.351
+X4.800 Y8.000 Z-0.346
+X4.900 Y8.000 Z-0.341
+X5.000 Y8.000 Z-0.335
+X5.100 Y8.000 Z-0.329
+X5.200 Y8.000 Z-0.322
+X5.300 Y8.000 Z-0.314
+X5.400 Y8.000 Z-0.307
+X5.500 Y8.000 Z-0.298
+X5.600 Y8.000 Z-0.289
+X5.700 Y8.000 Z-0.280
+X5.800 Y8.000 Z-0.270
+X5.900 Y8.000 Z-0.260
+X6.000 Y8.000 Z-0.249
+X6.100 Y8.000 Z-0.238
+X6.200 Y8.000 Z-0.227
+X6.300 Y8.000 Z-0.215
+X6.400 Y8.000 Z-0.203
+X6.500 Y8.000 Z-0.190
+X6.600 Y8.000 Z-0.177
+X6.700 Y8.000 Z-0.164
+X6.800 Y8.000 Z-0.151
+X6.900 Y8.000 Z-0.137
+X7.000 Y8.000 Z-0.124
+X7.100 Y8.000 Z-0.110
+X7.200 Y8.000 Z-0.095
+X7.300 Y8.000 Z-0.081
+X7.400 Y8.000 Z-0.067
+X7.500 Y8.000 Z-0.052
+X7.600 Y8.000 Z-0.037
+X7.700 Y8.000 Z-0.023
+X7.800 Y8.000 Z-0.008
+X7.900 Y8.000 Z0.007
+X8.000 Y8.000 Z0.022
+X8.100 Y8.000 Z0.036
+X8.200 Y8.000 Z0.051
+X8.300 Y8.000 Z0.065
+X8.400 Y8.000 Z0.080
+X8.500 Y8.000 Z0.094
+X8.600 Y8.000 Z0.108
+X8.700 Y8.000 Z0.122
+X8.800 Y8.000 Z0.136
+X8.900 Y8.000 Z0.150
+X9.000 Y8.000 Z0.163
+X9.100 Y8.000 Z0.176
+X9.200 Y8.000 Z0.189
+X9.300 Y8.000 Z0.202
+X9.400 Y8.000 Z0.214
+X9.500 Y8.000 Z0.226
+X9.600 Y8.000 Z0.237
+X9.700 Y8.000 Z0.248
+X9.800 Y8.000 Z0.259
+X9.900 Y8.000 Z0.269
+X10.000 Y8.000 Z0.279
+X10.100 Y8.000 Z0.288
+X10.200 Y8.000 Z0.297
+X10.300 Y8.000 Z0.306
+X10.400 Y8.000 Z0.314
+X10.500 Y8.000 Z0.321
+X10.600 Y8.000 Z0.328
+X10.700 Y8.000 Z0.335
+X10.800 Y8.000 Z0.341
+X10.900 Y8.000 Z0.346
+X11.000 Y8.000 Z0.351
+X11.100 Y8.000 Z0.355
+X11.200 Y8.000 Z0.359
+X11.300 Y8.000 Z0.362
+X11.400 Y8.000 Z0.364
+X11.500 Y8.000 Z0.366
+X11.600 Y8.000 Z0.368
+X11.700 Y8.000 Z0.369
+X11.800 Y8.000 Z0.369
+X11.900 Y8.000 Z0.368
+X12.000 Y8.000 Z0.367
+X12.100 Y8.000 Z0.366
+X12.200 Y8.000 Z0.364
+X12.300 Y8.000 Z0.361
+X12.400 Y8.000 Z0.357
+X12.500 Y8.000 Z0.354
+X12.600 Y8.000 Z0.349
+X12.700 Y8.000 Z0.344
+X12.800 Y8.000 Z0.338
+X12.900 Y8.000 Z0.332
+X13.000 Y8.000 Z0.326
+X13.100 Y8.000 Z0.319
+X13.200 Y8.000 Z0.311
+X13.300 Y8.000 Z0.303
+X13.400 Y8.000 Z0.294
+X13.500 Y8.000 Z0.285
+X13.600 Y8.000 Z0.275
+X13.700 Y8.000 Z0.265
+X13.800 Y8.000 Z0.255
+X13.900 Y8.000 Z0.244
+X14.000 Y8.000 Z0.233
+X14.100 Y8.000 Z0.221
+X14.200 Y8.000 Z0.209
+X14.300 Y8.000 Z0.197
+X14.400 Y8.000 Z0.184
+X14.500 Y8.000 Z0.171
+X14.600 Y8.000 Z0.158
+X14.700 Y8.000 Z0.145
+X14.800 Y8.000 Z0.131
+X14.900 Y8.000 Z0.117
+X15.000 Y8.000 Z0.103
+X15.100 Y8.000 Z0.089
+X15.200 Y8.000 Z0.074
+X15.300 Y8.000 Z0.060
+X15.400 Y8.000 Z0.045
+X15.500 Y8.000 Z0.031
+X15.600 Y8.000 Z0.016
+X15.700 Y8.000 Z0.001
+X15.800 Y8.000 Z-0.014
+X15.900 Y8.000 Z-0.028
+X16.000 Y8.000 Z-0.043
+X16.100 Y8.000 Z-0.058
+X16.200 Y8.000 Z-0.072
+X16.300 Y8.000 Z-0.086
+X16.400 Y8.000 Z-0.101
+X16.500 Y8.000 Z-0.115
+X16.600 Y8.000 Z-0.129
+X16.700 Y8.000 Z-0.142
+X16.800 Y8.000 Z-0.156
+X16.900 Y8.000 Z-0.169
+X17.000 Y8.000 Z-0.182
+X17.100 Y8.000 Z-0.195
+X17.200 Y8.000 Z-0.207
+X17.300 Y8.000 Z-0.219
+X17.400 Y8.000 Z-0.231
+X17.500 Y8.000 Z-0.242
+X17.600 Y8.000 Z-0.253
+X17.700 Y8.000 Z-0.264
+X17.800 Y8.000 Z-0.274
+X17.900 Y8.000 Z-0.283
+X18.000 Y8.000 Z-0.293
+X18.100 Y8.000 Z-0.301
+X18.200 Y8.000 Z-0.310
+X18.300 Y8.000 Z-0.317
+X18.400 Y8.000 Z-0.325
+X18.500 Y8.000 Z-0.331
+X18.600 Y8.000 Z-0.338
+X18.700 Y8.000 Z-0.343
+X18.800 Y8.000 Z-0.348
+X18.900 Y8.000 Z-0.353
+X19.000 Y8.000 Z-0.357
+X19.100 Y8.000 Z-0.360
+X19.200 Y8.000 Z-0.363
+X19.300 Y8.000 Z-0.365
+X19.400 Y8.000 Z-0.367
+X19.500 Y8.000 Z-0.368
+X19.600 Y8.000 Z-0.369
+X19.700 Y8.000 Z-0.369
+X19.800 Y8.000 Z-0.368
+X19.900 Y8.000 Z-0.367
+X20.000 Y8.000 Z-0.365
+X20.100 Y8.000 Z-0.362
+X20.200 Y8.000 Z-0.359
+X20.300 Y8.000 Z-0.356
+X20.400 Y8.000 Z-0.352
+X20.500 Y8.000 Z-0.347
+X20.600 Y8.000 Z-0.342
+X20.700 Y8.000 Z-0.336
+X20.800 Y8.000 Z-0.329
+X20.900 Y8.000 Z-0.322
+X21.000 Y8.000 Z-0.315
+X21.100 Y8.000 Z-0.307
+X21.200 Y8.000 Z-0.299
+X21.300 Y8.000 Z-0.290
+X21.400 Y8.000 Z-0.281
+X21.500 Y8.000 Z-0.271
+X21.600 Y8.000 Z-0.261
+X21.700 Y8.000 Z-0.250
+X21.800 Y8.000 Z-0.239
+X21.900 Y8.000 Z-0.227
+X22.000 Y8.000 Z-0.216
+X22.100 Y8.000 Z-0.204
+X22.200 Y8.000 Z-0.191
+X22.300 Y8.000 Z-0.178
+X22.400 Y8.000 Z-0.165
+X22.500 Y8.000 Z-0.152
+X22.600 Y8.000 Z-0.138
+X22.700 Y8.000 Z-0.125
+X22.800 Y8.000 Z-0.111
+X22.900 Y8.000 Z-0.096
+X23.000 Y8.000 Z-0.082
+X23.100 Y8.000 Z-0.068
+X23.200 Y8.000 Z-0.053
+X23.300 Y8.000 Z-0.039
+X23.400 Y8.000 Z-0.024
+X23.500 Y8.000 Z-0.009
+X23.600 Y8.000 Z0.006
+X23.700 Y8.000 Z0.020
+X23.800 Y8.000 Z0.035
+X23.900 Y8.000 Z0.050
+X24.000 Y8.000 Z0.064
+X24.100 Y8.000 Z0.079
+X24.200 Y8.000 Z0.093
+X24.300 Y8.000 Z0.107
+X24.400 Y8.000 Z0.121
+X24.500 Y8.000 Z0.135
+X24.600 Y8.000 Z0.149
+X24.700 Y8.000 Z0.162
+X24.800 Y8.000 Z0.175
+X24.900 Y8.000 Z0.188
+X25.000 Y8.000 Z0.201
+X25.100 Y8.000 Z0.213
+X25.200 Y8.000 Z0.225
+X25.300 Y8.000 Z0.236
+X25.400 Y8.000 Z0.247
+X25.500 Y8.000 Z0.258
+X25.600 Y8.000 Z0.268
+X25.700 Y8.000 Z0.278
+X25.800 Y8.000 Z0.288
+X25.900 Y8.000 Z0.297
+X26.000 Y8.000 Z0.305
+X26.100 Y8.000 Z0.313
+X26.200 Y8.000 Z0.321
+X26.300 Y8.000 Z0.328
+X26.400 Y8.000 Z0.334
+X26.500 Y8.000 Z0.340
+X26.600 Y8.000 Z0.346
+X26.700 Y8.000 Z0.350
+X26.800 Y8.000 Z0.355
+X26.900 Y8.000 Z0.359
+X27.000 Y8.000 Z0.362
+X27.100 Y8.000 Z0.364
+X27.200 Y8.000 Z0.366
+X27.300 Y8.000 Z0.368
+X27.400 Y8.000 Z0.368
+X27.500 Y8.000 Z0.369
+X27.600 Y8.000 Z0.368
+X27.700 Y8.000 Z0.367
+X27.800 Y8.000 Z0.366
+X27.900 Y8.000 Z0.364
+X28.000 Y8.000 Z0.361
+X28.100 Y8.000 Z0.358
+X28.200 Y8.000 Z0.354
+X28.300 Y8.000 Z0.349
+X28.400 Y8.000 Z0.344
+X28.500 Y8.000 Z0.339
+X28.600 Y8.000 Z0.333
+X28.700 Y8.000 Z0.326
+X28.800 Y8.000 Z0.319
+X28.900 Y8.000 Z0.312
+X29.000 Y8.000 Z0.303
+X29.100 Y8.000 Z0.295
+X29.200 Y8.000 Z0.286
+X29.300 Y8.000 Z0.276
+X29.400 Y8.000 Z0.266
+X29.500 Y8.000 Z0.256
+X29.600 Y8.000 Z0.245
+X29.700 Y8.000 Z0.234
+X29.800 Y8.000 Z0.222
+X29.900 Y8.000 Z0.210
+X30.000 Y8.000 Z0.198
+X30.000 Y8.800 Z0.235
+X29.900 Y8.800 Z0.250
+X29.800 Y8.800 Z0.264
+X29.700 Y8.800 Z0.278
+X29.600 Y8.800 Z0.291
+X29.500 Y8.800 Z0.304
+X29.400 Y8.800 Z0.316
+X29.300 Y8.800 Z0.328
+X29.200 Y8.800 Z0.340
+X29.100 Y8.800 Z0.350
+X29.000 Y8.800 Z0.361
+X28.900 Y8.800 Z0.370
+X28.800 Y8.800 Z0.379
+X28.700 Y8.800 Z0.388
+X28.600 Y8.800 Z0.396
+X28.500 Y8.800 Z0.403
+X28.400 Y8.800 Z0.410
+X28.300 Y8.800 Z0.416
+X28.200 Y8.800 Z0.421
+X28.100 Y8.800 Z0.425
+X28.000 Y8.800 Z0.429
+X27.900 Y8.800 Z0.432
+X27.800 Y8.800 Z0.435
+X27.700 Y8.800 Z0.437
+X27.600 Y8.800 Z0.438
+X27.500 Y8.800 Z0.438
+X27.400 Y8.800 Z0.438
+X27.300 Y8.800 Z0.437
+X27.200 Y8.800 Z0.435
+X27.100 Y8.800 Z0.433
+X27.000 Y8.800 Z0.430
+X26.900 Y8.800 Z0.426
+X26.800 Y8.800 Z0.422
+X26.700 Y8.800 Z0.417
+X26.600 Y8.800 Z0.411
+X26.500 Y8.800 Z0.405
+X26.400 Y8.800 Z0.397
+X26.300 Y8.800 Z0.390
+X26.200 Y8.800 Z0.381
+X26.100 Y8.800 Z0.372
+X26.000 Y8.800 Z0.363
+X25.900 Y8.800 Z0.353
+X25.800 Y8.800 Z0.342
+X25.700 Y8.800 Z0.331
+X25.600 Y8.800 Z0.319
+X25.500 Y8.800 Z0.307
+X25.400 Y8.800 Z0.294
+X25.300 Y8.800 Z0.281
+X25.200 Y8.800 Z0.267
+X25.100 Y8.800 Z0.253
+X25.000 Y8.800 Z0.239
+X24.900 Y8.800 Z0.224
+X24.800 Y8.800 Z0.208
+X24.700 Y8.800 Z0.193
+X24.600 Y8.800 Z0.177
+X24.500 Y8.800 Z0.161
+X24.400 Y8.800 Z0.144
+X24.300 Y8.800 Z0.128
+X24.200 Y8.800 Z0.111
+X24.100 Y8.800 Z0.094
+X24.000 Y8.800 Z0.076
+X23.900 Y8.800 Z0.059
+X23.800 Y8.800 Z0.042
+X23.700 Y8.800 Z0.024
+X23.600 Y8.800 Z0.007
+X23.500 Y8.800 Z-0.011
+X23.400 Y8.800 Z-0.028
+X23.300 Y8.800 Z-0.046
+X23.200 Y8.800 Z-0.063
+X23.100 Y8.800 Z-0.081
+X23.000 Y8.800 Z-0.098
+X22.900 Y8.800 Z-0.115
+X22.800 Y8.800 Z-0.132
+X22.700 Y8.800 Z-0.148
+X22.600 Y8.800 Z-0.165
+X22.500 Y8.800 Z-0.181
+X22.400 Y8.800 Z-0.197
+X22.300 Y8.800 Z-0.212
+X22.200 Y8.800 Z-0.227
+X22.100 Y8.800 Z-0.242
+X22.000 Y8.800 Z-0.256
+X21.900 Y8.800 Z-0.270
+X21.800 Y8.800 Z-0.284
+X21.700 Y8.800 Z-0.297
+X21.600 Y8.800 Z-0.310
+X21.500 Y8.800 Z-0.322
+X21.400 Y8.800 Z-0.334
+X21.300 Y8.800 Z-0.345
+X21.200 Y8.800 Z-0.355
+X21.100 Y8.800 Z-0.365
+X21.000 Y8.800 Z-0.375
+X20.900 Y8.800 Z-0.383
+X20.800 Y8.800 Z-0.392
+X20.700 Y8.800 Z-0.399
+X20.600 Y8.800 Z-0.406
+X20.500 Y8.800 Z-0.412
+X20.400 Y8.800 Z-0.418
+X20.300 Y8.800 Z-0.423
+X20.200 Y8.800 Z-0.427
+X20.100 Y8.800 Z-0.431
+X20.000 Y8.800 Z-0.434
+X19.900 Y8.800 Z-0.436
+X19.800 Y8.800 Z-0.437
+X19.700 Y8.800 Z-0.438
+X19.600 Y8.800 Z-0.438
+X19.500 Y8.800 Z-0.438
+X19.400 Y8.800 Z-0.436
+X19.300 Y8.800 Z-0.434
+X19.200 Y8.800 Z-0.432
+X19.100 Y8.800 Z-0.428
+X19.000 Y8.800 Z-0.424
+X18.900 Y8.800 Z-0.420
+X18.800 Y8.800 Z-0.414
+X18.700 Y8.800 Z-0.408
+X18.600 Y8.800 Z-0.401
+X18.500 Y8.800 Z-0.394
+X18.400 Y8.800 Z-0.386
+X18.300 Y8.800 Z-0.377
+X18.200 Y8.800 Z-0.368
+X18.100 Y8.800 Z-0.358
+X18.000 Y8.800 Z-0.348
+X17.900 Y8.800 Z-0.337
+X17.800 Y8.800 Z-0.326
+X17.700 Y8.800 Z-0.314
+X17.600 Y8.800 Z-0.301
+X17.500 Y8.800 Z-0.288
+X17.400 Y8.800 Z-0.275
+X17.300 Y8.800 Z-0.261
+X17.200 Y8.800 Z-0.246
+X17.100 Y8.800 Z-0.232
+X17.000 Y8.800 Z-0.217
+X16.900 Y8.800 Z-0.201
+X16.800 Y8.800 Z-0.185
+X16.700 Y8.800 Z-0.169
+X16.600 Y8.800 Z-0.153
+X16.500 Y8.800 Z-0.137
+X16.400 Y8.800 Z-0.120
+X16.300 Y8.800 Z-0.103
+X16.200 Y8.800 Z-0.086
+X16.100 Y8.800 Z-0.068
+X16.000 Y8.800 Z-0.051
+X15.900 Y8.800 Z-0.034
+X15.800 Y8.800 Z-0.016
+X15.700 Y8.800 Z0.001
+X15.600 Y8.800 Z0.019
+X15.500 Y8.800 Z0.036
+X15.400 Y8.800 Z0.054
+X15.300 Y8.800 Z0.071
+X15.200 Y8.800 Z0.088
+X15.100 Y8.800 Z0.106
+X15.000 Y8.800 Z0.122
+X14.900 Y8.800 Z0.139
+X14.800 Y8.800 Z0.156
+X14.700 Y8.800 Z0.172
+X14.600 Y8.800 Z0.188
+X14.500 Y8.800 Z0.204
+X14.400 Y8.800 Z0.219
+X14.300 Y8.800 Z0.234
+X14.200 Y8.800 Z0.249
+X14.100 Y8.800 Z0.263
+X14.000 Y8.800 Z0.277
+X13.900 Y8.800 Z0.290
+X13.800 Y8.800 Z0.303
+X13.700 Y8.800 Z0.315
+X13.600 Y8.800 Z0.327
+X13.500 Y8.800 Z0.339
+X13.400 Y8.800 Z0.350
+X13.300 Y8.800 Z0.360
+X13.200 Y8.800 Z0.370
+X13.100 Y8.800 Z0.379
+X13.000 Y8.800 Z0.387
+X12.900 Y8.800 Z0.395
+X12.800 Y8.800 Z0.402
+X12.700 Y8.800 Z0.409
+X12.600 Y8.800 Z0.415
+X12.500 Y8.800 Z0.420
+X12.400 Y8.800 Z0.425
+X12.300 Y8.800 Z0.429
+X12.200 Y8.800 Z0.432
+X12.100 Y8.800 Z0.435
+X12.000 Y8.800 Z0.437
+X11.900 Y8.800 Z0.438
+X11.800 Y8.800 Z0.438
+X11.700 Y8.800 Z0.438
+X11.600 Y8.800 Z0.437
+X11.500 Y8.800 Z0.436
+X11.400 Y8.800 Z0.433
+X11.300 Y8.800 Z0.430
+X11.200 Y8.800 Z0.427
+X11.100 Y8.800 Z0.422
+X11.000 Y8.800 Z0.417
+X10.900 Y8.800 Z0.411
+X10.800 Y8.800 Z0.405
+X10.700 Y8.800 Z0.398
+X10.600 Y8.800 Z0.390
+X10.500 Y8.800 Z0.382
+X10.400 Y8.800 Z0.373
+X10.300 Y8.800 Z0.364
+X10.200 Y8.800 Z0.354
+X10.100 Y8.800 Z0.343
+X10.000 Y8.800 Z0.332
+X9.900 Y8.800 Z0.320
+X9.800 Y8.800 Z0.308
+X9.700 Y8.800 Z0.295
+X9.600 Y8.800 Z0.282
+X9.500 Y8.800 Z0.268
+X9.400 Y8.800 Z0.254
+X9.300 Y8.800 Z0.240
+X9.200 Y8.800 Z0.225
+X9.100 Y8.800 Z0.210
+X9.000 Y8.800 Z0.194
+X8.900 Y8.800 Z0.178
+X8.800 Y8.800 Z0.162
+X8.700 Y8.800 Z0.146
+X8.600 Y8.800 Z0.129
+X8.500 Y8.800 Z0.112
+X8.400 Y8.800 Z0.095
+X8.300 Y8.800 Z0.078
+X8.200 Y8.800 Z0.060
+X8.100 Y8.800 Z0.043
+X8.000 Y8.800 Z0.026
+X7.900 Y8.800 Z0.008
+X7.800 Y8.800 Z-0.009
+X7.700 Y8.800 Z-0.027
+X7.600 Y8.800 Z-0.044
+X7.500 Y8.800 Z-0.062
+X7.400 Y8.800 Z-0.079
+X7.300 Y8.800 Z-0.096
+X7.200 Y8.800 Z-0.113
+X7.100 Y8.800 Z-0.130
+X7.000 Y8.800 Z-0.147
+X6.900 Y8.800 Z-0.163
+X6.800 Y8.800 Z-0.179
+X6.700 Y8.800 Z-0.195
+X6.600 Y8.800 Z-0.211
+X6.500 Y8.800 Z-0.226
+X6.400 Y8.800 Z-0.241
+X6.300 Y8.800 Z-0.255
+X6.200 Y8.800 Z-0.269
+X6.100 Y8.800 Z-0.283
+X6.000 Y8.800 Z-0.296
+X5.900 Y8.800 Z-0.309
+X5.800 Y8.800 Z-0.321
+X5.700 Y8.800 Z-0.333
+X5.600 Y8.800 Z-0.344
+X5.500 Y8.800 Z-0.354
+X5.400 Y8.800 Z-0.364
+X5.300 Y8.800 Z-0.374
+X5.200 Y8.800 Z-0.383
+X5.100 Y8.800 Z-0.391
+X5.000 Y8.800 Z-0.399
+X4.900 Y8.800 Z-0.406
+X4.800 Y8.800 Z-0.412
+X4.700 Y8.800 Z-0.418
+X4.600 Y8.800 Z-0.423
+X4.500 Y8.800 Z-0.427
+X4.400 Y8.800 Z-0.431
+X4.300 Y8.800 Z-0.434
+X4.200 Y8.800 Z-0.436
+X4.100 Y8.800 Z-0.437
+X4.000 Y8.800 Z-0.438
+X3.900 Y8.800 Z-0.438
+X3.800 Y8.800 Z-0.438
+X3.700 Y8.800 Z-0.437
+X3.600 Y8.800 Z-0.435
+X3.500 Y8.800 Z-0.432
+X3.400 Y8.800 Z-0.429
+X3.300 Y8.800 Z-0.425
+X3.200 Y8.800 Z-0.420
+X3.100 Y8.800 Z-0.415
+X3.000 Y8.800 Z-0.409
+X2.900 Y8.800 Z-0.402
+X2.800 Y8.800 Z-0.395
+X2.700 Y8.800 Z-0.387
+X2.600 Y8.800 Z-0.378
+X2.500 Y8.800 Z-0.369
+X2.400 Y8.800 Z-0.359
+X2.300 Y8.800 Z-0.349
+X2.200 Y8.800 Z-0.338
+X2.100 Y8.800 Z-0.326
+X2.000 Y8.800 Z-0.314
+X1.900 Y8.800 Z-0.302
+X1.800 Y8.800 Z-0.289
+X1.700 Y8.800 Z-0.276
+X1.600 Y8.800 Z-0.262
+X1.500 Y8.800 Z-0.248
+X1.400 Y8.800 Z-0.233
+X1.300 Y8.800 Z-0.218
+X1.200 Y8.800 Z-0.202
+X1.100 Y8.800 Z-0.187
+X1.000 Y8.800 Z-0.171
+X0.900 Y8.800 Z-0.154
+X0.800 Y8.800 Z-0.138
+X0.700 Y8.800 Z-0.121
+X0.600 Y8.800 Z-0.104
+X0.500 Y8.800 Z-0.087
+X0.400 Y8.800 Z-0.070
+X0.300 Y8.800 Z-0.052
+X0.200 Y8.800 Z-0.035
+X0.100 Y8.800 Z-0.018
+X0.000 Y8.800 Z-0.000
+G0 Z5
+M2
@@ -0,0 +1,99 @@
+/*
+  main.c - startup for Linux hosts (simulator)
+
+  Part of Grbl
+
+  Copyright (c) 2019 Terje Io
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "driver.h"
+#include "trace.h"
+#include "GRBL/grbllib.h"
+
+#ifdef STEP_PATTERN_OUTPUT
+#define OPTIONS "ve:p:z:t:c:sh"
+#else
+#define OPTIONS "ve:p:z:t:c:h"
+#endif
+
+static void usage (const char *name)
+{
+    fprintf(stderr, "usage: %s [-v] [-e eeprom_file] [-p pty_link] [-z probe_z] [-t trace_file] [-c golden_trace] [-s]\n"
+                    "  -v              virtual clock, run as fast as possible and deterministic\n"
+                    "  -e eeprom_file  file backing the settings storage (default %s)\n"
+                    "  -p pty_link     stream via a pseudo terminal symlinked to pty_link instead of stdin/stdout\n"
+                    "  -z probe_z      simulate a probe triggering at machine Z position probe_z (mm)\n"
+                    "  -t trace_file   record step and direction outputs to trace_file\n"
+                    "  -c golden_trace compare step and direction outputs to golden_trace on exit\n"
+                    "  -s              play out precomputed step patterns, requires a build with STEP_PATTERN_OUTPUT\n",
+                    name, sim.eeprom_file);
+}
+
+int main (int argc, char **argv)
+{
+    int opt;
+
+    while((opt = getopt(argc, argv, OPTIONS)) != -1) switch(opt) {
+
+        case 'v':
+            sim.virtual_clock = true;
+            break;
+
+        case 'e':
+            sim.eeprom_file = optarg;
+            break;
+
+        case 'p':
+            sim.pty_link = optarg;
+            break;
+
+        case 'z':
+            sim.probe_z = strtof(optarg, NULL);
+            sim.probe_enable = true;
+            break;
+
+        case 't':
+            sim.trace_file = optarg;
+            break;
+
+        case 'c':
+            sim.trace_golden = optarg;
+            break;
+
+#ifdef STEP_PATTERN_OUTPUT
+        case 's':
+            sim.step_pattern = true;
+            break;
+#endif
+
+        default:
+            usage(argv[0]);
+            return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if((sim.trace_file || sim.trace_golden) && !trace_open(sim.trace_file, sim.trace_golden)) {
+        perror("grblHAL: trace");
+        return EXIT_FAILURE;
+    }
+
+    grbl_enter();
+
+    return 0;
+}
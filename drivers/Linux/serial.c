@@ -0,0 +1,290 @@
+/*
+  serial.c - stdin/stdout or pseudo terminal stream for Linux hosts (simulator)
+
+  Part of Grbl
+
+  Copyright (c) 2019 Terje Io
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <poll.h>
+#include <termios.h>
+
+#include "serial.h"
+#include "GRBL/grbl.h"
+
+#define BUFCOUNT(head, tail, size) ((head >= tail) ? (head - tail) : (size - tail + head))
+
+static char rxbuf[RX_BUFFER_SIZE];
+static volatile uint16_t rx_head = 0, rx_tail = 0;
+static uint16_t span_tail = 0;
+
+// Staging buffer for blocking (virtual clock) mode, characters are moved to rxbuf one by one
+// when the protocol loop asks for them. This makes the point in time realtime commands are
+// seen independent of how the kernel chunks the input.
+static char stagebuf[4096];
+static uint_fast16_t stage_head = 0, stage_len = 0;
+
+static int fd_in = STDIN_FILENO, fd_out = STDOUT_FILENO;
+static bool blocking = false, is_pty = false, tty_saved = false;
+static volatile bool eof = false, reading = false;
+static struct termios tty_mode;
+
+static void serialRestore (void)
+{
+    if(tty_saved)
+        tcsetattr(fd_in, TCSANOW, &tty_mode);
+}
+
+// Adds a received character to the input buffer, realtime commands are picked out
+// the same way as a MCU UART interrupt handler does.
+static inline bool rx_put (char c)
+{
+    uint16_t bptr = (rx_head + 1) & (RX_BUFFER_SIZE - 1); // Get next head pointer
+
+    if(bptr == rx_tail)                                   // If buffer full
+        return false;                                     // leave data in the kernel buffer (flow control)
+
+    if(!hal.protocol_process_realtime || hal.protocol_process_realtime(c)) {
+        rxbuf[rx_head] = c;     // Add data to buffer
+        rx_head = bptr;         // and update pointer
+    }
+
+    return true;
+}
+
+// Reads from input, returns false if no data was read.
+static bool rx_fill (bool wait)
+{
+    ssize_t count;
+    struct pollfd pfd = { .fd = fd_in, .events = POLLIN };
+
+    if(eof)
+        return false;
+
+    if(wait)
+        while(poll(&pfd, 1, -1) < 0 && errno == EINTR);
+    else if(blocking && poll(&pfd, 1, 0) <= 0)
+        return false;
+
+    if((count = read(fd_in, stagebuf, sizeof(stagebuf))) > 0) {
+        stage_head = 0;
+        stage_len = (uint_fast16_t)count;
+    } else if(count == 0 || (errno != EAGAIN && errno != EINTR && !(is_pty && errno == EIO)))
+        eof = true; // NOTE: reading a pty master returns EIO while no client is connected.
+
+    return count > 0;
+}
+
+bool serialInit (const char *pty_link, bool blocking_reads)
+{
+    blocking = blocking_reads;
+
+    if(pty_link) {
+
+        struct termios mode;
+        int fd_slave;
+
+        if((fd_in = posix_openpt(O_RDWR|O_NOCTTY)) < 0 || grantpt(fd_in) || unlockpt(fd_in))
+            return false;
+
+        // Set slave side to raw mode, keep a handle open so the master does not see hangups between clients.
+        if((fd_slave = open(ptsname(fd_in), O_RDWR|O_NOCTTY)) >= 0 && tcgetattr(fd_slave, &mode) == 0) {
+            cfmakeraw(&mode);
+            tcsetattr(fd_slave, TCSANOW, &mode);
+        }
+
+        unlink(pty_link);
+        if(symlink(ptsname(fd_in), pty_link))
+            return false;
+
+        fprintf(stderr, "grblHAL: stream available at %s (%s)\n", pty_link, ptsname(fd_in));
+
+        fd_out = fd_in;
+        is_pty = true;
+
+    } else if(isatty(fd_in) && tcgetattr(fd_in, &tty_mode) == 0) {
+
+        // Character mode without echo so realtime commands are acted upon without waiting for enter.
+        struct termios mode = tty_mode;
+
+        mode.c_lflag &= ~(ICANON|ECHO);
+        mode.c_cc[VMIN] = 1;
+        mode.c_cc[VTIME] = 0;
+
+        if((tty_saved = tcsetattr(fd_in, TCSANOW, &mode) == 0))
+            atexit(serialRestore);
+    }
+
+    if(!blocking)
+        fcntl(fd_in, F_SETFL, fcntl(fd_in, F_GETFL) | O_NONBLOCK);
+
+    return true;
+}
+
+// Simulated UART RX interrupt, called from the systick handler.
+// NOTE: in blocking mode only called when the protocol loop is stalled, to pick out realtime commands.
+void serialPoll (void)
+{
+    if(reading)
+        return;
+
+    do {
+        while(stage_head < stage_len) {
+            if(!rx_put(stagebuf[stage_head]))
+                return;
+            stage_head++;
+        }
+    } while(rx_fill(false));
+}
+
+// Returns true when input is exhausted and all received data has been consumed.
+bool serialEOF (void)
+{
+    return eof && stage_head == stage_len && rx_tail == rx_head;
+}
+
+// Returns true when input is exhausted, data may still be buffered.
+bool serialClosed (void)
+{
+    return eof;
+}
+
+// In blocking mode the host is regarded as infinitely fast, the next character is
+// fetched from the staging buffer only when the protocol loop asks for it.
+// For bulk reads the rest of the line is fetched, up to and including a realtime command
+// as the protocol loop would have read the characters preceding it before it was seen.
+static void rx_wait (uint16_t bptr, bool line)
+{
+    char c;
+    uint16_t head;
+
+    reading = true;
+    while(bptr == rx_head) {
+        if(stage_head == stage_len && !rx_fill(true))
+            break;
+        rx_put(stagebuf[stage_head++]);
+    }
+    if(line && bptr != rx_head) {
+        c = rxbuf[bptr];
+        while(c != '\n' && c != '\r' && (stage_head < stage_len || rx_fill(false))) {
+            head = rx_head;
+            if(!rx_put(c = stagebuf[stage_head]))
+                break;
+            stage_head++;
+            if(head == rx_head) // Realtime command
+                break;
+        }
+    }
+    reading = false;
+}
+
+//
+// serialGetC - returns -1 if no data available
+//
+int16_t serialGetC (void)
+{
+    int16_t data;
+    uint16_t bptr = rx_tail;
+
+    if(blocking && bptr == rx_head)
+        rx_wait(bptr, false);
+
+    if(bptr == rx_head)
+        return SERIAL_NO_DATA; // no data available else EOF
+
+    data = rxbuf[bptr++];                   // Get next character, increment tmp pointer
+    rx_tail = bptr & (RX_BUFFER_SIZE - 1);  // and update pointer
+
+    return data;
+}
+
+//
+// serialReadSpan - returns the number of characters that can be read contiguously, up to the end of the buffer
+//
+uint16_t serialReadSpan (char **data)
+{
+    uint16_t head, tail = rx_tail;
+
+    if(blocking && tail == rx_head)
+        rx_wait(tail, true);
+
+    head = rx_head;
+    span_tail = tail;
+    *data = &rxbuf[tail];
+
+    return head >= tail ? head - tail : RX_BUFFER_SIZE - tail;
+}
+
+//
+// serialReadCommit - consumes count characters of the last span, fails if the buffer has been flushed or cancelled
+//
+bool serialReadCommit (uint16_t count)
+{
+    uint16_t tail = (span_tail + count) & (RX_BUFFER_SIZE - 1);
+
+    // The tail pointer is only changed by a flush or cancel while a span is read.
+    if(!__sync_bool_compare_and_swap(&rx_tail, span_tail, tail))
+        return false;
+
+    span_tail = tail;
+
+    return true;
+}
+
+uint16_t serialRxFree (void)
+{
+    uint16_t head = rx_head, tail = rx_tail;
+
+    return (RX_BUFFER_SIZE - 1) - BUFCOUNT(head, tail, RX_BUFFER_SIZE);
+}
+
+void serialRxFlush (void)
+{
+    rx_tail = rx_head;
+}
+
+void serialRxCancel (void)
+{
+    rxbuf[rx_head] = ASCII_CAN;
+    rx_tail = rx_head;
+    rx_head = (rx_tail + 1) & (RX_BUFFER_SIZE - 1);
+}
+
+void serialWriteS (const char *data)
+{
+    ssize_t count;
+    size_t length = strlen(data);
+    struct pollfd pfd = { .fd = fd_out, .events = POLLOUT };
+
+    while(length) {
+        if((count = write(fd_out, data, length)) > 0) {
+            data += count;
+            length -= count;
+        } else if(count < 0 && (errno == EAGAIN || errno == EINTR || (is_pty && errno == EIO))) {
+            if(!hal.stream_blocking_callback())     // Output blocked, wait for space
+                return;                             // unless aborted.
+            poll(&pfd, 1, 1);
+        } else
+            return;
+    }
+}
@@ -0,0 +1,45 @@
+/*
+  serial.h - stdin/stdout or pseudo terminal stream for Linux hosts (simulator)
+
+  Part of Grbl
+
+  Copyright (c) 2019 Terje Io
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __SERIAL_H__
+#define __SERIAL_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ASCII_CAN  0x18
+#define ASCII_EOL  "\r\n"
+
+#define RX_BUFFER_SIZE 1024     // must be a power of 2
+
+bool serialInit (const char *pty_link, bool blocking_reads);
+void serialPoll (void);
+bool serialEOF (void);
+bool serialClosed (void);
+int16_t serialGetC (void);
+uint16_t serialReadSpan (char **data);
+bool serialReadCommit (uint16_t count);
+void serialWriteS (const char *data);
+uint16_t serialRxFree (void);
+void serialRxFlush (void);
+void serialRxCancel (void);
+
+#endif
@@ -0,0 +1,366 @@
+/*
+  trace.c - step/direction output recorder for Linux hosts (simulator)
+
+  Part of Grbl
+
+  Copyright (c) 2019 Terje Io
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//
+// Records step and direction outputs with simulated timestamps to a compact binary trace.
+// When a golden trace is given the recording is compared to it on exit, differences in step
+// count, final position and timing are reported on stderr and the process exits with failure status.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+
+#include "driver.h"
+#include "trace.h"
+
+#define TRACE_MAGIC "GRBLTRC"
+
+typedef struct {
+    trace_record_t type;
+    uint64_t cycles;            // Absolute time of record
+    uint8_t step;
+    uint8_t dir;
+    uint32_t tick;
+} trace_event_t;
+
+typedef struct {
+    FILE *file;
+    uint32_t f_step_timer;
+    uint64_t records;
+    uint64_t cycles;
+    uint64_t motion_cycles;     // Time of last step or tick record
+    uint64_t steps[N_AXIS];
+    int32_t position[N_AXIS];
+    bool complete;              // End record seen and final position matches steps
+} trace_reader_t;
+
+static FILE *trace = NULL;
+static char *trace_file = NULL, *golden_file = NULL;
+static bool trace_tmp = false;
+static uint64_t last_cycles = 0;
+static uint32_t last_tick = 0;
+static int32_t position[N_AXIS];
+static char stmp[] = "/tmp/grbltrace.XXXXXX";
+
+static void put_u8 (uint8_t value)
+{
+    fputc(value, trace);
+}
+
+static void put_u32 (uint32_t value)
+{
+    uint_fast8_t idx = 4;
+
+    do {
+        fputc(value & 0xFF, trace);
+        value >>= 8;
+    } while(--idx);
+}
+
+static void put_varint (uint64_t value)
+{
+    while(value >= 0x80) {
+        fputc((value & 0x7F) | 0x80, trace);
+        value >>= 7;
+    }
+    fputc((uint8_t)value, trace);
+}
+
+static void put_record (trace_record_t type, uint64_t cycles)
+{
+    put_u8(type);
+    put_varint(cycles - last_cycles);
+    last_cycles = cycles;
+}
+
+void trace_step (uint64_t cycles, axes_signals_t step_outbits, axes_signals_t dir_outbits)
+{
+    uint_fast8_t idx = N_AXIS;
+
+    if(!trace)
+        return;
+
+    put_record(Trace_Step, cycles);
+    put_u8(step_outbits.value);
+    put_u8(dir_outbits.value);
+
+    do {
+        idx--;
+        if(step_outbits.value & bit(idx))
+            position[idx] += (dir_outbits.value & bit(idx)) ? -1 : 1;
+    } while(idx);
+}
+
+void trace_tick (uint64_t cycles, uint32_t cycles_per_tick)
+{
+    if(!trace || cycles_per_tick == last_tick)
+        return;
+
+    last_tick = cycles_per_tick;
+
+    put_record(Trace_Tick, cycles);
+    put_varint(cycles_per_tick);
+}
+
+static bool get_u32 (FILE *file, uint32_t *value)
+{
+    int c;
+    uint_fast8_t idx = 0;
+
+    *value = 0;
+
+    do {
+        if((c = fgetc(file)) == EOF)
+            return false;
+        *value |= (uint32_t)c << (idx * 8);
+    } while(++idx < 4);
+
+    return true;
+}
+
+static bool get_varint (FILE *file, uint64_t *value)
+{
+    int c;
+    uint_fast8_t shift = 0;
+
+    *value = 0;
+
+    do {
+        if((c = fgetc(file)) == EOF || shift > 63)
+            return false;
+        *value |= (uint64_t)(c & 0x7F) << shift;
+        shift += 7;
+    } while(c & 0x80);
+
+    return true;
+}
+
+static bool reader_open (trace_reader_t *reader, const char *filename)
+{
+    char magic[sizeof(TRACE_MAGIC)];
+    uint32_t hdr;
+
+    memset(reader, 0, sizeof(trace_reader_t));
+
+    if((reader->file = fopen(filename, "rb")) == NULL)
+        return false;
+
+    if(fread(magic, sizeof(magic), 1, reader->file) != 1 || memcmp(magic, TRACE_MAGIC, sizeof(magic)) ||
+        !get_u32(reader->file, &hdr) || (hdr & 0xFF) != TRACE_VERSION || ((hdr >> 8) & 0xFF) != N_AXIS ||
+         !get_u32(reader->file, &reader->f_step_timer)) {
+        fclose(reader->file);
+        reader->file = NULL;
+    }
+
+    return reader->file != NULL;
+}
+
+// Reads next record, returns false at end of trace.
+static bool reader_next (trace_reader_t *reader, trace_event_t *event)
+{
+    int c;
+    uint64_t value;
+    uint_fast8_t idx = N_AXIS;
+
+    if(reader->file == NULL || (c = fgetc(reader->file)) == EOF || !get_varint(reader->file, &value))
+        return false;
+
+    memset(event, 0, sizeof(trace_event_t));
+    event->type = (trace_record_t)c;
+    event->cycles = reader->cycles += value;
+
+    switch(event->type) {
+
+        case Trace_Step:
+            reader->motion_cycles = event->cycles;
+            if((c = fgetc(reader->file)) == EOF)
+                return false;
+            event->step = (uint8_t)c;
+            if((c = fgetc(reader->file)) == EOF)
+                return false;
+            event->dir = (uint8_t)c;
+            do {
+                idx--;
+                if(event->step & bit(idx)) {
+                    reader->steps[idx]++;
+                    reader->position[idx] += (event->dir & bit(idx)) ? -1 : 1;
+                }
+            } while(idx);
+            break;
+
+        case Trace_Tick:
+            if(!get_varint(reader->file, &value))
+                return false;
+            event->tick = (uint32_t)value;
+            reader->motion_cycles = event->cycles;
+            break;
+
+        case Trace_End:
+            reader->complete = true;
+            do {
+                uint32_t end_position;
+                idx--;
+                if(!get_u32(reader->file, &end_position))
+                    return false;
+                reader->complete = reader->complete && (int32_t)end_position == reader->position[idx];
+            } while(idx);
+            fclose(reader->file);
+            reader->file = NULL;
+            return false;
+
+        default:
+            return false;
+    }
+
+    reader->records++;
+
+    return true;
+}
+
+static float trace_seconds (trace_reader_t *reader)
+{
+    return reader->f_step_timer ? (float)((double)reader->motion_cycles / (double)reader->f_step_timer) : 0.0f;
+}
+
+// Compares recorded trace to the golden trace and reports to stderr, returns true if identical.
+static bool trace_compare (void)
+{
+    bool match, more = true, more_golden = true;
+    uint64_t diff_record = 0, diff_cycles = 0;
+    uint_fast8_t idx;
+    trace_event_t event, golden_event;
+    trace_reader_t reader, golden;
+    static const char axis_letter[] = "XYZABC";
+
+    if(!reader_open(&reader, trace_file)) {
+        fprintf(stderr, "trace: failed to read %s\n", trace_file);
+        return false;
+    }
+
+    if(!reader_open(&golden, golden_file)) {
+        fclose(reader.file);
+        fprintf(stderr, "trace: failed to read golden trace %s\n", golden_file);
+        return false;
+    }
+
+    while(more || more_golden) {
+
+        if(more)
+            more = reader_next(&reader, &event);
+
+        if(more_golden)
+            more_golden = reader_next(&golden, &golden_event);
+
+        if(diff_cycles == 0 && (more != more_golden || (more && memcmp(&event, &golden_event, sizeof(trace_event_t))))) {
+            diff_record = reader.records;
+            diff_cycles = more ? event.cycles : golden_event.cycles;
+            if(diff_cycles == 0)
+                diff_cycles = 1;
+        }
+    }
+
+    match = diff_cycles == 0 && reader.complete && golden.complete && reader.f_step_timer == golden.f_step_timer;
+
+    fprintf(stderr, "trace: %s vs %s\n", trace_tmp ? "run" : trace_file, golden_file);
+    fprintf(stderr, "trace: records %llu (golden %llu)\n", (unsigned long long)reader.records, (unsigned long long)golden.records);
+    fprintf(stderr, "trace: time %.6f s (golden %.6f s, %+.6f s)\n", trace_seconds(&reader), trace_seconds(&golden), trace_seconds(&reader) - trace_seconds(&golden));
+
+    for(idx = 0; idx < N_AXIS; idx++)
+        fprintf(stderr, "trace: %c steps %llu (golden %llu), position %ld (golden %ld)%s\n", axis_letter[idx],
+                 (unsigned long long)reader.steps[idx], (unsigned long long)golden.steps[idx],
+                  (long)reader.position[idx], (long)golden.position[idx],
+                   reader.steps[idx] != golden.steps[idx] || reader.position[idx] != golden.position[idx] ? " *" : "");
+
+    if(!(reader.complete && golden.complete))
+        fprintf(stderr, "trace: %s is truncated or corrupt\n", reader.complete ? golden_file : trace_file);
+
+    if(diff_cycles)
+        fprintf(stderr, "trace: first difference at record %llu, %.6f s\n", (unsigned long long)diff_record,
+                 reader.f_step_timer ? (double)diff_cycles / (double)reader.f_step_timer : 0.0);
+
+    fprintf(stderr, "trace: %s\n", match ? "ok" : "differs");
+
+    return match;
+}
+
+static void trace_close (void)
+{
+    uint_fast8_t idx = N_AXIS;
+    sigset_t mask;
+
+    if(!trace)
+        return;
+
+    // Block simulated interrupts, the stepper handler must not record while closing.
+    sigfillset(&mask);
+    sigprocmask(SIG_BLOCK, &mask, NULL);
+
+    put_record(Trace_End, sim_get_cycles());
+    do {
+        put_u32((uint32_t)position[--idx]);
+    } while(idx);
+
+    fclose(trace);
+    trace = NULL;
+
+    if(golden_file) {
+
+        bool match = trace_compare();
+
+        if(trace_tmp)
+            unlink(trace_file);
+
+        if(!match)
+            _exit(EXIT_FAILURE);
+    }
+}
+
+// Opens trace file for recording, if filename is NULL a temporary file is used for comparison with golden.
+bool trace_open (const char *filename, const char *golden)
+{
+    int fd;
+
+    if((trace_tmp = filename == NULL)) {
+        if((fd = mkstemp(stmp)) < 0)
+            return false;
+        close(fd);
+        filename = stmp;
+    }
+
+    if((trace = fopen(filename, "wb")) == NULL)
+        return false;
+
+    trace_file = (char *)filename;
+    golden_file = (char *)golden;
+
+    setvbuf(trace, NULL, _IOFBF, 65536);
+
+    fwrite(TRACE_MAGIC, sizeof(TRACE_MAGIC), 1, trace);
+    put_u32(TRACE_VERSION | (N_AXIS << 8));
+    put_u32(F_STEP_TIMER);
+
+    atexit(trace_close);
+
+    return true;
+}
@@ -0,0 +1,55 @@
+/*
+  trace.h - step/direction output recorder for Linux hosts (simulator)
+
+  Part of Grbl
+
+  Copyright (c) 2019 Terje Io
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "GRBL/grbl.h"
+
+/*
+  Trace file format, all multi byte values are little endian:
+
+  Header: "GRBLTRC" + '\0', uint8_t version, uint8_t N_AXIS, uint16_t reserved, uint32_t stepper timer frequency.
+
+  Records: uint8_t type, varint cycles since previous record, payload:
+    Trace_Step - uint8_t step bits, uint8_t direction bits (set = negative direction).
+    Trace_Tick - varint stepper timer cycles per tick, recorded when changed.
+    Trace_End  - int32_t final position in steps per axis.
+
+  Varints are unsigned LEB128 encoded.
+*/
+
+#define TRACE_VERSION 1
+
+typedef enum {
+    Trace_End = 0,
+    Trace_Step,
+    Trace_Tick
+} trace_record_t;
+
+bool trace_open (const char *filename, const char *golden);
+void trace_step (uint64_t cycles, axes_signals_t step_outbits, axes_signals_t dir_outbits);
+void trace_tick (uint64_t cycles, uint32_t cycles_per_tick);
+
+#endif
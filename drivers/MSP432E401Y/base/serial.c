@@ -45,6 +45,7 @@ static serial_buffer_t rxbuffer = {
     .rts_state = false
 };
 static serial_buffer_t rxbackup;
+static uint_fast16_t span_tail = 0;
 
 static char txbuf[TX_BUFFER_SIZE];
 static volatile uint_fast16_t tx_head = 0, tx_tail = 0;
@@ -142,6 +143,40 @@ int16_t serialGetC (void)
     return (int16_t)c;
 }
 
+//
+// serialReadSpan - returns the number of characters that can be read contiguously, up to the end of the buffer
+//
+uint16_t serialReadSpan (char **data)
+{
+    uint_fast16_t head = rxbuffer.head, tail = rxbuffer.tail;
+
+    span_tail = tail;
+    *data = &rxbuffer.data[tail];
+
+    return head >= tail ? head - tail : RX_BUFFER_SIZE - tail;
+}
+
+//
+// serialReadCommit - consumes count characters of the last span, fails if the buffer has been flushed or cancelled
+//
+bool serialReadCommit (uint16_t count)
+{
+    bool ok;
+
+    // The tail pointer is only changed by a flush or cancel while a span is read. Cancels are issued
+    // from the UART interrupt handler, so it is disabled while the tail is checked and updated.
+    UARTIntDisable(SERIAL1_BASE, UART_INT_RX|UART_INT_RT);
+    if((ok = rxbuffer.tail == span_tail))
+        rxbuffer.tail = span_tail = (span_tail + count) & (RX_BUFFER_SIZE - 1);
+    UARTIntEnable(SERIAL1_BASE, UART_INT_RX|UART_INT_RT);
+
+ #ifdef RTS_PORT
+    if (rxbuffer.rts_state && BUFCOUNT(rxbuffer.head, rxbuffer.tail, RX_BUFFER_SIZE) < RX_BUFFER_LWM)   // Clear RTS if
+        GPIOPinWrite(RTS_PORT, RTS_PIN, rxbuffer.rts_state = 0);                                        // buffer count is below low water mark
+ #endif
+    return ok;
+}
+
 // "dummy" version of serialGetC
 static int16_t serialGetNull (void)
 {
@@ -212,9 +247,11 @@ void serialWriteS (const char *data)
 
 bool serialSuspendInput (bool suspend)
 {
-    if(suspend)
+    if(suspend) {
         hal.stream.read = serialGetNull;
-    else if(rxbuffer.backup)
+        hal.stream.read_span = NULL;
+        hal.stream.read_commit = NULL;
+    } else if(rxbuffer.backup)
         memcpy(&rxbuffer, &rxbackup, sizeof(serial_buffer_t));
 
     return rxbuffer.tail != rxbuffer.head;
@@ -263,6 +300,8 @@ static void uart_interrupt_handler (void)
             rxbuffer.backup = true;
             rxbuffer.tail = rxbuffer.head;
             hal.stream.read = serialGetC; // restore normal input
+            hal.stream.read_span = serialReadSpan;
+            hal.stream.read_commit = serialReadCommit;
 
         } else if(!hal.protocol_process_realtime || hal.protocol_process_realtime((char)c)) {
 
@@ -297,7 +297,7 @@ void process_keypress (uint_fast16_t state) {
 		}
 
 		if(!(jogCommand && keyreleased)) { // key still pressed? - do not execute jog command if released!
-			addedGcode = hal.protocol_enqueue_gcode(command);
+			addedGcode = hal.protocol_enqueue_command(command, CommandPriority_High);
 			jogging = jogging || (jogCommand && addedGcode);
 		}
 	}
@@ -260,7 +260,7 @@ void serialRxFlush (void)
 //
 void serialRxCancel (void)
 {
-    rxbuffer.data[rxbuffer.head] = ASCII_EOL;
+    rxbuffer.data[rxbuffer.head] = CMD_RESET;
     rxbuffer.tail = rxbuffer.head;
     rxbuffer.head = (rxbuffer.tail + 1) & (RX_BUFFER_SIZE - 1);
 }
@@ -87,6 +87,7 @@ typedef struct {
 } spindle_sync_t;
 
 static volatile uint32_t ms_count = 1, pid_count = 0; // NOTE: initial value 1 is for "resetting" systick timer
+static volatile uint32_t elapsed_ticks = 0;
 static volatile bool spindleLock = false;
 static bool pwmEnabled = false, IOInitDone = false;
 // Inverts the probe pin state depending on user settings and probing cycle mode.
@@ -208,6 +209,12 @@ static void driver_delay_ms (uint32_t ms, void (*callback)(void))
         callback();
 }
 
+// Milliseconds since startup, valid while automatic status reports are enabled.
+static uint32_t getElapsedTicks (void)
+{
+    return elapsed_ticks;
+}
+
 // Enable/disable stepper motors
 static void stepperEnable (axes_signals_t enable)
 {
@@ -588,7 +595,7 @@ static void spindleSetStateVariable (spindle_state_t state, float rpm)
     if (!state.on || rpm == 0.0f) {
         spindle_set_speed(spindle_pwm.off_value);
         spindle_off();
-        if(ms_count == 0)
+        if(ms_count == 0 && !settings.report_interval)
             SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
         spindle_encoder.pid_state = PIDState_Disabled;
     } else {
@@ -850,6 +857,9 @@ void settings_changed (settings_t *settings)
         SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
     }
 
+    if(settings->report_interval) // Keep systick timer running for elapsed time.
+        SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
     if(hal.spindle_get_data && spindle_encoder.ppr != settings->spindle.ppr) {
         spindle_encoder.ppr = settings->spindle.ppr;
         spindle_encoder.pulse_counter_trigger = 4;
@@ -1118,7 +1128,7 @@ static bool driver_setup (settings_t *settings)
 
 // Set defaults
 
-    IOInitDone = settings->version == 14;
+    IOInitDone = settings->version == 15;
 
     settings_changed(settings);
 
@@ -1160,6 +1170,7 @@ bool driver_init (void) {
     hal.f_step_timer = SystemCoreClock;
     hal.rx_buffer_size = RX_BUFFER_SIZE;
     hal.delay_ms = driver_delay_ms;
+    hal.get_elapsed_ticks = getElapsedTicks;
     hal.settings_changed = settings_changed;
 
     hal.stepper_wake_up = stepperWakeUp;
@@ -1425,6 +1436,8 @@ void SysTick_Handler (void)
 {
     static uint32_t spid = SPINDLE_PID_SAMPLE_RATE;
 
+    elapsed_ticks++;
+
     switch(spindle_encoder.pid_state) {
 
         case PIDState_Pending:
@@ -1443,7 +1456,7 @@ void SysTick_Handler (void)
     }
 
     if(ms_count && !(--ms_count)) {
-        if(spindle_encoder.pid_state == PIDState_Disabled)
+        if(spindle_encoder.pid_state == PIDState_Disabled && !settings.report_interval)
             SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
         if(delayCallback) {
             delayCallback();
@@ -66,6 +66,8 @@ static uint16_t step_prescaler[3] = {
 const io_stream_t serial_stream = {
     .type = StreamSetting_Serial,
     .read = serialGetC,
+    .read_span = serialReadSpan,
+    .read_commit = serialReadCommit,
     .write = serialWriteS,
     .write_all = serialWriteS,
     .get_rx_buffer_available = serialRxFree,
@@ -317,6 +319,12 @@ void vTimerCallback (TimerHandle_t xTimer)
         delayCallback();
 }
 
+// Milliseconds since startup, derived from the FreeRTOS tick count.
+static uint32_t getElapsedTicks (void)
+{
+    return xTaskGetTickCount() * portTICK_PERIOD_MS;
+}
+
 static void driver_delay_ms (uint32_t ms, void (*callback)(void))
 {
     if(callback) {
@@ -1035,6 +1043,8 @@ static void modeSelect (bool mpg_mode)
     if(mpg_mode) {
         normal_stream = hal.stream.type;
         hal.stream.read = serial2GetC;
+        hal.stream.read_span = NULL;
+        hal.stream.read_commit = NULL;
         hal.stream.get_rx_buffer_available = serial2RxFree;
         hal.stream.cancel_read_buffer = serial2RxCancel;
         hal.stream.reset_read_buffer = serial2RxFlush;
@@ -1498,7 +1508,7 @@ static bool driver_setup (settings_t *settings)
 
   // Set defaults
 
-    IOInitDone = settings->version == 14;
+    IOInitDone = settings->version == 15;
 
     settings_changed(settings);
 
@@ -1609,6 +1619,9 @@ bool driver_init (void)
 #endif
     hal.rx_buffer_size = RX_BUFFER_SIZE;
     hal.delay_ms = driver_delay_ms;
+#ifdef FreeRTOS
+    hal.get_elapsed_ticks = getElapsedTicks;
+#endif
     hal.settings_changed = settings_changed;
 
     hal.stepper_wake_up = stepperWakeUp;
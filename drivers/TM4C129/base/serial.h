@@ -120,6 +120,8 @@
 */
 void serialInit (void);
 int16_t serialGetC (void);
+uint16_t serialReadSpan (char **data);
+bool serialReadCommit (uint16_t count);
 bool serialPutC (const char data);
 void serialWriteS (const char *data);
 bool serialSuspendInput (bool suspend);
@@ -85,6 +85,7 @@ static file_t file = {
 };
 
 static io_stream_t active_stream;
+static volatile bool cancel_read = false;
 //static report_t active_reports;
 
 #ifdef __MSP432E401Y__
@@ -264,6 +265,7 @@ static status_code_t sdcard_ls (char *buf)
 static void sdcard_end_job (void)
 {
     file_close();
+    cancel_read = false;
     memcpy(&hal.stream, &active_stream, sizeof(io_stream_t));   // Restore stream pointers
     hal.stream.reset_read_buffer();                             // and flush input buffer
     hal.driver_rt_report = NULL;
@@ -298,6 +300,11 @@ static int16_t sdcard_read (void)
 {
     int16_t c = -1;
 
+    if(cancel_read) { // Input cancelled, return the CMD_RESET character the protocol loop waits for
+        cancel_read = false;
+        return CMD_RESET;
+    }
+
     if(file.eol == 1)
         file.line++;
 
@@ -318,6 +325,15 @@ static int16_t sdcard_read (void)
     return c;
 }
 
+// Called from the real time command handler on a stop or jog cancel.
+static void sdcard_cancel (void)
+{
+    if(hal.stream.read == sdcard_read)
+        cancel_read = true;                 // Reading from SD card, let sdcard_read() return CMD_RESET
+    else
+        active_stream.cancel_read_buffer(); // Input is from the originating stream while suspended
+}
+
 static void sdcard_report (stream_write_ptr stream_write)
 {
     stream_write("|SD:");
@@ -365,6 +381,9 @@ static status_code_t sdcard_parse (uint_fast16_t state, char *line, char *lcline
                     memcpy(&active_stream, &hal.stream, sizeof(io_stream_t));   // Save current stream pointers
                     hal.stream.type = StreamSetting_SDCard;                     // then redirect to read from SD card instead
                     hal.stream.read = sdcard_read;                              // ...
+                    hal.stream.cancel_read_buffer = sdcard_cancel;              // ...
+                    hal.stream.read_span = NULL;                                // ...
+                    hal.stream.read_commit = NULL;                              // ...
 #if M6_ENABLE
                     hal.stream.suspend_read = sdcard_suspend;                   // ...
 #else